@@ -6,7 +6,7 @@
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
-# date: 2015-03-15
+# date: 2015-06-01
 #
 
 #-----------------------------------------------------------------------------------------------------------------------
@@ -15,24 +15,37 @@
 
 SUBDIRECTORIES += source/allocators
 SUBDIRECTORIES += source/architecture
-SUBDIRECTORIES += source/chip/STMicroelectronics/STM32F4
+ifneq ($(ARCHITECTURE),Linux)
+	SUBDIRECTORIES += source/chip/STMicroelectronics/STM32F4
+endif
 SUBDIRECTORIES += source/clocks
 SUBDIRECTORIES += source/scheduler
 SUBDIRECTORIES += source/synchronization
-SUBDIRECTORIES += source/syscalls
+ifneq ($(ARCHITECTURE),Linux)
+	SUBDIRECTORIES += source/syscalls
+endif
 SUBDIRECTORIES += source/threads
-SUBDIRECTORIES += test
+
+ifeq ($(BENCHMARK),1)
+	SUBDIRECTORIES += benchmark
+else
+	SUBDIRECTORIES += test
+endif
 
 #-----------------------------------------------------------------------------------------------------------------------
 # final targets
 #-----------------------------------------------------------------------------------------------------------------------
 
 ELF := $(ELF) $(OUTPUT)$(PROJECT).elf
-HEX := $(HEX) $(OUTPUT)$(PROJECT).hex
-BIN := $(BIN) $(OUTPUT)$(PROJECT).bin
 DMP := $(DMP) $(OUTPUT)$(PROJECT).dmp
 LSS := $(LSS) $(OUTPUT)$(PROJECT).lss
 
+# raw images are useful only for flashing the chip
+ifneq ($(ARCHITECTURE),Linux)
+	HEX := $(HEX) $(OUTPUT)$(PROJECT).hex
+	BIN := $(BIN) $(OUTPUT)$(PROJECT).bin
+endif
+
 #-----------------------------------------------------------------------------------------------------------------------
 # .elf file depends on this Rules.mk
 #-----------------------------------------------------------------------------------------------------------------------
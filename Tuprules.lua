@@ -6,7 +6,7 @@
 -- This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 -- distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 --
--- date: 2015-04-07
+-- date: 2015-05-25
 --
 
 ------------------------------------------------------------------------------------------------------------------------
@@ -69,6 +69,9 @@ CSTD = "-std=gnu99"
 -- debug flags
 DBGFLAGS = "-g -ggdb3"
 
+-- build benchmarks (benchmark/) instead of functional tests (test/) - set CONFIG_BENCHMARK=y in tup.config
+BENCHMARK = tup.getconfig("BENCHMARK") == "y"
+
 ------------------------------------------------------------------------------------------------------------------------
 -- compilation flags
 ------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief BenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BenchmarkCase::run() const
+{
+	return run_();
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
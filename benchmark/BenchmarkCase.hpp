@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief BenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_BENCHMARKCASE_HPP_
+#define BENCHMARK_BENCHMARKCASE_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief BenchmarkCase class is an interface class for benchmarks
+ *
+ * \note This class deliberately has neither public virtual destructor nor protected non-virtual destructor - this way
+ * objects derived from this class may be ROMable. These objects should not be deleted via pointer of BenchmarkCase
+ * type.
+ */
+
+class BenchmarkCase
+{
+public:
+
+	/**
+	 * \brief Public function to start the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	bool run() const;
+
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * Results are recorded with reportResult().
+	 *
+	 * \note this should be provided by derived classes
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const = 0;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARKCASE_HPP_
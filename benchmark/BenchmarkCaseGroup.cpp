@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief BenchmarkCaseGroup class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BenchmarkCaseGroup::run_() const
+{
+	for (auto& benchmarkCase : range_)
+		if (benchmarkCase.get().run() == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief BenchmarkCaseGroup class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_BENCHMARKCASEGROUP_HPP_
+#define BENCHMARK_BENCHMARKCASEGROUP_HPP_
+
+#include "BenchmarkCase.hpp"
+
+#include "distortos/estd/ContiguousRange.hpp"
+#include "distortos/estd/ReferenceHolder.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/// BenchmarkCaseGroup class is a group of BenchmarkCase objects
+class BenchmarkCaseGroup : public BenchmarkCase
+{
+public:
+
+	/// range of references to BenchmarkCase objects
+	using Range = estd::ContiguousRange<const estd::ReferenceHolder<const BenchmarkCase>>;
+
+	/**
+	 * \brief BenchmarkCaseGroup's constructor
+	 *
+	 * \param [in] range is a range of references to BenchmarkCase objects
+	 */
+
+	constexpr explicit BenchmarkCaseGroup(const Range range) :
+			range_{range}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * Runs each benchmark from \a range_.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+
+	/// range of references to BenchmarkCase objects
+	Range range_;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARKCASEGROUP_HPP_
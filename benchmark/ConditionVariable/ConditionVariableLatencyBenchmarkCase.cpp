@@ -0,0 +1,104 @@
+/**
+ * \file
+ * \brief ConditionVariableLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "ConditionVariableLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/ConditionVariable.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Helper thread which waits for the condition variable in a loop and records latency of each notification.
+ *
+ * \param [in] conditionVariable is a reference to condition variable notified by main benchmark thread
+ * \param [in] mutex is a reference to mutex used with \a conditionVariable
+ * \param [in] timestamp is a reference to value of cycle counter saved by main benchmark thread just before the
+ * notification
+ * \param [in] stop is a reference to variable which is set to true by main benchmark thread to terminate this thread
+ * \param [out] latencyStatistics is a reference to LatencyStatistics object in which the results are collected
+ */
+
+void helperThread(ConditionVariable& conditionVariable, Mutex& mutex, const volatile uint32_t& timestamp,
+		const volatile bool& stop, LatencyStatistics& latencyStatistics)
+{
+	if (mutex.lock() != 0)
+		return;
+
+	while (conditionVariable.wait(mutex) == 0 && stop == false)
+		latencyStatistics.add(timestamp, architecture::getCycleCount());
+
+	mutex.unlock();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariableLatencyBenchmarkCase::run_() const
+{
+	ConditionVariable conditionVariable;
+	Mutex mutex;
+	volatile uint32_t timestamp {};
+	volatile bool stop {};
+	LatencyStatistics latencyStatistics;
+	auto helperThreadObject = makeStaticThread<helperThreadStackSize>(ThisThread::getPriority() + 1, helperThread,
+			std::ref(conditionVariable), std::ref(mutex), std::cref(timestamp), std::cref(stop),
+			std::ref(latencyStatistics));
+	if (helperThreadObject.start() != 0)
+		return false;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		timestamp = architecture::getCycleCount();
+		conditionVariable.notifyOne();
+	}
+
+	stop = true;
+	conditionVariable.notifyOne();
+	helperThreadObject.join();
+
+	return latencyStatistics.getCount() == latencyIterations &&
+			reportLatency("ConditionVariable notify-to-wake latency", latencyStatistics) == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
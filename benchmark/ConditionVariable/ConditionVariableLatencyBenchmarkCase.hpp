@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief ConditionVariableLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_CONDITIONVARIABLE_CONDITIONVARIABLELATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_CONDITIONVARIABLE_CONDITIONVARIABLELATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of condition variable.
+ *
+ * Main benchmark thread repeatedly notifies a condition variable on which a thread with higher priority waits. The time
+ * from the moment just before the notification to the moment the waiting thread returns from the wait (with the mutex
+ * locked) is recorded.
+ */
+
+class ConditionVariableLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CONDITIONVARIABLE_CONDITIONVARIABLELATENCYBENCHMARKCASE_HPP_
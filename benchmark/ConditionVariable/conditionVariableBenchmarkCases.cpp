@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief conditionVariableBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "conditionVariableBenchmarkCases.hpp"
+
+#include "ConditionVariableLatencyBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ConditionVariableLatencyBenchmarkCase instance
+const ConditionVariableLatencyBenchmarkCase latencyBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to condition variables
+const BenchmarkCaseGroup::Range::value_type conditionVariableBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{latencyBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup conditionVariableBenchmarkCases {BenchmarkCaseGroup::Range{conditionVariableBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
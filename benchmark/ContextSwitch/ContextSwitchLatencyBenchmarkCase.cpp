@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \brief ContextSwitchLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-02
+ */
+
+#include "ContextSwitchLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/distortosConfiguration.h"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {256};
+
+/// duration of single measurement
+constexpr auto measurementDuration = TickClock::duration{100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Helper thread which waits for the semaphore in a loop.
+ *
+ * \param [in] semaphore is a reference to semaphore posted by main benchmark thread
+ * \param [in] stop is a reference to variable which is set to true by main benchmark thread to terminate this thread
+ */
+
+void helperThread(Semaphore& semaphore, const volatile bool& stop)
+{
+	while (stop == false)
+		semaphore.wait();
+}
+
+/**
+ * \brief Measures latency of context switch.
+ *
+ * \return number of context switches done during \a measurementDuration, zero if any operation failed
+ */
+
+uint32_t measureLatency()
+{
+	Semaphore semaphore {0};
+	volatile bool stop {};
+	auto helperThreadObject = makeStaticThread<helperThreadStackSize>(ThisThread::getPriority() + 1, helperThread,
+			std::ref(semaphore), std::cref(stop));
+	if (helperThreadObject.start() != 0)
+		return 0;
+
+	waitForNextTick();
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto end = TickClock::now() + measurementDuration;
+	bool failed {};
+
+	while (failed == false && TickClock::now() < end)
+		failed = semaphore.post() != 0;	// helper thread is unblocked (switch) and waits again (switch back)
+
+	const auto count = statistics::getContextSwitchCount() - contextSwitchCount;
+
+	stop = true;
+	semaphore.post();
+	helperThreadObject.join();
+
+	return failed == false ? count : 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ContextSwitchLatencyBenchmarkCase::run_() const
+{
+	if (reportResult("fast memory placement", CONFIG_FAST_MEMORY_PLACEMENT) == false)
+		return false;
+
+	const auto count = measureLatency();
+	return count != 0 && reportResult("context switches", count) == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief ContextSwitchLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-02
+ */
+
+#ifndef BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHLATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHLATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of context switch.
+ *
+ * Main benchmark thread repeatedly posts a semaphore on which a thread with higher priority waits, so each post causes
+ * two context switches. The number of context switches which can be done during fixed number of ticks is recorded -
+ * higher is better. Placement of kernel's hot data and functions is selected with CONFIG_FAST_MEMORY_PLACEMENT, so
+ * both variants can be compared by building the benchmark with both configurations - the value of this option is
+ * also recorded.
+ */
+
+class ContextSwitchLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHLATENCYBENCHMARKCASE_HPP_
@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \brief ContextSwitchYieldBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "ContextSwitchYieldBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Helper thread which saves value of cycle counter and yields in a loop.
+ *
+ * \param [out] timestamp is a reference to variable in which value of cycle counter is saved just before the yield
+ * \param [in] stop is a reference to variable which is set to true by main benchmark thread to terminate this thread
+ */
+
+void helperThread(volatile uint32_t& timestamp, const volatile bool& stop)
+{
+	while (stop == false)
+	{
+		timestamp = architecture::getCycleCount();
+		ThisThread::yield();
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ContextSwitchYieldBenchmarkCase::run_() const
+{
+	volatile uint32_t timestamp {};
+	volatile bool stop {};
+	LatencyStatistics latencyStatistics;
+	auto helperThreadObject = makeStaticThread<helperThreadStackSize>(ThisThread::getPriority(), helperThread,
+			std::ref(timestamp), std::cref(stop));
+	if (helperThreadObject.start() != 0)
+		return false;
+
+	ThisThread::yield();	// let helper thread start
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		ThisThread::yield();	// helper thread saves timestamp and yields back
+		latencyStatistics.add(timestamp, architecture::getCycleCount());
+	}
+
+	stop = true;
+	helperThreadObject.join();
+
+	return reportLatency("yield context switch latency", latencyStatistics);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
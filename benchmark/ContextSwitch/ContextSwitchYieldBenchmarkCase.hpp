@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief ContextSwitchYieldBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHYIELDBENCHMARKCASE_HPP_
+#define BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHYIELDBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of context switch caused by yield.
+ *
+ * Main benchmark thread and a thread with the same priority repeatedly yield to each other. The time from the moment
+ * just before the yield in the helper thread to the moment when main benchmark thread is running again is recorded.
+ */
+
+class ContextSwitchYieldBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CONTEXTSWITCH_CONTEXTSWITCHYIELDBENCHMARKCASE_HPP_
@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief contextSwitchBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "contextSwitchBenchmarkCases.hpp"
+
+#include "ContextSwitchLatencyBenchmarkCase.hpp"
+#include "ContextSwitchYieldBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ContextSwitchLatencyBenchmarkCase instance
+const ContextSwitchLatencyBenchmarkCase latencyBenchmarkCase;
+
+/// ContextSwitchYieldBenchmarkCase instance
+const ContextSwitchYieldBenchmarkCase yieldBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to context switches
+const BenchmarkCaseGroup::Range::value_type contextSwitchBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{latencyBenchmarkCase},
+		BenchmarkCaseGroup::Range::value_type{yieldBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup contextSwitchBenchmarkCases {BenchmarkCaseGroup::Range{contextSwitchBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
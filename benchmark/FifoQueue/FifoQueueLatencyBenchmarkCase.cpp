@@ -0,0 +1,144 @@
+/**
+ * \file
+ * \brief FifoQueueLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "FifoQueueLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Type of elements in measured queues.
+ *
+ * \param ElementSize is the size of element, bytes
+ */
+
+template<size_t ElementSize>
+using TestType = std::array<uint8_t, ElementSize>;
+
+/// parameters of single measurement - function which does the measurement and names of results
+struct MeasurementParameters
+{
+	/// function which does the measurement
+	bool (&function)(const char*, const char*);
+
+	/// name of result for push
+	const char* pushName;
+
+	/// name of result for pop
+	const char* popName;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements in measured queues
+constexpr size_t queueSize {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures latency of push and pop of queue and records the results.
+ *
+ * \param Queue is the type of measured queue
+ * \param ElementSize is the size of element, bytes
+ *
+ * \param [in] pushName is the name of result for push
+ * \param [in] popName is the name of result for pop
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue, size_t ElementSize>
+bool measureAndReport(const char* const pushName, const char* const popName)
+{
+	Queue<TestType<ElementSize>, queueSize> queue;
+	LatencyStatistics pushStatistics;
+	LatencyStatistics popStatistics;
+	TestType<ElementSize> value {};
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto pushStart = architecture::getCycleCount();
+		const auto pushRet = queue.tryPush(value);
+		const auto pushEnd = architecture::getCycleCount();
+		const auto popStart = architecture::getCycleCount();
+		const auto popRet = queue.tryPop(value);
+		const auto popEnd = architecture::getCycleCount();
+		if (pushRet != 0 || popRet != 0)
+			return false;
+
+		pushStatistics.add(pushStart, pushEnd);
+		popStatistics.add(popStart, popEnd);
+	}
+
+	return reportLatency(pushName, pushStatistics) == true && reportLatency(popName, popStatistics) == true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of all measurements
+const MeasurementParameters measurementParameters[]
+{
+		{measureAndReport<StaticFifoQueue, 4>, "FifoQueue push, 4 bytes", "FifoQueue pop, 4 bytes"},
+		{measureAndReport<StaticFifoQueue, 16>, "FifoQueue push, 16 bytes", "FifoQueue pop, 16 bytes"},
+		{measureAndReport<StaticFifoQueue, 64>, "FifoQueue push, 64 bytes", "FifoQueue pop, 64 bytes"},
+		{measureAndReport<StaticFifoQueue, 256>, "FifoQueue push, 256 bytes", "FifoQueue pop, 256 bytes"},
+		{measureAndReport<StaticRawFifoQueue, 4>, "RawFifoQueue push, 4 bytes", "RawFifoQueue pop, 4 bytes"},
+		{measureAndReport<StaticRawFifoQueue, 16>, "RawFifoQueue push, 16 bytes", "RawFifoQueue pop, 16 bytes"},
+		{measureAndReport<StaticRawFifoQueue, 64>, "RawFifoQueue push, 64 bytes", "RawFifoQueue pop, 64 bytes"},
+		{measureAndReport<StaticRawFifoQueue, 256>, "RawFifoQueue push, 256 bytes", "RawFifoQueue pop, 256 bytes"},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueLatencyBenchmarkCase::run_() const
+{
+	for (const auto& parameters : measurementParameters)
+		if (parameters.function(parameters.pushName, parameters.popName) == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
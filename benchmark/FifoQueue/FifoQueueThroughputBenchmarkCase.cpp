@@ -0,0 +1,134 @@
+/**
+ * \file
+ * \brief FifoQueueThroughputBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "FifoQueueThroughputBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticRawMpscFifoQueue.hpp"
+#include "distortos/StaticRawSpscFifoQueue.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements in measured queues
+using TestType = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements in measured queues
+constexpr size_t queueSize {16};
+
+/// number of elements pushed (and then popped) in one batch
+constexpr size_t batchSize {queueSize};
+
+/// duration of single measurement
+constexpr auto measurementDuration = TickClock::duration{100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures throughput of queue.
+ *
+ * \param Queue is the type of measured queue
+ *
+ * \param [in] queue is a reference to measured queue, must be empty
+ *
+ * \return number of elements pushed to and popped from \a queue during \a measurementDuration, zero if any operation
+ * failed
+ */
+
+template<typename Queue>
+uint32_t measureThroughput(Queue& queue)
+{
+	uint32_t count {};
+
+	waitForNextTick();
+	const auto end = TickClock::now() + measurementDuration;
+
+	while (TickClock::now() < end)
+	{
+		for (size_t i = 0; i < batchSize; ++i)
+			if (queue.tryPush(static_cast<TestType>(count + i)) != 0)
+				return 0;
+
+		for (size_t i = 0; i < batchSize; ++i)
+		{
+			TestType value;
+			if (queue.tryPop(value) != 0 || value != count + i)
+				return 0;
+		}
+
+		count += batchSize;
+	}
+
+	return count;
+}
+
+/**
+ * \brief Measures throughput of queue and records the result.
+ *
+ * \param Queue is the type of measured queue
+ *
+ * \param [in] name is the name of result
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool measureAndReport(const char* const name)
+{
+	Queue queue;
+	const auto count = measureThroughput(queue);
+	return count != 0 && reportResult(name, count) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueThroughputBenchmarkCase::run_() const
+{
+	if (measureAndReport<StaticRawFifoQueue<TestType, queueSize>>("RawFifoQueue throughput") == false)
+		return false;
+
+	if (measureAndReport<StaticRawSpscFifoQueue<TestType, queueSize>>("RawSpscFifoQueue throughput") == false)
+		return false;
+
+	if (measureAndReport<StaticRawMpscFifoQueue<TestType, queueSize>>("RawMpscFifoQueue throughput") == false)
+		return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief FifoQueueThroughputBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_FIFOQUEUE_FIFOQUEUETHROUGHPUTBENCHMARKCASE_HPP_
+#define BENCHMARK_FIFOQUEUE_FIFOQUEUETHROUGHPUTBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures throughput of RawFifoQueue, RawSpscFifoQueue and RawMpscFifoQueue.
+ *
+ * For each queue the number of elements which can be pushed and then popped (in batches) during fixed number of ticks
+ * is recorded - higher is better.
+ */
+
+class FifoQueueThroughputBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_FIFOQUEUE_FIFOQUEUETHROUGHPUTBENCHMARKCASE_HPP_
@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief fifoQueueBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "fifoQueueBenchmarkCases.hpp"
+
+#include "FifoQueueLatencyBenchmarkCase.hpp"
+#include "FifoQueueThroughputBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// FifoQueueLatencyBenchmarkCase instance
+const FifoQueueLatencyBenchmarkCase latencyBenchmarkCase;
+
+/// FifoQueueThroughputBenchmarkCase instance
+const FifoQueueThroughputBenchmarkCase throughputBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to FIFO queues
+const BenchmarkCaseGroup::Range::value_type fifoQueueBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{latencyBenchmarkCase},
+		BenchmarkCaseGroup::Range::value_type{throughputBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup fifoQueueBenchmarkCases {BenchmarkCaseGroup::Range{fifoQueueBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
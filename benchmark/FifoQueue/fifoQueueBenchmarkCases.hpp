@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief fifoQueueBenchmarkCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_FIFOQUEUE_FIFOQUEUEBENCHMARKCASES_HPP_
+#define BENCHMARK_FIFOQUEUE_FIFOQUEUEBENCHMARKCASES_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+class BenchmarkCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of benchmarks related to FIFO queues
+extern const BenchmarkCaseGroup fifoQueueBenchmarkCases;
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_FIFOQUEUE_FIFOQUEUEBENCHMARKCASES_HPP_
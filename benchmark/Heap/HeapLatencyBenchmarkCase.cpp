@@ -0,0 +1,186 @@
+/**
+ * \file
+ * \brief HeapLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "HeapLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/allocators/TlsfHeap.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <type_traits>
+
+#include <cstdlib>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of blocks that may be allocated at the same time
+constexpr size_t slotCount {32};
+
+/// max size of single allocated block, bytes
+constexpr size_t maxBlockSize {256};
+
+/// size of storage for standalone TlsfHeap, bytes - enough for all blocks even in worst case
+constexpr size_t tlsfHeapSize {slotCount * (maxBlockSize + 32) * 2};
+
+#if CONFIG_TLSF_HEAP == 1
+
+/// name of result with latency of malloc()
+constexpr char mallocLatencyName[] {"malloc() latency, TLSF heap"};
+
+/// name of result with latency of free()
+constexpr char freeLatencyName[] {"free() latency, TLSF heap"};
+
+#elif CONFIG_NEWLIB == 1
+
+/// name of result with latency of malloc()
+constexpr char mallocLatencyName[] {"malloc() latency, newlib"};
+
+/// name of result with latency of free()
+constexpr char freeLatencyName[] {"free() latency, newlib"};
+
+#else	// CONFIG_TLSF_HEAP != 1 && CONFIG_NEWLIB != 1
+
+/// name of result with latency of malloc()
+constexpr char mallocLatencyName[] {"malloc() latency, host C library"};
+
+/// name of result with latency of free()
+constexpr char freeLatencyName[] {"free() latency, host C library"};
+
+#endif	// CONFIG_TLSF_HEAP != 1 && CONFIG_NEWLIB != 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for standalone TlsfHeap
+std::aligned_storage<tlsfHeapSize, allocators::TlsfHeap::alignment>::type tlsfHeapStorage;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures latency of allocator.
+ *
+ * In each of \a latencyIterations steps one pseudo-randomly selected slot is deallocated (if it is used) and allocated
+ * again with pseudo-random size - the sequence of sizes is the same for all allocators. Duration of each call is
+ * recorded separately. All blocks are deallocated at the end.
+ *
+ * \param Allocate is the type of functor used for allocation - void*(size_t)
+ * \param Deallocate is the type of functor used for deallocation - void(void*)
+ *
+ * \param [in] allocate is the functor used for allocation
+ * \param [in] deallocate is the functor used for deallocation
+ * \param [out] allocateStatistics is a reference to LatencyStatistics object in which latencies of allocations are
+ * collected
+ * \param [out] deallocateStatistics is a reference to LatencyStatistics object in which latencies of deallocations are
+ * collected
+ *
+ * \return true if measurement succeeded, false if any allocation failed
+ */
+
+template<typename Allocate, typename Deallocate>
+bool measureLatency(Allocate allocate, Deallocate deallocate, LatencyStatistics& allocateStatistics,
+		LatencyStatistics& deallocateStatistics)
+{
+	void* slots[slotCount] {};
+	uint32_t random {1};
+	bool failed {};
+
+	for (size_t i = 0; failed == false && i < latencyIterations; ++i)
+	{
+		random = random * 1664525 + 1013904223;	// linear congruential generator from "Numerical Recipes"
+		auto& slot = slots[(random >> 8) % slotCount];
+		if (slot != nullptr)
+		{
+			const auto start = architecture::getCycleCount();
+			deallocate(slot);
+			deallocateStatistics.add(start, architecture::getCycleCount());
+		}
+
+		const auto size = (random >> 16) % maxBlockSize + 1;
+		const auto start = architecture::getCycleCount();
+		slot = allocate(size);
+		allocateStatistics.add(start, architecture::getCycleCount());
+		failed = slot == nullptr;
+	}
+
+	for (const auto slot : slots)
+		deallocate(slot);
+
+	return failed == false;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool HeapLatencyBenchmarkCase::run_() const
+{
+	{
+		LatencyStatistics allocateStatistics;
+		LatencyStatistics deallocateStatistics;
+		if (measureLatency(malloc, free, allocateStatistics, deallocateStatistics) == false ||
+				reportLatency(mallocLatencyName, allocateStatistics) == false ||
+				reportLatency(freeLatencyName, deallocateStatistics) == false)
+			return false;
+	}
+
+	{
+		allocators::TlsfHeap tlsfHeap {&tlsfHeapStorage, sizeof(tlsfHeapStorage)};
+		LatencyStatistics allocateStatistics;
+		LatencyStatistics deallocateStatistics;
+		const auto ret = measureLatency(
+				[&tlsfHeap](const size_t size)
+				{
+					return tlsfHeap.allocate(size);
+				},
+				[&tlsfHeap](void* const storage)
+				{
+					tlsfHeap.deallocate(storage);
+				},
+				allocateStatistics, deallocateStatistics);
+		if (ret == false || reportLatency("TlsfHeap::allocate() latency", allocateStatistics) == false ||
+				reportLatency("TlsfHeap::deallocate() latency", deallocateStatistics) == false)
+			return false;
+
+		const auto statistics = tlsfHeap.getStatistics();
+		if (statistics.usedBlocks != 0 ||
+				reportResult("TlsfHeap min free size", statistics.minimumFreeSize) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
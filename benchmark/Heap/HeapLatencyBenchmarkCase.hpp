@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief HeapLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef BENCHMARK_HEAP_HEAPLATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_HEAP_HEAPLATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of malloc()/free() and of standalone TlsfHeap.
+ *
+ * For each allocator the same sequence of allocations and deallocations of pseudo-random sizes is executed and the
+ * duration of each call is measured in cycles - minimum, average and maximum are recorded, so the worst case is
+ * visible. malloc() uses TLSF heap if CONFIG_TLSF_HEAP == 1 or newlib's allocator otherwise (the name of result
+ * identifies which one was measured), so newlib's allocator can be compared with TLSF heap in a build with
+ * CONFIG_TLSF_HEAP set to 0 - either with malloc() from a build with CONFIG_TLSF_HEAP == 1 or with standalone TlsfHeap
+ * measured in the same build. Fragmentation of standalone TlsfHeap after the measurement is also recorded.
+ */
+
+class HeapLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_HEAP_HEAPLATENCYBENCHMARKCASE_HPP_
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief LatencyStatistics class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "LatencyStatistics.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void LatencyStatistics::add(const uint32_t start, const uint32_t end)
+{
+	const auto latency = end - start;	// correct also when cycle counter wrapped around
+	sum_ += latency;
+	++count_;
+	if (latency > maximum_)
+		maximum_ = latency;
+	if (latency < minimum_)
+		minimum_ = latency;
+}
+
+uint32_t LatencyStatistics::getAverage() const
+{
+	return count_ != 0 ? sum_ / count_ : 0;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \brief LatencyStatistics class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_LATENCYSTATISTICS_HPP_
+#define BENCHMARK_LATENCYSTATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of iterations of each latency measurement
+constexpr size_t latencyIterations {1000};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief LatencyStatistics class collects minimum, average and maximum of measured latencies.
+ *
+ * Latencies are measured in cycles of architecture::getCycleCount().
+ */
+
+class LatencyStatistics
+{
+public:
+
+	/**
+	 * \brief LatencyStatistics's constructor
+	 */
+
+	constexpr LatencyStatistics() :
+			sum_{},
+			count_{},
+			maximum_{},
+			minimum_{UINT32_MAX}
+	{
+
+	}
+
+	/**
+	 * \brief Adds one measured latency.
+	 *
+	 * \param [in] start is the value of cycle counter at the beginning of measured operation
+	 * \param [in] end is the value of cycle counter at the end of measured operation
+	 */
+
+	void add(uint32_t start, uint32_t end);
+
+	/**
+	 * \return average of all added latencies, zero if none was added
+	 */
+
+	uint32_t getAverage() const;
+
+	/**
+	 * \return number of added latencies
+	 */
+
+	uint32_t getCount() const
+	{
+		return count_;
+	}
+
+	/**
+	 * \return maximum of all added latencies, zero if none was added
+	 */
+
+	uint32_t getMaximum() const
+	{
+		return maximum_;
+	}
+
+	/**
+	 * \return minimum of all added latencies, zero if none was added
+	 */
+
+	uint32_t getMinimum() const
+	{
+		return count_ != 0 ? minimum_ : 0;
+	}
+
+private:
+
+	/// sum of all added latencies
+	uint64_t sum_;
+
+	/// number of added latencies
+	uint32_t count_;
+
+	/// maximum of all added latencies
+	uint32_t maximum_;
+
+	/// minimum of all added latencies
+	uint32_t minimum_;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_LATENCYSTATISTICS_HPP_
@@ -0,0 +1,148 @@
+/**
+ * \file
+ * \brief MessageQueueLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "MessageQueueLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Type of elements in measured queues.
+ *
+ * \param ElementSize is the size of element, bytes
+ */
+
+template<size_t ElementSize>
+using TestType = std::array<uint8_t, ElementSize>;
+
+/// parameters of single measurement - function which does the measurement and names of results
+struct MeasurementParameters
+{
+	/// function which does the measurement
+	bool (&function)(const char*, const char*);
+
+	/// name of result for push
+	const char* pushName;
+
+	/// name of result for pop
+	const char* popName;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements in measured queues
+constexpr size_t queueSize {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures latency of push and pop of queue and records the results.
+ *
+ * \param Queue is the type of measured queue
+ * \param ElementSize is the size of element, bytes
+ *
+ * \param [in] pushName is the name of result for push
+ * \param [in] popName is the name of result for pop
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue, size_t ElementSize>
+bool measureAndReport(const char* const pushName, const char* const popName)
+{
+	Queue<TestType<ElementSize>, queueSize> queue;
+	LatencyStatistics pushStatistics;
+	LatencyStatistics popStatistics;
+	TestType<ElementSize> value {};
+	uint8_t priority;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto pushStart = architecture::getCycleCount();
+		const auto pushRet = queue.tryPush(0, value);
+		const auto pushEnd = architecture::getCycleCount();
+		const auto popStart = architecture::getCycleCount();
+		const auto popRet = queue.tryPop(priority, value);
+		const auto popEnd = architecture::getCycleCount();
+		if (pushRet != 0 || popRet != 0)
+			return false;
+
+		pushStatistics.add(pushStart, pushEnd);
+		popStatistics.add(popStart, popEnd);
+	}
+
+	return reportLatency(pushName, pushStatistics) == true && reportLatency(popName, popStatistics) == true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of all measurements
+const MeasurementParameters measurementParameters[]
+{
+		{measureAndReport<StaticMessageQueue, 4>, "MessageQueue push, 4 bytes", "MessageQueue pop, 4 bytes"},
+		{measureAndReport<StaticMessageQueue, 16>, "MessageQueue push, 16 bytes", "MessageQueue pop, 16 bytes"},
+		{measureAndReport<StaticMessageQueue, 64>, "MessageQueue push, 64 bytes", "MessageQueue pop, 64 bytes"},
+		{measureAndReport<StaticMessageQueue, 256>, "MessageQueue push, 256 bytes", "MessageQueue pop, 256 bytes"},
+		{measureAndReport<StaticRawMessageQueue, 4>, "RawMessageQueue push, 4 bytes", "RawMessageQueue pop, 4 bytes"},
+		{measureAndReport<StaticRawMessageQueue, 16>, "RawMessageQueue push, 16 bytes",
+				"RawMessageQueue pop, 16 bytes"},
+		{measureAndReport<StaticRawMessageQueue, 64>, "RawMessageQueue push, 64 bytes",
+				"RawMessageQueue pop, 64 bytes"},
+		{measureAndReport<StaticRawMessageQueue, 256>, "RawMessageQueue push, 256 bytes",
+				"RawMessageQueue pop, 256 bytes"},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MessageQueueLatencyBenchmarkCase::run_() const
+{
+	for (const auto& parameters : measurementParameters)
+		if (parameters.function(parameters.pushName, parameters.popName) == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
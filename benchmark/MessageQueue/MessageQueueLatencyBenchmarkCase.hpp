@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief MessageQueueLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUELATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUELATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of MessageQueue and RawMessageQueue.
+ *
+ * For each queue latency of non-blocking push and pop is measured separately for elements of a few different sizes.
+ */
+
+class MessageQueueLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUELATENCYBENCHMARKCASE_HPP_
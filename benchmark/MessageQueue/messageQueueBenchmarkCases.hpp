@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief messageQueueBenchmarkCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUEBENCHMARKCASES_HPP_
+#define BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUEBENCHMARKCASES_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+class BenchmarkCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of benchmarks related to message queues
+extern const BenchmarkCaseGroup messageQueueBenchmarkCases;
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MESSAGEQUEUE_MESSAGEQUEUEBENCHMARKCASES_HPP_
@@ -0,0 +1,148 @@
+/**
+ * \file
+ * \brief MutexConvoyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-16
+ */
+
+#include "MutexConvoyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/Mutex.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for convoy thread, bytes
+constexpr size_t convoyThreadStackSize {512};
+
+/// number of threads sharing the mutex
+constexpr size_t convoyThreads {3};
+
+/// number of times each thread locks the mutex
+constexpr uint32_t convoyIterations {100};
+
+/// number of iterations of busy loop which simulates work of thread in critical section
+constexpr uint32_t workIterations {100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+void convoyThread(Mutex& mutex);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of convoy thread
+using ConvoyThread = decltype(makeStaticThread<convoyThreadStackSize>({}, convoyThread,
+		std::ref(std::declval<Mutex&>())));
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Convoy thread.
+ *
+ * Locks the mutex, does some work and unlocks the mutex - in a loop.
+ *
+ * \param [in] mutex is a reference to shared mutex
+ */
+
+void convoyThread(Mutex& mutex)
+{
+	for (uint32_t i = 0; i < convoyIterations; ++i)
+	{
+		mutex.lock();
+		for (volatile uint32_t j {}; j < workIterations; ++j);
+		mutex.unlock();
+	}
+}
+
+/**
+ * \brief Runs the workload and records the results.
+ *
+ * \param [in] unlockMode is the unlock mode of shared mutex
+ * \param [in] contextSwitchesName is the name of result for number of context switches
+ * \param [in] durationName is the name of result for duration of workload
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+bool measureAndReport(const Mutex::UnlockMode unlockMode, const char* const contextSwitchesName,
+		const char* const durationName)
+{
+	const auto priority = ThisThread::getPriority();
+	Mutex mutex {Mutex::Type::Normal, Mutex::Protocol::None, {}, unlockMode};
+	std::array<ConvoyThread, convoyThreads> threads
+	{{
+			makeStaticThread<convoyThreadStackSize>(priority + 1, convoyThread, std::ref(mutex)),
+			makeStaticThread<convoyThreadStackSize>(priority + 1, convoyThread, std::ref(mutex)),
+			makeStaticThread<convoyThreadStackSize>(priority + 1, convoyThread, std::ref(mutex)),
+	}};
+
+	if (mutex.lock() != 0)
+		return false;
+
+	// each started thread preempts this thread and blocks on the mutex
+	for (auto& thread : threads)
+		if (thread.start() != 0)
+			return false;
+
+	const auto contextSwitchCountStart = statistics::getContextSwitchCount();
+	const auto start = architecture::getCycleCount();
+	mutex.unlock();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	const auto duration = architecture::getCycleCount() - start;
+	const auto contextSwitchCount = statistics::getContextSwitchCount() - contextSwitchCountStart;
+
+	return reportResult(contextSwitchesName, contextSwitchCount) == true &&
+			reportResult(durationName, duration) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexConvoyBenchmarkCase::run_() const
+{
+	return measureAndReport(Mutex::UnlockMode::Handoff, "convoy context switches, handoff",
+			"convoy duration, handoff") == true &&
+			measureAndReport(Mutex::UnlockMode::Barging, "convoy context switches, barging",
+			"convoy duration, barging") == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
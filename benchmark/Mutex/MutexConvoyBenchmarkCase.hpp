@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief MutexConvoyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-16
+ */
+
+#ifndef BENCHMARK_MUTEX_MUTEXCONVOYBENCHMARKCASE_HPP_
+#define BENCHMARK_MUTEX_MUTEXCONVOYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures "lock convoy" with UnlockMode::Handoff and UnlockMode::Barging of mutex.
+ *
+ * Three threads with equal priority share a mutex - each thread locks the mutex, does some work, unlocks the mutex and
+ * immediately locks it again - in a loop. The workload starts when all threads are blocked on the mutex. With
+ * UnlockMode::Handoff each unlock() transfers the ownership to the next blocked thread, so the next lock() of the
+ * unlocking thread blocks and each iteration causes a context switch - this is a "lock convoy". With
+ * UnlockMode::Barging the unlocking thread locks the mutex again without blocking and context switches are done only
+ * when the threads are unblocked or when their time slice ends. Number of context switches and duration of whole
+ * workload (in cycles of architecture::getCycleCount()) are recorded for both modes - lower is better.
+ */
+
+class MutexConvoyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MUTEX_MUTEXCONVOYBENCHMARKCASE_HPP_
@@ -0,0 +1,301 @@
+/**
+ * \file
+ * \brief MutexLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-05
+ */
+
+#include "MutexLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/BasicMutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of single measurement of uncontended lock - type of mutex, protocol of mutex and name of result
+struct UncontendedParameters
+{
+	/// type of mutex
+	Mutex::Type type;
+
+	/// protocol of mutex
+	Mutex::Protocol protocol;
+
+	/// name of result
+	const char* name;
+};
+
+/// parameters of single measurement of contended lock - protocol of mutex and name of result
+struct ContendedParameters
+{
+	/// protocol of mutex
+	Mutex::Protocol protocol;
+
+	/// name of result
+	const char* name;
+};
+
+/// parameters of single measurement of uncontended lock of BasicMutex - measuring function and name of result
+struct BasicUncontendedParameters
+{
+	/// function which measures latency of uncontended lock and reports it with given name
+	bool (&function)(const char* name);
+
+	/// name of result
+	const char* name;
+};
+
+/// parameters of single report of size of mutex - size and name of result
+struct SizeParameters
+{
+	/// size of mutex, bytes
+	size_t size;
+
+	/// name of result
+	const char* name;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+bool measureBasicUncontended(const char* name);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/// parameters of all measurements of uncontended lock
+const UncontendedParameters uncontendedParameters[]
+{
+		{Mutex::Type::Normal, Mutex::Protocol::None, "Mutex lock, Normal, None"},
+		{Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance, "Mutex lock, Normal, PriorityInheritance"},
+		{Mutex::Type::Normal, Mutex::Protocol::PriorityProtect, "Mutex lock, Normal, PriorityProtect"},
+		{Mutex::Type::ErrorChecking, Mutex::Protocol::None, "Mutex lock, ErrorChecking, None"},
+		{Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityInheritance,
+				"Mutex lock, ErrorChecking, PriorityInheritance"},
+		{Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityProtect, "Mutex lock, ErrorChecking, PriorityProtect"},
+		{Mutex::Type::Recursive, Mutex::Protocol::None, "Mutex lock, Recursive, None"},
+		{Mutex::Type::Recursive, Mutex::Protocol::PriorityInheritance, "Mutex lock, Recursive, PriorityInheritance"},
+		{Mutex::Type::Recursive, Mutex::Protocol::PriorityProtect, "Mutex lock, Recursive, PriorityProtect"},
+};
+
+/// parameters of all measurements of uncontended lock of BasicMutex
+const BasicUncontendedParameters basicUncontendedParameters[]
+{
+		{measureBasicUncontended<Mutex::Type::Normal, Mutex::Protocol::None>, "BasicMutex lock, Normal, None"},
+		{measureBasicUncontended<Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance>,
+				"BasicMutex lock, Normal, PriorityInheritance"},
+		{measureBasicUncontended<Mutex::Type::Normal, Mutex::Protocol::PriorityProtect>,
+				"BasicMutex lock, Normal, PriorityProtect"},
+		{measureBasicUncontended<Mutex::Type::ErrorChecking, Mutex::Protocol::None>,
+				"BasicMutex lock, ErrorChecking, None"},
+		{measureBasicUncontended<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityInheritance>,
+				"BasicMutex lock, ErrorChecking, PriorityInheritance"},
+		{measureBasicUncontended<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityProtect>,
+				"BasicMutex lock, ErrorChecking, PriorityProtect"},
+		{measureBasicUncontended<Mutex::Type::Recursive, Mutex::Protocol::None>, "BasicMutex lock, Recursive, None"},
+		{measureBasicUncontended<Mutex::Type::Recursive, Mutex::Protocol::PriorityInheritance>,
+				"BasicMutex lock, Recursive, PriorityInheritance"},
+		{measureBasicUncontended<Mutex::Type::Recursive, Mutex::Protocol::PriorityProtect>,
+				"BasicMutex lock, Recursive, PriorityProtect"},
+};
+
+/// sizes of Mutex and selected BasicMutex variants
+const SizeParameters sizeParameters[]
+{
+		{sizeof(Mutex), "sizeof(Mutex), bytes"},
+		{sizeof(BasicMutex<Mutex::Type::Normal, Mutex::Protocol::None>), "sizeof(BasicMutex<Normal, None>), bytes"},
+		{sizeof(BasicMutex<Mutex::Type::Recursive, Mutex::Protocol::None>),
+				"sizeof(BasicMutex<Recursive, None>), bytes"},
+		{sizeof(BasicMutex<Mutex::Type::Normal, Mutex::Protocol::PriorityProtect>),
+				"sizeof(BasicMutex<Normal, PriorityProtect>), bytes"},
+};
+
+/// parameters of all measurements of contended lock
+const ContendedParameters contendedParameters[]
+{
+		{Mutex::Protocol::None, "Mutex unlock-to-acquire latency, None"},
+		{Mutex::Protocol::PriorityInheritance, "Mutex unlock-to-acquire latency, PriorityInheritance"},
+		{Mutex::Protocol::PriorityProtect, "Mutex unlock-to-acquire latency, PriorityProtect"},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Helper thread which - after each post of the semaphore - locks the mutex and records latency of this
+ * operation.
+ *
+ * \param [in] semaphore is a reference to semaphore posted by main benchmark thread
+ * \param [in] mutex is a reference to mutex locked by main benchmark thread
+ * \param [in] timestamp is a reference to value of cycle counter saved by main benchmark thread just before the mutex
+ * is unlocked
+ * \param [in] stop is a reference to variable which is set to true by main benchmark thread to terminate this thread
+ * \param [out] latencyStatistics is a reference to LatencyStatistics object in which the results are collected
+ */
+
+void helperThread(Semaphore& semaphore, Mutex& mutex, const volatile uint32_t& timestamp, const volatile bool& stop,
+		LatencyStatistics& latencyStatistics)
+{
+	while (semaphore.wait() == 0 && stop == false && mutex.lock() == 0)
+	{
+		latencyStatistics.add(timestamp, architecture::getCycleCount());
+		mutex.unlock();
+	}
+}
+
+/**
+ * \brief Measures latency of uncontended lock.
+ *
+ * \param [in] parameters is a reference to parameters of measurement
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+bool measureUncontended(const UncontendedParameters& parameters)
+{
+	Mutex mutex {parameters.type, parameters.protocol, ThisThread::getPriority()};
+	LatencyStatistics latencyStatistics;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto start = architecture::getCycleCount();
+		const auto ret = mutex.lock();
+		const auto end = architecture::getCycleCount();
+		if (ret != 0 || mutex.unlock() != 0)
+			return false;
+		latencyStatistics.add(start, end);
+	}
+
+	return reportLatency(parameters.name, latencyStatistics);
+}
+
+/**
+ * \brief Measures latency of uncontended lock of BasicMutex.
+ *
+ * \param MutexType is the type of mutex
+ * \param MutexProtocol is the mutex protocol
+ *
+ * \param [in] name is the name of result
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+bool measureBasicUncontended(const char* const name)
+{
+	BasicMutex<MutexType, MutexProtocol> mutex {ThisThread::getPriority()};
+	LatencyStatistics latencyStatistics;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto start = architecture::getCycleCount();
+		const auto ret = mutex.lock();
+		const auto end = architecture::getCycleCount();
+		if (ret != 0 || mutex.unlock() != 0)
+			return false;
+		latencyStatistics.add(start, end);
+	}
+
+	return reportLatency(name, latencyStatistics);
+}
+
+/**
+ * \brief Measures latency from unlock to acquisition of mutex by a thread with higher priority.
+ *
+ * \param [in] parameters is a reference to parameters of measurement
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+bool measureContended(const ContendedParameters& parameters)
+{
+	const auto helperPriority = ThisThread::getPriority() + 1;
+	Semaphore semaphore {0};
+	Mutex mutex {Mutex::Type::Normal, parameters.protocol, static_cast<uint8_t>(helperPriority)};
+	volatile uint32_t timestamp {};
+	volatile bool stop {};
+	LatencyStatistics latencyStatistics;
+	auto helperThreadObject = makeStaticThread<helperThreadStackSize>(helperPriority, helperThread,
+			std::ref(semaphore), std::ref(mutex), std::cref(timestamp), std::cref(stop), std::ref(latencyStatistics));
+	if (helperThreadObject.start() != 0)
+		return false;
+
+	bool failed {};
+	for (size_t i = 0; failed == false && i < latencyIterations; ++i)
+	{
+		// with Protocol::PriorityProtect helper thread is not able to preempt main benchmark thread here, so it will
+		// try to lock the mutex just after it is unlocked
+		failed = mutex.lock() != 0 || semaphore.post() != 0;
+		timestamp = architecture::getCycleCount();
+		mutex.unlock();
+	}
+
+	stop = true;
+	semaphore.post();
+	helperThreadObject.join();
+
+	return failed == false && latencyStatistics.getCount() == latencyIterations &&
+			reportLatency(parameters.name, latencyStatistics) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexLatencyBenchmarkCase::run_() const
+{
+	for (const auto& parameters : uncontendedParameters)
+		if (measureUncontended(parameters) == false)
+			return false;
+
+	for (const auto& parameters : basicUncontendedParameters)
+		if (parameters.function(parameters.name) == false)
+			return false;
+
+	for (const auto& parameters : sizeParameters)
+		if (reportResult(parameters.name, parameters.size) == false)
+			return false;
+
+	for (const auto& parameters : contendedParameters)
+		if (measureContended(parameters) == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
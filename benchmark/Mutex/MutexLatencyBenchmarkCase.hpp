@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief MutexLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_MUTEX_MUTEXLATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_MUTEX_MUTEXLATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of mutex.
+ *
+ * Latency of uncontended lock is measured for each type and each protocol of mutex. Additionally for each protocol the
+ * time from unlock by main benchmark thread to the moment when a thread with higher priority (which was blocked on the
+ * mutex) acquires the mutex is measured.
+ */
+
+class MutexLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MUTEX_MUTEXLATENCYBENCHMARKCASE_HPP_
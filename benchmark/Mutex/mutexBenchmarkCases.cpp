@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief mutexBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-16
+ */
+
+#include "mutexBenchmarkCases.hpp"
+
+#include "MutexLatencyBenchmarkCase.hpp"
+#include "MutexConvoyBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// MutexLatencyBenchmarkCase instance
+const MutexLatencyBenchmarkCase latencyBenchmarkCase;
+
+/// MutexConvoyBenchmarkCase instance
+const MutexConvoyBenchmarkCase convoyBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to mutexes
+const BenchmarkCaseGroup::Range::value_type mutexBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{latencyBenchmarkCase},
+		BenchmarkCaseGroup::Range::value_type{convoyBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup mutexBenchmarkCases {BenchmarkCaseGroup::Range{mutexBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \brief SemaphoreLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "SemaphoreLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Helper thread which waits for the semaphore in a loop and records latency of each unblocking.
+ *
+ * \param [in] semaphore is a reference to semaphore posted by main benchmark thread
+ * \param [in] timestamp is a reference to value of cycle counter saved by main benchmark thread just before the post
+ * \param [in] stop is a reference to variable which is set to true by main benchmark thread to terminate this thread
+ * \param [out] latencyStatistics is a reference to LatencyStatistics object in which the results are collected
+ */
+
+void helperThread(Semaphore& semaphore, const volatile uint32_t& timestamp, const volatile bool& stop,
+		LatencyStatistics& latencyStatistics)
+{
+	while (semaphore.wait() == 0 && stop == false)
+		latencyStatistics.add(timestamp, architecture::getCycleCount());
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SemaphoreLatencyBenchmarkCase::run_() const
+{
+	Semaphore semaphore {0};
+	volatile uint32_t timestamp {};
+	volatile bool stop {};
+	LatencyStatistics latencyStatistics;
+	auto helperThreadObject = makeStaticThread<helperThreadStackSize>(ThisThread::getPriority() + 1, helperThread,
+			std::ref(semaphore), std::cref(timestamp), std::cref(stop), std::ref(latencyStatistics));
+	if (helperThreadObject.start() != 0)
+		return false;
+
+	bool failed {};
+	for (size_t i = 0; failed == false && i < latencyIterations; ++i)
+	{
+		timestamp = architecture::getCycleCount();
+		failed = semaphore.post() != 0;
+	}
+
+	stop = true;
+	semaphore.post();
+	helperThreadObject.join();
+
+	return failed == false && latencyStatistics.getCount() == latencyIterations &&
+			reportLatency("Semaphore post-to-wake latency", latencyStatistics) == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SemaphoreLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_SEMAPHORE_SEMAPHORELATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_SEMAPHORE_SEMAPHORELATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of semaphore.
+ *
+ * Main benchmark thread repeatedly posts a semaphore on which a thread with higher priority waits. The time from the
+ * moment just before the post to the moment the waiting thread is unblocked and running is recorded.
+ */
+
+class SemaphoreLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SEMAPHORE_SEMAPHORELATENCYBENCHMARKCASE_HPP_
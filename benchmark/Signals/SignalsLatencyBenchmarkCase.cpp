@@ -0,0 +1,112 @@
+/**
+ * \file
+ * \brief SignalsLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "SignalsLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThisThread-Signals.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {1024};
+
+/// signal number used in the benchmark
+constexpr uint8_t signalNumber {0};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// value of cycle counter saved just before the signal is generated
+volatile uint32_t timestamp;
+
+/// pointer to LatencyStatistics object in which the results are collected
+LatencyStatistics* latencyStatisticsPointer;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Signal handler which records latency of signal delivery.
+ */
+
+void handler(const SignalInformation&)
+{
+	latencyStatisticsPointer->add(timestamp, architecture::getCycleCount());
+}
+
+/**
+ * \brief Test thread which generates the signal for itself in a loop.
+ *
+ * \param [out] failed is a reference to variable which is set to true if any operation failed
+ */
+
+void testThreadFunction(bool& failed)
+{
+	if (ThisThread::Signals::setSignalAction(signalNumber, {handler, SignalSet{SignalSet::empty}}).first != 0)
+	{
+		failed = true;
+		return;
+	}
+
+	for (size_t i = 0; failed == false && i < latencyIterations; ++i)
+	{
+		timestamp = architecture::getCycleCount();
+		failed = ThisThread::Signals::generateSignal(signalNumber) != 0;
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SignalsLatencyBenchmarkCase::run_() const
+{
+	LatencyStatistics latencyStatistics;
+	latencyStatisticsPointer = &latencyStatistics;
+	bool failed {};
+	auto testThread = makeStaticThread<testThreadStackSize, true, 0, 1>(ThisThread::getPriority() + 1,
+			testThreadFunction, std::ref(failed));
+	if (testThread.start() != 0)
+		return false;
+
+	testThread.join();
+
+	return failed == false && latencyStatistics.getCount() == latencyIterations &&
+			reportLatency("signal generate-to-handler latency", latencyStatistics) == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
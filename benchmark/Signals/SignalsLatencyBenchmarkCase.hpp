@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SignalsLatencyBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_SIGNALS_SIGNALSLATENCYBENCHMARKCASE_HPP_
+#define BENCHMARK_SIGNALS_SIGNALSLATENCYBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of signals.
+ *
+ * Test thread repeatedly generates signal for itself. The time from the moment just before the signal is generated to
+ * the moment when the signal handler is executed is recorded.
+ */
+
+class SignalsLatencyBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SIGNALS_SIGNALSLATENCYBENCHMARKCASE_HPP_
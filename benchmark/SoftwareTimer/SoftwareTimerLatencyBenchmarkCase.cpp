@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief SoftwareTimerLatencyBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "SoftwareTimerLatencyBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/SoftwareTimerBase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// software timer with empty function
+class EmptySoftwareTimer : public SoftwareTimerBase
+{
+private:
+
+	/**
+	 * \brief Does nothing.
+	 */
+
+	virtual void execute_() const override
+	{
+
+	}
+};
+
+/// parameters of single measurement - number of armed timers and names of results
+struct MeasurementParameters
+{
+	/// number of armed timers
+	size_t armedTimers;
+
+	/// name of result for start
+	const char* startName;
+
+	/// name of result for stop
+	const char* stopName;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// maximum number of armed timers
+constexpr size_t maxArmedTimers {32};
+
+/// duration after which armed timers expire - long enough to never expire during the benchmark
+constexpr auto armedTimersDuration = TickClock::duration{1000000};
+
+/// parameters of all measurements
+const MeasurementParameters measurementParameters[]
+{
+		{0, "SoftwareTimer start, 0 armed timers", "SoftwareTimer stop, 0 armed timers"},
+		{8, "SoftwareTimer start, 8 armed timers", "SoftwareTimer stop, 8 armed timers"},
+		{maxArmedTimers, "SoftwareTimer start, 32 armed timers", "SoftwareTimer stop, 32 armed timers"},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// timers armed during measurement
+EmptySoftwareTimer armedTimers[maxArmedTimers];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures latency of start and stop of software timer and records the results.
+ *
+ * Measured timer is started with duration longer than duration of all armed timers, so it is inserted at the end of
+ * the list of active software timers.
+ *
+ * \param [in] parameters is a reference to parameters of measurement
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+bool measureAndReport(const MeasurementParameters& parameters)
+{
+	for (size_t i = 0; i < parameters.armedTimers; ++i)
+		armedTimers[i].start(armedTimersDuration);
+
+	EmptySoftwareTimer softwareTimer;
+	LatencyStatistics startStatistics;
+	LatencyStatistics stopStatistics;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto startStart = architecture::getCycleCount();
+		softwareTimer.start(armedTimersDuration * 2);
+		const auto startEnd = architecture::getCycleCount();
+		const auto stopStart = architecture::getCycleCount();
+		softwareTimer.stop();
+		const auto stopEnd = architecture::getCycleCount();
+
+		startStatistics.add(startStart, startEnd);
+		stopStatistics.add(stopStart, stopEnd);
+	}
+
+	for (size_t i = 0; i < parameters.armedTimers; ++i)
+		armedTimers[i].stop();
+
+	return reportLatency(parameters.startName, startStatistics) == true &&
+			reportLatency(parameters.stopName, stopStatistics) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerLatencyBenchmarkCase::run_() const
+{
+	for (const auto& parameters : measurementParameters)
+		if (measureAndReport(parameters) == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
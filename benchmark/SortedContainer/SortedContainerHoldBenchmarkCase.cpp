@@ -0,0 +1,220 @@
+/**
+ * \file
+ * \brief SortedContainerHoldBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#include "SortedContainerHoldBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+#include "LatencyStatistics.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/containers/SortedContainer.hpp"
+#include "distortos/containers/SortedPairingHeap.hpp"
+#include "distortos/containers/SortedSkipList.hpp"
+
+#include <forward_list>
+#include <list>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// element kept in tested containers
+struct Element
+{
+	/**
+	 * \brief Element's constructor
+	 *
+	 * \param [in] keyValue is the key used for sorting
+	 * \param [in] sequenceValue is the sequence number of element, used to verify FIFO order of equal keys
+	 */
+
+	constexpr Element(const uint32_t keyValue, const uint32_t sequenceValue) :
+			key{keyValue},
+			sequence{sequenceValue}
+	{
+
+	}
+
+	/// key used for sorting
+	uint32_t key;
+
+	/// sequence number of element, used to verify FIFO order of equal keys
+	uint32_t sequence;
+};
+
+/// functor which gives ascending order of keys
+struct ElementAscendingKey
+{
+	/**
+	 * \brief ElementAscendingKey's function call operator
+	 *
+	 * \param [in] left is the object on the left side of comparison
+	 * \param [in] right is the object on the right side of comparison
+	 *
+	 * \return true if left's key is greater than right's key
+	 */
+
+	bool operator()(const Element& left, const Element& right) const
+	{
+		return left.key > right.key;
+	}
+};
+
+/// parameters of single measurement - number of elements and names of results for each backend
+struct MeasurementParameters
+{
+	/// number of elements in the container
+	size_t size;
+
+	/// name of result for SortedContainer with std::list
+	const char* listName;
+
+	/// name of result for SortedContainer with std::forward_list
+	const char* forwardListName;
+
+	/// name of result for SortedSkipList
+	const char* skipListName;
+
+	/// name of result for SortedPairingHeap
+	const char* pairingHeapName;
+};
+
+/// SortedContainer with std::list
+using List = containers::SortedContainer<std::list<Element>, ElementAscendingKey>;
+
+/// SortedContainer with std::forward_list
+using ForwardList = containers::SortedContainer<std::forward_list<Element>, ElementAscendingKey>;
+
+/// SortedSkipList
+using SkipList = containers::SortedSkipList<Element, ElementAscendingKey>;
+
+/// SortedPairingHeap
+using PairingHeap = containers::SortedPairingHeap<Element, ElementAscendingKey>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of all measurements
+const MeasurementParameters measurementParameters[]
+{
+		{1, "SortedContainer<list> hold, 1 element", "SortedContainer<forward_list> hold, 1 element",
+				"SortedSkipList hold, 1 element", "SortedPairingHeap hold, 1 element"},
+		{4, "SortedContainer<list> hold, 4 elements", "SortedContainer<forward_list> hold, 4 elements",
+				"SortedSkipList hold, 4 elements", "SortedPairingHeap hold, 4 elements"},
+		{16, "SortedContainer<list> hold, 16 elements", "SortedContainer<forward_list> hold, 16 elements",
+				"SortedSkipList hold, 16 elements", "SortedPairingHeap hold, 16 elements"},
+		{64, "SortedContainer<list> hold, 64 elements", "SortedContainer<forward_list> hold, 64 elements",
+				"SortedSkipList hold, 64 elements", "SortedPairingHeap hold, 64 elements"},
+		{256, "SortedContainer<list> hold, 256 elements", "SortedContainer<forward_list> hold, 256 elements",
+				"SortedSkipList hold, 256 elements", "SortedPairingHeap hold, 256 elements"},
+		{1024, "SortedContainer<list> hold, 1024 elements", "SortedContainer<forward_list> hold, 1024 elements",
+				"SortedSkipList hold, 1024 elements", "SortedPairingHeap hold, 1024 elements"},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Generates next pseudo-random value.
+ *
+ * \param [in,out] random is a reference to state of generator
+ *
+ * \return next pseudo-random value
+ */
+
+uint32_t getNextRandom(uint32_t& random)
+{
+	random = random * 1664525 + 1013904223;	// linear congruential generator from "Numerical Recipes"
+	return random >> 8;
+}
+
+/**
+ * \brief Measures latency of "hold" operation of sorted container and records the result.
+ *
+ * \param Container is the type of tested container
+ *
+ * \param [in] size is the number of elements in the container
+ * \param [in] name is the name of result
+ *
+ * \return true if measurement succeeded and order of elements was correct, false otherwise
+ */
+
+template<typename Container>
+bool measureAndReport(const size_t size, const char* const name)
+{
+	Container container;
+	uint32_t random {1};
+	uint32_t sequence {};
+
+	for (size_t i = 0; i < size; ++i)
+		container.sortedEmplace(getNextRandom(random) % size, sequence++);
+
+	LatencyStatistics latencyStatistics;
+
+	for (size_t i = 0; i < latencyIterations; ++i)
+	{
+		const auto key = container.begin()->key + getNextRandom(random) % size;
+		const auto start = architecture::getCycleCount();
+		container.pop_front();
+		container.sortedEmplace(key, sequence++);
+		const auto end = architecture::getCycleCount();
+		latencyStatistics.add(start, end);
+	}
+
+	auto previous = *container.begin();
+	container.pop_front();
+	while (container.empty() == false)
+	{
+		const auto& current = *container.begin();
+		if (current.key < previous.key || (current.key == previous.key && current.sequence < previous.sequence))
+			return false;
+		previous = current;
+		container.pop_front();
+	}
+
+	return reportLatency(name, latencyStatistics);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SortedContainerHoldBenchmarkCase::run_() const
+{
+	for (const auto& parameters : measurementParameters)
+		if (measureAndReport<List>(parameters.size, parameters.listName) == false ||
+				measureAndReport<ForwardList>(parameters.size, parameters.forwardListName) == false ||
+				measureAndReport<SkipList>(parameters.size, parameters.skipListName) == false ||
+				measureAndReport<PairingHeap>(parameters.size, parameters.pairingHeapName) == false)
+			return false;
+
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
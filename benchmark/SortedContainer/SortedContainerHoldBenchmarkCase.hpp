@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief SortedContainerHoldBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#ifndef BENCHMARK_SORTEDCONTAINER_SORTEDCONTAINERHOLDBENCHMARKCASE_HPP_
+#define BENCHMARK_SORTEDCONTAINER_SORTEDCONTAINERHOLDBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Compares backends of sorted containers with "hold" operations.
+ *
+ * SortedContainer with std::list and with std::forward_list, SortedSkipList and SortedPairingHeap are filled with
+ * 1 to 1024 elements with pseudo-random keys. Then latency of "hold" operation - removal of first element and sorted
+ * emplace of element with key greater by pseudo-random amount, just like in list of software timers or in wait queue
+ * with pseudo-random priorities - is measured. FIFO order of elements with equal keys is verified when the container
+ * is drained. The benchmark uses only the containers, so it gives meaningful results also when built for host with
+ * ARCHITECTURE=Linux.
+ */
+
+class SortedContainerHoldBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SORTEDCONTAINER_SORTEDCONTAINERHOLDBENCHMARKCASE_HPP_
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief sortedContainerBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#include "sortedContainerBenchmarkCases.hpp"
+
+#include "SortedContainerHoldBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SortedContainerHoldBenchmarkCase instance
+const SortedContainerHoldBenchmarkCase holdBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to sorted containers
+const BenchmarkCaseGroup::Range::value_type sortedContainerBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{holdBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup sortedContainerBenchmarkCases {BenchmarkCaseGroup::Range{sortedContainerBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,83 @@
+/**
+ * \file
+ * \brief ThreadFootprintBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-09
+ */
+
+#include "ThreadFootprintBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of measured threads, bytes
+constexpr size_t threadStackSize {256};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by measured threads - never actually called.
+ */
+
+void threadFunction()
+{
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of thread with thread-specific _reent structure
+using OwnReentThread = decltype(makeStaticThread<threadStackSize>({}, threadFunction));
+
+/// type of thread sharing global _reent structure
+using SharedReentThread = decltype(makeStaticThread<threadStackSize, false, 0, 0, true>({}, threadFunction));
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadFootprintBenchmarkCase::run_() const
+{
+	if (reportResult("ThreadControlBlock size", sizeof(scheduler::ThreadControlBlock)) == false)
+		return false;
+
+#if CONFIG_NEWLIB == 1
+
+	if (reportResult("_reent size", sizeof(_reent)) == false)
+		return false;
+
+#endif	// CONFIG_NEWLIB == 1
+
+	return reportResult("StaticThread size, own _reent", sizeof(OwnReentThread)) == true &&
+			reportResult("StaticThread size, shared _reent", sizeof(SharedReentThread)) == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
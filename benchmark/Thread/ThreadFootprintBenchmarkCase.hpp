@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief ThreadFootprintBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-09
+ */
+
+#ifndef BENCHMARK_THREAD_THREADFOOTPRINTBENCHMARKCASE_HPP_
+#define BENCHMARK_THREAD_THREADFOOTPRINTBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Reports RAM footprint of thread objects.
+ *
+ * Sizes (in bytes) of ThreadControlBlock, of newlib's _reent structure and of identical StaticThread objects with
+ * thread-specific and with shared _reent structure are recorded - lower is better. The difference between both
+ * StaticThread objects is the per-thread cost of reentrancy support.
+ */
+
+class ThreadFootprintBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_THREAD_THREADFOOTPRINTBENCHMARKCASE_HPP_
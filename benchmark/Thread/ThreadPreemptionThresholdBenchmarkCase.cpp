@@ -0,0 +1,165 @@
+/**
+ * \file
+ * \brief ThreadPreemptionThresholdBenchmarkCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-15
+ */
+
+#include "ThreadPreemptionThresholdBenchmarkCase.hpp"
+
+#include "benchmarkResults.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for ring thread, bytes
+constexpr size_t ringThreadStackSize {512};
+
+/// number of threads in the ring
+constexpr size_t ringThreads {4};
+
+/// number of times each thread gets the token
+constexpr uint32_t ringIterations {100};
+
+/// number of iterations of busy loop which simulates work of thread
+constexpr uint32_t workIterations {100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ringThread(Semaphore& semaphore, Semaphore& nextSemaphore);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of ring thread
+using RingThread = decltype(makeStaticThread<ringThreadStackSize>({}, ringThread,
+		std::ref(std::declval<Semaphore&>()), std::ref(std::declval<Semaphore&>())));
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Simulates work of thread with busy loop.
+ */
+
+void work()
+{
+	for (volatile uint32_t i {}; i < workIterations; ++i);
+}
+
+/**
+ * \brief Ring thread.
+ *
+ * Waits for the token, does some work, passes the token to next thread and does some more work - in a loop.
+ *
+ * \param [in] semaphore is a reference to semaphore of this thread
+ * \param [in] nextSemaphore is a reference to semaphore of next thread in the ring
+ */
+
+void ringThread(Semaphore& semaphore, Semaphore& nextSemaphore)
+{
+	for (uint32_t i = 0; i < ringIterations; ++i)
+	{
+		semaphore.wait();
+		work();
+		nextSemaphore.post();
+		work();
+	}
+}
+
+/**
+ * \brief Runs the workload and records the results.
+ *
+ * \param [in] preemptionThreshold selects whether all threads get preemption threshold equal to the highest priority
+ * in the ring (true) or not (false)
+ * \param [in] contextSwitchesName is the name of result for number of context switches
+ * \param [in] durationName is the name of result for duration of workload
+ *
+ * \return true if measurement succeeded, false otherwise
+ */
+
+bool measureAndReport(const bool preemptionThreshold, const char* const contextSwitchesName,
+		const char* const durationName)
+{
+	const auto priority = ThisThread::getPriority();
+	std::array<Semaphore, ringThreads> semaphores {{Semaphore{0}, Semaphore{0}, Semaphore{0}, Semaphore{0}}};
+	std::array<RingThread, ringThreads> threads
+	{{
+			makeStaticThread<ringThreadStackSize>(priority + 1, ringThread, std::ref(semaphores[0]),
+					std::ref(semaphores[1])),
+			makeStaticThread<ringThreadStackSize>(priority + 2, ringThread, std::ref(semaphores[1]),
+					std::ref(semaphores[2])),
+			makeStaticThread<ringThreadStackSize>(priority + 3, ringThread, std::ref(semaphores[2]),
+					std::ref(semaphores[3])),
+			makeStaticThread<ringThreadStackSize>(priority + 4, ringThread, std::ref(semaphores[3]),
+					std::ref(semaphores[0])),
+	}};
+
+	for (auto& thread : threads)
+	{
+		if (preemptionThreshold == true)
+			thread.setPreemptionThreshold(priority + ringThreads);
+		if (thread.start() != 0)
+			return false;
+	}
+
+	const auto contextSwitchCountStart = statistics::getContextSwitchCount();
+	const auto start = architecture::getCycleCount();
+	semaphores[0].post();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	const auto duration = architecture::getCycleCount() - start;
+	const auto contextSwitchCount = statistics::getContextSwitchCount() - contextSwitchCountStart;
+
+	return reportResult(contextSwitchesName, contextSwitchCount) == true &&
+			reportResult(durationName, duration) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPreemptionThresholdBenchmarkCase::run_() const
+{
+	return measureAndReport(false, "ring context switches, no preemption threshold",
+			"ring duration, no preemption threshold") == true &&
+			measureAndReport(true, "ring context switches, preemption threshold",
+			"ring duration, preemption threshold") == true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
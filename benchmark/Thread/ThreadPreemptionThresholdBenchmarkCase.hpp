@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief ThreadPreemptionThresholdBenchmarkCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-15
+ */
+
+#ifndef BENCHMARK_THREAD_THREADPREEMPTIONTHRESHOLDBENCHMARKCASE_HPP_
+#define BENCHMARK_THREAD_THREADPREEMPTIONTHRESHOLDBENCHMARKCASE_HPP_
+
+#include "BenchmarkCase.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures number of context switches with and without preemption threshold.
+ *
+ * Four threads with different priorities pass a token in a ring - each thread waits for its semaphore, does some work,
+ * posts semaphore of next thread and does some more work. Without preemption threshold, thread which posts semaphore
+ * of higher-priority thread is preempted in the middle of its work. When all threads have preemption threshold equal
+ * to the highest priority in the group, they don't preempt each other and context switch is done only when the thread
+ * waits for the token again. Number of context switches and duration of whole workload (in cycles of
+ * architecture::getCycleCount()) are recorded for both configurations - lower is better.
+ */
+
+class ThreadPreemptionThresholdBenchmarkCase : public BenchmarkCase
+{
+private:
+
+	/**
+	 * \brief Runs the benchmark.
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_THREAD_THREADPREEMPTIONTHRESHOLDBENCHMARKCASE_HPP_
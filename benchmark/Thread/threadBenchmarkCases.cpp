@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief threadBenchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-15
+ */
+
+#include "threadBenchmarkCases.hpp"
+
+#include "ThreadFootprintBenchmarkCase.hpp"
+#include "ThreadPreemptionThresholdBenchmarkCase.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ThreadFootprintBenchmarkCase instance
+const ThreadFootprintBenchmarkCase footprintBenchmarkCase;
+
+/// ThreadPreemptionThresholdBenchmarkCase instance
+const ThreadPreemptionThresholdBenchmarkCase preemptionThresholdBenchmarkCase;
+
+/// array with references to BenchmarkCase objects related to threads
+const BenchmarkCaseGroup::Range::value_type threadBenchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{footprintBenchmarkCase},
+		BenchmarkCaseGroup::Range::value_type{preemptionThresholdBenchmarkCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup threadBenchmarkCases {BenchmarkCaseGroup::Range{threadBenchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \brief benchmarkCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#include "benchmarkCases.hpp"
+
+#include "ConditionVariable/conditionVariableBenchmarkCases.hpp"
+#include "ContextSwitch/contextSwitchBenchmarkCases.hpp"
+#include "FifoQueue/fifoQueueBenchmarkCases.hpp"
+#include "Heap/heapBenchmarkCases.hpp"
+#include "MessageQueue/messageQueueBenchmarkCases.hpp"
+#include "Mutex/mutexBenchmarkCases.hpp"
+#include "Semaphore/semaphoreBenchmarkCases.hpp"
+#include "Signals/signalsBenchmarkCases.hpp"
+#include "SoftwareTimer/softwareTimerBenchmarkCases.hpp"
+#include "SortedContainer/sortedContainerBenchmarkCases.hpp"
+#include "Thread/threadBenchmarkCases.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with references to BenchmarkCase objects
+const BenchmarkCaseGroup::Range::value_type benchmarkCases_[]
+{
+		BenchmarkCaseGroup::Range::value_type{conditionVariableBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{contextSwitchBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{fifoQueueBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{heapBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{messageQueueBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{mutexBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{semaphoreBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{signalsBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{softwareTimerBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{sortedContainerBenchmarkCases},
+		BenchmarkCaseGroup::Range::value_type{threadBenchmarkCases},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkCaseGroup benchmarkCases {BenchmarkCaseGroup::Range{benchmarkCases_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief benchmarkResults object definition, reportResult() and reportLatency() implementations
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "benchmarkResults.hpp"
+
+#include "LatencyStatistics.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+volatile BenchmarkStatus benchmarkStatus {BenchmarkStatus::notStarted};
+
+BenchmarkResult benchmarkResults[maxBenchmarkResults];
+
+size_t benchmarkResultsCount;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool reportLatency(const char* const name, const LatencyStatistics& latencyStatistics)
+{
+	if (benchmarkResultsCount >= maxBenchmarkResults || latencyStatistics.getCount() == 0)
+		return false;
+
+	benchmarkResults[benchmarkResultsCount++] = {name, latencyStatistics.getAverage(), latencyStatistics.getMinimum(),
+			latencyStatistics.getMaximum()};
+	return true;
+}
+
+bool reportResult(const char* const name, const uint32_t value)
+{
+	if (benchmarkResultsCount >= maxBenchmarkResults)
+		return false;
+
+	benchmarkResults[benchmarkResultsCount++] = {name, value, value, value};
+	return true;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,111 @@
+/**
+ * \file
+ * \brief benchmarkResults object declaration, reportResult() and reportLatency() declarations
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef BENCHMARK_BENCHMARKRESULTS_HPP_
+#define BENCHMARK_BENCHMARKRESULTS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+class LatencyStatistics;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// status of benchmark application
+enum class BenchmarkStatus : uint8_t
+{
+	/// benchmarks were not started yet
+	notStarted,
+	/// benchmarks are running
+	running,
+	/// all benchmarks finished successfully
+	succeeded,
+	/// some benchmark failed
+	failed,
+};
+
+/// single result of benchmark
+struct BenchmarkResult
+{
+	/// name of measured value
+	const char* name;
+
+	/// measured value, average for latencies
+	uint32_t value;
+
+	/// minimum of measured values, equal to \a value if single value was measured
+	uint32_t minimum;
+
+	/// maximum of measured values, equal to \a value if single value was measured
+	uint32_t maximum;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of results that can be stored in \a benchmarkResults
+constexpr size_t maxBenchmarkResults {128};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// status of benchmark application, should be polled by debugger or simulator
+extern volatile BenchmarkStatus benchmarkStatus;
+
+/// results of all benchmarks, in the order in which they were reported
+extern BenchmarkResult benchmarkResults[maxBenchmarkResults];
+
+/// number of valid elements in \a benchmarkResults
+extern size_t benchmarkResultsCount;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Records result of benchmark.
+ *
+ * \param [in] name is the name of measured value, must point to string with static storage duration
+ * \param [in] value is the measured value
+ *
+ * \return true if result was recorded, false if \a benchmarkResults is full
+ */
+
+bool reportResult(const char* name, uint32_t value);
+
+/**
+ * \brief Records average, minimum and maximum of measured latencies.
+ *
+ * \param [in] name is the name of measured latency, must point to string with static storage duration
+ * \param [in] latencyStatistics is a reference to LatencyStatistics object with measured latencies, must not be empty
+ *
+ * \return true if result was recorded, false if \a benchmarkResults is full or \a latencyStatistics is empty
+ */
+
+bool reportLatency(const char* name, const LatencyStatistics& latencyStatistics);
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARKRESULTS_HPP_
@@ -0,0 +1,30 @@
+/**
+ * \file
+ * \brief Main code block.
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "mainBenchmarkThread.hpp"
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief main code block
+ */
+
+int main()
+{
+	distortos::benchmark::mainBenchmarkThread.start();
+	distortos::benchmark::mainBenchmarkThread.join();
+
+	return 0;
+}
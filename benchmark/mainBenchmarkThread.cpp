@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief mainBenchmarkThread object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "mainBenchmarkThread.hpp"
+
+#include "BenchmarkCaseGroup.hpp"
+#include "benchmarkCases.hpp"
+#include "benchmarkResults.hpp"
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void mainBenchmarkThreadFunction()
+{
+	benchmarkStatus = BenchmarkStatus::running;
+	const auto coreCycleCounter = architecture::enableCycleCounter();
+	const auto ret = reportResult("core cycle counter", coreCycleCounter) == true && benchmarkCases.run() == true;
+	benchmarkStatus = ret == true ? BenchmarkStatus::succeeded : BenchmarkStatus::failed;
+	while (1);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+MainBenchmarkThread mainBenchmarkThread = makeStaticThread<mainBenchmarkThreadStackSize>(mainBenchmarkThreadPriority,
+		mainBenchmarkThreadFunction);
+
+}	// namespace benchmark
+
+}	// namespace distortos
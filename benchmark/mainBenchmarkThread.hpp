@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief mainBenchmarkThread object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_MAINBENCHMARKTHREAD_HPP_
+#define BENCHMARK_MAINBENCHMARKTHREAD_HPP_
+
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+/// benchmark namespace - performance measurements
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Main benchmark thread function which runs all benchmarks.
+ */
+
+void mainBenchmarkThreadFunction();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// priority of main benchmark thread
+constexpr uint8_t mainBenchmarkThreadPriority {UINT8_MAX / 2};
+
+/// size of stack for main benchmark thread, bytes
+#ifdef _REENT_SMALL
+constexpr size_t mainBenchmarkThreadStackSize {4096};
+#else
+constexpr size_t mainBenchmarkThreadStackSize {8192};
+#endif	// def _REENT_SMALL
+
+/// type of main benchmark thread
+using MainBenchmarkThread = decltype(makeStaticThread<mainBenchmarkThreadStackSize>(mainBenchmarkThreadPriority,
+		mainBenchmarkThreadFunction));
+
+/// main benchmark thread object
+extern MainBenchmarkThread mainBenchmarkThread;
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MAINBENCHMARKTHREAD_HPP_
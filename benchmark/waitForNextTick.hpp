@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief waitForNextTick() declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef BENCHMARK_WAITFORNEXTTICK_HPP_
+#define BENCHMARK_WAITFORNEXTTICK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Waits for beginning of next tick.
+ */
+
+void waitForNextTick();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_WAITFORNEXTTICK_HPP_
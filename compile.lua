@@ -1,14 +1,21 @@
 --
 -- file: compile.lua
 --
--- author: Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+-- author: Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
 --
 -- This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 -- distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 --
--- date: 2014-07-21
+-- date: 2015-05-25
 --
 
+-- test/ and benchmark/ are separate applications (each has its own main()), only one of them is compiled
+local directory = tup.getrelativedir(TOP)
+if (BENCHMARK == true and directory:find("^test") ~= nil) or
+		(BENCHMARK == false and directory:find("^benchmark") ~= nil) then
+	return
+end
+
 for index, filename in ipairs(tup.glob('*.S')) do
 	as(filename)
 end
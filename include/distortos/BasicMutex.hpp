@@ -0,0 +1,280 @@
+/**
+ * \file
+ * \brief BasicMutex class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_BASICMUTEX_HPP_
+#define INCLUDE_DISTORTOS_BASICMUTEX_HPP_
+
+#include "distortos/Mutex.hpp"
+
+#include "distortos/synchronization/BasicMutexControlBlock.hpp"
+#include "distortos/synchronization/MutexRecursiveLocksCounter.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief BasicMutex is a variant of Mutex with type and protocol selected at compile time
+ *
+ * Behaves exactly like Mutex constructed with the same type and protocol, but the decisions depending on them are
+ * resolved during compilation. Only the code and storage required by given combination are generated - for example
+ * BasicMutex<Mutex::Type::Normal, Mutex::Protocol::None> contains no recursive locks counter, no priority ceiling and
+ * no node of list of mutexes owned by a thread.
+ *
+ * \param MutexType is the type of mutex
+ * \param MutexProtocol is the mutex protocol
+ */
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+class BasicMutex : private synchronization::MutexRecursiveLocksCounter<Mutex::RecursiveLocksCount,
+		MutexType == Mutex::Type::Recursive>
+{
+public:
+
+	/// mutex protocols
+	using Protocol = Mutex::Protocol;
+
+	/// type used for counting recursive locks
+	using RecursiveLocksCount = Mutex::RecursiveLocksCount;
+
+	/// type of mutex
+	using Type = Mutex::Type;
+
+	/**
+	 * \brief Gets the maximum number of recursive locks possible before returning EAGAIN
+	 *
+	 * \note Actual number of lock() operations possible is getMaxRecursiveLocks() + 1.
+	 *
+	 * \return maximum number of recursive locks possible before returning EAGAIN
+	 */
+
+	constexpr static RecursiveLocksCount getMaxRecursiveLocks()
+	{
+		return Mutex::getMaxRecursiveLocks();
+	}
+
+	/**
+	 * \brief BasicMutex constructor
+	 *
+	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when MutexProtocol != PriorityProtect,
+	 * default - 0
+	 */
+
+	explicit BasicMutex(const uint8_t priorityCeiling = {}) :
+			controlBlock_{priorityCeiling}
+	{
+
+	}
+
+	/**
+	 * \brief Locks the mutex.
+	 *
+	 * Similar to std::mutex::lock() - http://en.cppreference.com/w/cpp/thread/mutex/lock
+	 * Similar to pthread_mutex_lock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_mutex_lock.html#
+	 *
+	 * If the mutex is already locked by another thread, the calling thread shall block until the mutex becomes
+	 * available. This function shall return with the mutex in the locked state with the calling thread as its owner. If
+	 * a thread attempts to relock a mutex that it has already locked, deadlock occurs.
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 */
+
+	int lock();
+
+	/**
+	 * \brief Tries to lock the mutex.
+	 *
+	 * Similar to std::mutex::try_lock() - http://en.cppreference.com/w/cpp/thread/mutex/try_lock
+	 * Similar to pthread_mutex_trylock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_mutex_lock.html#
+	 *
+	 * This function shall be equivalent to lock(), except that if the mutex is currently locked (by any thread,
+	 * including the current thread), the call shall return immediately.
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EBUSY - the mutex could not be acquired because it was already locked;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 */
+
+	int tryLock();
+
+	/**
+	 * \brief Tries to lock the mutex for given duration of time.
+	 *
+	 * Similar to std::timed_mutex::try_lock_for() - http://en.cppreference.com/w/cpp/thread/timed_mutex/try_lock_for
+	 * Similar to pthread_mutex_timedlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_mutex_timedlock.html#
+	 *
+	 * If the mutex is already locked, the calling thread shall block until the mutex becomes available as in lock()
+	 * function. If the mutex cannot be locked without waiting for another thread to unlock the mutex, this wait shall
+	 * be terminated when the specified timeout expires.
+	 *
+	 * Under no circumstance shall the function fail with a timeout if the mutex can be locked immediately. The validity
+	 * of the duration parameter need not be checked if the mutex can be locked immediately.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockFor(TickClock::duration duration, TickClock::duration slack = {});
+
+	/**
+	 * Tries to lock the mutex for given duration of time.
+	 *
+	 * Template variant of tryLockFor(TickClock::duration duration, TickClock::duration slack).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
+	{
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration), slack);
+	}
+
+	/**
+	 * \brief Tries to lock the mutex until given time point.
+	 *
+	 * Similar to std::timed_mutex::try_lock_until() -
+	 * http://en.cppreference.com/w/cpp/thread/timed_mutex/try_lock_until
+	 * Similar to pthread_mutex_timedlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_mutex_timedlock.html#
+	 *
+	 * If the mutex is already locked, the calling thread shall block until the mutex becomes available as in lock()
+	 * function. If the mutex cannot be locked without waiting for another thread to unlock the mutex, this wait shall
+	 * be terminated when the specified timeout expires.
+	 *
+	 * Under no circumstance shall the function fail with a timeout if the mutex can be locked immediately. The validity
+	 * of the timePoint parameter need not be checked if the mutex can be locked immediately.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockUntil(TickClock::time_point timePoint, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to lock the mutex until given time point.
+	 *
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint, TickClock::duration slack).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const TickClock::duration slack = {})
+	{
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
+	}
+
+	/**
+	 * \brief Unlocks the mutex.
+	 *
+	 * Similar to std::mutex::unlock() - http://en.cppreference.com/w/cpp/thread/mutex/unlock
+	 * Similar to pthread_mutex_unlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_mutex_lock.html#
+	 *
+	 * The mutex must be locked by the current thread, otherwise, the behavior is undefined. If there are threads
+	 * blocked on this mutex, the highest priority waiting thread shall be unblocked, and if there is more than one
+	 * highest priority thread blocked waiting, then the highest priority thread that has been waiting the longest shall
+	 * be unblocked.
+	 *
+	 * \return zero if the caller successfully unlocked the mutex, error code otherwise:
+	 * - EPERM - MutexType is ErrorChecking or Recursive, and the current thread does not own the mutex;
+	 */
+
+	int unlock();
+
+private:
+
+	/**
+	 * \brief Internal version of tryLock().
+	 *
+	 * Internal version with no interrupt masking and additional code for ErrorChecking type (which is not required for
+	 * tryLock()).
+	 *
+	 * \return zero if the caller successfully locked the mutex, error code otherwise:
+	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
+	 * exceeded;
+	 * - EBUSY - the mutex could not be acquired because it was already locked;
+	 * - EDEADLK - MutexType is ErrorChecking and the current thread already owns the mutex;
+	 * - EINVAL - MutexProtocol is PriorityProtect and the calling thread's priority is higher than the mutex's current
+	 * priority ceiling;
+	 */
+
+	int tryLockInternal();
+
+	/// instance of control block
+	synchronization::BasicMutexControlBlock<MutexProtocol> controlBlock_;
+};
+
+/// BasicMutex with Type::Normal and Protocol::None
+using NormalMutex = BasicMutex<Mutex::Type::Normal, Mutex::Protocol::None>;
+
+/// BasicMutex with Type::Recursive and Protocol::None
+using RecursiveMutex = BasicMutex<Mutex::Type::Recursive, Mutex::Protocol::None>;
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_BASICMUTEX_HPP_
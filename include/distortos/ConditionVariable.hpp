@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-02-02
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_CONDITIONVARIABLE_HPP_
@@ -132,13 +132,15 @@ public:
 	 *
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] duration is the duration after which the wait for notification will be terminated
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
 	 * - ETIMEDOUT - no notification was received before the specified timeout expired;
 	 */
 
-	int waitFor(Mutex& mutex, TickClock::duration duration);
+	int waitFor(Mutex& mutex, TickClock::duration duration, TickClock::duration slack = {});
 
 	/**
 	 * \brief Waits for notification for given duration of time.
@@ -148,13 +150,15 @@ public:
 	 * Similar to pthread_cond_timedwait() -
 	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_timedwait.html#
 	 *
-	 * Template variant of waitFor(Mutex& mutex, TickClock::duration duration).
+	 * Template variant of waitFor(Mutex& mutex, TickClock::duration duration, TickClock::duration slack).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
 	 *
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] duration is the duration after which the wait for notification will be terminated
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
@@ -162,9 +166,9 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int waitFor(Mutex& mutex, const std::chrono::duration<Rep, Period> duration)
+	int waitFor(Mutex& mutex, const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
 	{
-		return waitFor(mutex, std::chrono::duration_cast<TickClock::duration>(duration));
+		return waitFor(mutex, std::chrono::duration_cast<TickClock::duration>(duration), slack);
 	}
 
 	/**
@@ -185,6 +189,8 @@ public:
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] duration is the duration after which the wait for notification will be terminated
 	 * \param [in] predicate is the predicate that will be checked
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
@@ -192,9 +198,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period, typename Predicate>
-	int waitFor(Mutex& mutex, const std::chrono::duration<Rep, Period> duration, Predicate predicate)
+	int waitFor(Mutex& mutex, const std::chrono::duration<Rep, Period> duration, Predicate predicate,
+			const TickClock::duration slack = {})
 	{
-		return waitUntil(mutex, TickClock::now() + duration + TickClock::duration{1}, std::move(predicate));
+		return waitUntil(mutex, TickClock::now() + duration + TickClock::duration{1}, std::move(predicate), slack);
 	}
 
 	/**
@@ -211,13 +218,15 @@ public:
 	 *
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] timePoint is the time point at which the wait for notification will be terminated
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
 	 * - ETIMEDOUT - no notification was received before the specified timeout expired;
 	 */
 
-	int waitUntil(Mutex& mutex, TickClock::time_point timePoint);
+	int waitUntil(Mutex& mutex, TickClock::time_point timePoint, TickClock::duration slack = {});
 
 	/**
 	 * \brief Waits for notification until given time point.
@@ -227,12 +236,14 @@ public:
 	 * Similar to pthread_cond_timedwait() -
 	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_timedwait.html#
 	 *
-	 * Template variant of waitUntil(Mutex& mutex, TickClock::time_point timePoint).
+	 * Template variant of waitUntil(Mutex& mutex, TickClock::time_point timePoint, TickClock::duration slack).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] timePoint is the time point at which the wait for notification will be terminated
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
@@ -240,9 +251,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int waitUntil(Mutex& mutex, const std::chrono::time_point<TickClock, Duration> timePoint)
+	int waitUntil(Mutex& mutex, const std::chrono::time_point<TickClock, Duration> timePoint,
+			const TickClock::duration slack = {})
 	{
-		return waitUntil(mutex, std::chrono::time_point_cast<TickClock::duration>(timePoint));
+		return waitUntil(mutex, std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
 	}
 
 	/**
@@ -262,6 +274,8 @@ public:
 	 * \param [in] mutex is a reference to mutex which must be owned by calling thread
 	 * \param [in] timePoint is the time point at which the wait for notification will be terminated
 	 * \param [in] predicate is the predicate that will be checked
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the wait was completed successfully, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
@@ -269,11 +283,12 @@ public:
 	 */
 
 	template<typename Duration, typename Predicate>
-	int waitUntil(Mutex& mutex, const std::chrono::time_point<TickClock, Duration> timePoint, Predicate predicate)
+	int waitUntil(Mutex& mutex, const std::chrono::time_point<TickClock, Duration> timePoint, Predicate predicate,
+			const TickClock::duration slack = {})
 	{
 		while (predicate() == false)
 		{
-			const auto ret = waitUntil(mutex, timePoint);
+			const auto ret = waitUntil(mutex, timePoint, slack);
 			if (ret != 0)
 				return ret;
 		}
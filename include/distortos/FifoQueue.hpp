@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
@@ -54,7 +54,7 @@ public:
 	 */
 
 	FifoQueue(Storage* const storage, const size_t maxElements) :
-			fifoQueueBase_{storage, storage + maxElements, sizeof(T), maxElements}
+			fifoQueueBase_{storage, sizeof(T), maxElements}
 	{
 
 	}
@@ -114,6 +114,28 @@ public:
 
 #endif	// DISTORTOS_FIFOQUEUE_EMPLACE_SUPPORTED == 1 || DOXYGEN == 1
 
+	/**
+	 * \return number of elements dropped by pushOverwriting() since the queue was constructed
+	 */
+
+	size_t getDroppedCount() const
+	{
+		return fifoQueueBase_.getDroppedCount();
+	}
+
+	/**
+	 * \brief Gets semaphore which is "ready" when the queue is not empty.
+	 *
+	 * Returned semaphore may be used only with WaitForAnySet, to wait for any of several queues to become non-empty.
+	 *
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return fifoQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -164,6 +186,44 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * This function never blocks and never fails because the queue is full, so it is suitable for producers (e.g.
+	 * interrupts handling sensor data) which must not wait for the consumer. Dropped element is destructed. If all
+	 * elements in the queue were already claimed by threads which are about to pop them, the new element is dropped
+	 * instead. Each dropped element increments the value returned by getDroppedCount().
+	 *
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed (possibly dropping the oldest one) or dropped, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwriting(const T& value)
+	{
+		const synchronization::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {value};
+		return pushOverwritingInternal(copyConstructQueueFunctor);
+	}
+
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Variant of pushOverwriting(const T&) which move-constructs the element.
+	 *
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed (possibly dropping the oldest one) or dropped, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwriting(T&& value)
+	{
+		const synchronization::MoveConstructQueueFunctor<T> moveConstructQueueFunctor {std::move(value)};
+		return pushOverwritingInternal(moveConstructQueueFunctor);
+	}
+
 #if DISTORTOS_FIFOQUEUE_EMPLACE_SUPPORTED == 1 || DOXYGEN == 1
 
 	/**
@@ -306,22 +366,24 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopFor(const TickClock::duration duration, T& value)
+	int tryPopFor(const TickClock::duration duration, T& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return popInternal(semaphoreTryWaitForFunctor, value);
 	}
 
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
 	 *
-	 * Template variant of tryPopFor(TickClock::duration, T&).
+	 * Template variant of tryPopFor(TickClock::duration, T&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -329,6 +391,8 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -336,9 +400,9 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& value)
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& value, const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value, slack);
 	}
 
 	/**
@@ -347,28 +411,32 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopUntil(const TickClock::time_point timePoint, T& value)
+	int tryPopUntil(const TickClock::time_point timePoint, T& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return popInternal(semaphoreTryWaitUntilFunctor, value);
 	}
 
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
-	 * Template variant of tryPopUntil(TickClock::time_point, T&).
+	 * Template variant of tryPopUntil(TickClock::time_point, T&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -376,9 +444,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& value)
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value, slack);
 	}
 
 	/**
@@ -419,28 +488,32 @@ public:
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(const TickClock::duration duration, const T& value)
+	int tryPushFor(const TickClock::duration duration, const T& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return pushInternal(semaphoreTryWaitForFunctor, value);
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, const T&).
+	 * Template variant of tryPushFor(TickClock::duration, const T&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -448,9 +521,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const T& value)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), value, slack);
 	}
 
 	/**
@@ -459,22 +533,24 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without pushing the element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(const TickClock::duration duration, T&& value)
+	int tryPushFor(const TickClock::duration duration, T&& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return pushInternal(semaphoreTryWaitForFunctor, std::move(value));
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, T&&).
+	 * Template variant of tryPushFor(TickClock::duration, T&&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -482,6 +558,8 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without pushing the element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -489,9 +567,9 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, T&& value)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, T&& value, const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value));
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value), slack);
 	}
 
 	/**
@@ -499,27 +577,31 @@ public:
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(const TickClock::time_point timePoint, const T& value)
+	int tryPushUntil(const TickClock::time_point timePoint, const T& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return pushInternal(semaphoreTryWaitUntilFunctor, value);
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, const T&).
+	 * Template variant of tryPushUntil(TickClock::time_point, const T&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -527,9 +609,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T& value)
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value, slack);
 	}
 
 	/**
@@ -538,28 +621,32 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(const TickClock::time_point timePoint, T&& value)
+	int tryPushUntil(const TickClock::time_point timePoint, T&& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return pushInternal(semaphoreTryWaitUntilFunctor, std::move(value));
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, T&&).
+	 * Template variant of tryPushUntil(TickClock::time_point, T&&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -567,9 +654,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T&& value)
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T&& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), std::move(value));
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), std::move(value), slack);
 	}
 
 private:
@@ -705,6 +793,19 @@ private:
 
 	int pushInternal(const synchronization::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * Internal version - builds the Functor object which destructs dropped element.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will construct the element in queue's storage
+	 *
+	 * \return zero if element was pushed (possibly dropping the oldest one) or dropped, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwritingInternal(const synchronization::QueueFunctor& functor);
+
 	/// contained synchronization::FifoQueueBase object which implements whole functionality
 	synchronization::FifoQueueBase fifoQueueBase_;
 };
@@ -746,6 +847,17 @@ int FifoQueue<T>::pushInternal(const synchronization::SemaphoreFunctor& waitSema
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+template<typename T>
+int FifoQueue<T>::pushOverwritingInternal(const synchronization::QueueFunctor& functor)
+{
+	const auto destroyFunctor = makeBoundedFunctor(
+			[](void* const storage)
+			{
+				reinterpret_cast<T*>(storage)->~T();
+			});
+	return fifoQueueBase_.pushOverwriting(&destroyFunctor, functor);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
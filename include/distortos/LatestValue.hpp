@@ -0,0 +1,311 @@
+/**
+ * \file
+ * \brief LatestValue class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_LATESTVALUE_HPP_
+#define INCLUDE_DISTORTOS_LATESTVALUE_HPP_
+
+#include "distortos/synchronization/LatestValueBase.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief LatestValue class is a "mailbox" which holds only the most recent value, with readers that never block the
+ * writers and never mask interrupts.
+ *
+ * LatestValue is useful for state (e.g. position or configuration) which is published by one part of the system and
+ * needed by many readers only in its freshest form. Unlike a queue it never gets full and old values are simply
+ * overwritten. Unlike a value guarded by Mutex the readers don't serialize each other and writers never block.
+ *
+ * Value is stored in two slots and the version of the value selects the one which is valid - this is a variant of
+ * "seqlock". Writer - which may be a thread or an interrupt - fills the slot which is not valid with interrupts masked
+ * and then increments the version, so the slot used by readers is never modified "in place". Reader gets the version,
+ * copies the selected slot and checks whether the version is still the same - if not, the copy may be torn and the
+ * read is retried. Reader which preempts the writer never retries - it gets the previous value - so the value may be
+ * read also from interrupts with priority higher than the one used for interrupt masking. Reader which is preempted by
+ * the writer retries at most once per write that happened in the meantime.
+ *
+ * Threads may also block until the value is updated with waitForUpdate() and its timed variants.
+ *
+ * \attention set() must not be called from interrupts with priority higher than the one used for interrupt masking.
+ *
+ * \param T is the type of value, should be trivially copyable and small, as each read and write copies the whole value
+ */
+
+template<typename T>
+class LatestValue
+{
+public:
+
+	/// type of value
+	using ValueType = T;
+
+	/**
+	 * \brief LatestValue's constructor
+	 *
+	 * \param [in] value is the initial value, default - value-initialized, version of initial value is 0
+	 */
+
+	explicit LatestValue(const T& value = {}) :
+			latestValueBase_{},
+			values_{value, value}
+	{
+
+	}
+
+	/**
+	 * \brief Reads the value.
+	 *
+	 * \note This function may be called from any context and it doesn't mask interrupts.
+	 *
+	 * \return consistent snapshot of current value
+	 */
+
+	T get() const
+	{
+		uint32_t version;
+		return get(version);
+	}
+
+	/**
+	 * \brief Reads the value and its version.
+	 *
+	 * \note This function may be called from any context and it doesn't mask interrupts.
+	 *
+	 * \param [out] version is a reference to variable into which the version of returned value will be written
+	 *
+	 * \return consistent snapshot of current value
+	 */
+
+	T get(uint32_t& version) const
+	{
+		while (1)
+		{
+			const auto currentVersion = latestValueBase_.getVersion();
+			const T value = values_[currentVersion % 2];
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (latestValueBase_.getVersion() == currentVersion)
+			{
+				version = currentVersion;
+				return value;
+			}
+		}
+	}
+
+	/**
+	 * \note This function may be called from any context and it doesn't mask interrupts.
+	 *
+	 * \return current version of the value, incremented by each set()
+	 */
+
+	uint32_t getVersion() const
+	{
+		return latestValueBase_.getVersion();
+	}
+
+	/**
+	 * \brief Writes the value.
+	 *
+	 * Copies the value with interrupts masked and unblocks all threads waiting for update. This function never blocks.
+	 *
+	 * \note This function may be called from thread or from interrupt.
+	 *
+	 * \param [in] value is the new value
+	 */
+
+	void set(const T& value)
+	{
+		const StoreFunctor storeFunctor {values_, value};
+		latestValueBase_.write(storeFunctor);
+	}
+
+	/**
+	 * \brief Tries to wait for update of the value for given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in,out] version is a reference to version of the value known to the caller, if the value was updated new
+	 * version is written to it
+	 * \param [out] value is a reference to object into which updated value will be written
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - ETIMEDOUT - the value was not updated before the specified timeout expired;
+	 */
+
+	int tryWaitForUpdateFor(const TickClock::duration duration, uint32_t& version, T& value,
+			const TickClock::duration slack = {})
+	{
+		return tryWaitForUpdateUntil(TickClock::now() + duration + TickClock::duration{1}, version, value, slack);
+	}
+
+	/**
+	 * \brief Tries to wait for update of the value for given duration of time.
+	 *
+	 * Template variant of tryWaitForUpdateFor(TickClock::duration duration, uint32_t& version, T& value,
+	 * TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in,out] version is a reference to version of the value known to the caller, if the value was updated new
+	 * version is written to it
+	 * \param [out] value is a reference to object into which updated value will be written
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - ETIMEDOUT - the value was not updated before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryWaitForUpdateFor(const std::chrono::duration<Rep, Period> duration, uint32_t& version, T& value,
+			const TickClock::duration slack = {})
+	{
+		return tryWaitForUpdateFor(std::chrono::duration_cast<TickClock::duration>(duration), version, value, slack);
+	}
+
+	/**
+	 * \brief Tries to wait for update of the value until given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in,out] version is a reference to version of the value known to the caller, if the value was updated new
+	 * version is written to it
+	 * \param [out] value is a reference to object into which updated value will be written
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - ETIMEDOUT - the value was not updated before the specified timeout expired;
+	 */
+
+	int tryWaitForUpdateUntil(const TickClock::time_point timePoint, uint32_t& version, T& value,
+			const TickClock::duration slack = {})
+	{
+		const auto ret = latestValueBase_.waitForUpdateUntil(version, timePoint, slack);
+		if (ret != 0)
+			return ret;
+
+		value = get(version);
+		return 0;
+	}
+
+	/**
+	 * \brief Tries to wait for update of the value until given time point.
+	 *
+	 * Template variant of tryWaitForUpdateUntil(TickClock::time_point timePoint, uint32_t& version, T& value,
+	 * TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in,out] version is a reference to version of the value known to the caller, if the value was updated new
+	 * version is written to it
+	 * \param [out] value is a reference to object into which updated value will be written
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - ETIMEDOUT - the value was not updated before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryWaitForUpdateUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint32_t& version, T& value,
+			const TickClock::duration slack = {})
+	{
+		return tryWaitForUpdateUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), version, value,
+				slack);
+	}
+
+	/**
+	 * \brief Waits for update of the value.
+	 *
+	 * If the current version of the value is different than \a version, this function returns immediately. Otherwise
+	 * the calling thread blocks until set() is called. Reading the value with get(uint32_t&) and then calling this
+	 * function in a loop gives every update to the thread - except the ones which were overwritten before the thread
+	 * was able to read them.
+	 *
+	 * \param [in,out] version is a reference to version of the value known to the caller, new version is written to it
+	 * \param [out] value is a reference to object into which updated value will be written
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	int waitForUpdate(uint32_t& version, T& value)
+	{
+		const auto ret = latestValueBase_.waitForUpdate(version);
+		if (ret != 0)
+			return ret;
+
+		value = get(version);
+		return 0;
+	}
+
+	LatestValue(const LatestValue&) = delete;
+	LatestValue(LatestValue&&) = delete;
+	const LatestValue& operator=(const LatestValue&) = delete;
+	LatestValue& operator=(LatestValue&&) = delete;
+
+private:
+
+	/// StoreFunctor is a functor which copies the value to the slot selected by new version
+	class StoreFunctor : public synchronization::LatestValueBase::WriteFunctor
+	{
+	public:
+
+		/**
+		 * \brief StoreFunctor's constructor
+		 *
+		 * \param [in] values is a reference to array with two slots for value
+		 * \param [in] value is a reference to the value which will be copied
+		 */
+
+		constexpr StoreFunctor(T (&values)[2], const T& value) :
+				values_(values),
+				value_(value)
+		{
+
+		}
+
+		/**
+		 * \brief Copies the value to the slot selected by new version.
+		 *
+		 * \param [in] version is the new version of the value
+		 */
+
+		void operator()(const uint32_t version) const override
+		{
+			values_[version % 2] = value_;
+		}
+
+	private:
+
+		/// reference to array with two slots for value
+		T (&values_)[2];
+
+		/// reference to the value which will be copied
+		const T& value_;
+	};
+
+	/// internal LatestValueBase object
+	synchronization::LatestValueBase latestValueBase_;
+
+	/// two slots for value, the one selected by version is valid
+	T values_[2];
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_LATESTVALUE_HPP_
@@ -0,0 +1,251 @@
+/**
+ * \file
+ * \brief MemoryPool class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/synchronization/SemaphoreFunctor.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief MemoryPool class is a pool of fixed-size memory blocks.
+ *
+ * Both allocation and deallocation are O(1) - free blocks are kept on an intrusive singly-linked list. If the pool is
+ * empty, allocating thread may block until some other thread or interrupt frees a block. Deallocation never blocks, so
+ * it may be used from interrupt context.
+ */
+
+class MemoryPool
+{
+public:
+
+	/**
+	 * \brief MemoryPool's constructor
+	 *
+	 * \param [in] storage is a memory block for pool's blocks, sufficiently large for \a blockCount blocks, each
+	 * \a blockSize bytes long
+	 * \param [in] blockSize is the size of single block, bytes - must be a multiple of alignment required for blocks and
+	 * must not be less than sizeof(void*)
+	 * \param [in] blockCount is the number of blocks in \a storage - if it is greater than max value of
+	 * Semaphore::Value, abort() is called
+	 */
+
+	MemoryPool(void* storage, size_t blockSize, size_t blockCount);
+
+	/**
+	 * \brief Allocates one block from the pool.
+	 *
+	 * If the pool is empty, the calling thread is blocked until a block is freed.
+	 *
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int allocate(void*& block);
+
+	/**
+	 * \return number of blocks in the pool
+	 */
+
+	size_t getBlockCount() const
+	{
+		return blockCount_;
+	}
+
+	/**
+	 * \return size of single block, bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return max number of blocks that were allocated at the same time since the pool was constructed
+	 */
+
+	size_t getHighWaterMark() const
+	{
+		return highWaterMark_;
+	}
+
+	/**
+	 * \return number of currently allocated blocks
+	 */
+
+	size_t getUsedBlocks() const
+	{
+		return usedBlocks_;
+	}
+
+	/**
+	 * \brief Frees block previously allocated from the pool.
+	 *
+	 * If any thread is blocked waiting for a block, the highest priority thread that has been waiting the longest is
+	 * unblocked and receives this block.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] block is a pointer to block that will be freed
+	 *
+	 * \return zero if block was freed successfully, error code otherwise:
+	 * - EINVAL - \a block doesn't belong to the pool or no block is currently allocated;
+	 */
+
+	int free(void* block);
+
+	/**
+	 * \brief Tries to allocate one block from the pool.
+	 *
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryAllocate(void*& block);
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryAllocateFor(TickClock::duration duration, void*& block, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * Template variant of tryAllocateFor(TickClock::duration, void*&, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryAllocateFor(const std::chrono::duration<Rep, Period> duration, void*& block,
+			const TickClock::duration slack = {})
+	{
+		return tryAllocateFor(std::chrono::duration_cast<TickClock::duration>(duration), block, slack);
+	}
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryAllocateUntil(TickClock::time_point timePoint, void*& block, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * Template variant of tryAllocateUntil(TickClock::time_point, void*&, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryAllocateUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& block,
+			const TickClock::duration slack = {})
+	{
+		return tryAllocateUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), block, slack);
+	}
+
+	MemoryPool(const MemoryPool&) = delete;
+	MemoryPool(MemoryPool&&) = delete;
+	const MemoryPool& operator=(const MemoryPool&) = delete;
+	MemoryPool& operator=(MemoryPool&&) = delete;
+
+private:
+
+	/// free block of the pool - the first bytes of free block hold a link to the next free block
+	struct FreeBlock
+	{
+		/// pointer to next free block, nullptr if this is the last free block
+		FreeBlock* next;
+	};
+
+	/**
+	 * \brief Implementation of allocate(), tryAllocate(), tryAllocateFor() and tryAllocateUntil() using type-erased
+	 * functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore_
+	 * \param [out] block is a reference to pointer that will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int allocateInternal(const synchronization::SemaphoreFunctor& waitSemaphoreFunctor, void*& block);
+
+	/// semaphore guarding access to allocation functions - its value is equal to the number of free blocks
+	Semaphore semaphore_;
+
+	/// first free block, nullptr if there are no free blocks
+	FreeBlock* freeList_;
+
+	/// beginning of storage for blocks
+	uint8_t* const storageBegin_;
+
+	/// size of single block, bytes
+	const size_t blockSize_;
+
+	/// number of blocks in the pool
+	const size_t blockCount_;
+
+	/// number of currently allocated blocks
+	size_t usedBlocks_;
+
+	/// max value of \a usedBlocks_ since the pool was constructed
+	size_t highWaterMark_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
@@ -0,0 +1,558 @@
+/**
+ * \file
+ * \brief MessageBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_MESSAGEBUFFER_HPP_
+#define INCLUDE_DISTORTOS_MESSAGEBUFFER_HPP_
+
+#include "distortos/scheduler/ThreadControlBlockList.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+/**
+ * \brief MessageBuffer class is a ring buffer for passing discrete messages of variable length between threads and
+ * interrupts.
+ *
+ * Each message is stored as a record which consists of a header with length of message and the message itself, rounded
+ * up to the multiple of sizeof(size_t). Each record is contiguous in the storage - if the record doesn't fit at the end
+ * of storage, the remaining space is filled with padding record and the message is placed at the beginning. Thanks to
+ * that, unlike with RawFifoQueue, storage is used only by messages that are actually in the buffer (no slot has to be
+ * sized for the largest message) and space for the message can be reserved and then filled in-place (for example by
+ * DMA), without any copying.
+ *
+ * Sender is blocked until contiguous space for the whole record is free - it is woken only when enough space is free,
+ * not after each receive. Receiver is blocked until a committed message is available.
+ *
+ * Blocking functions are intended mainly for single sender and single receiver (each of them may be either a thread or
+ * - with non-blocking functions - an interrupt). Several threads may block as senders or as receivers at the same
+ * time - all blocked receivers are woken when a message is committed and all blocked senders are woken when the
+ * smallest record required by them fits, then each one checks its own requirement again, blocking again if it is
+ * still not satisfied. Threads are woken in the order of priority, but there is no other fairness guarantee - thread
+ * with higher priority may starve the others.
+ */
+
+class MessageBuffer
+{
+public:
+
+	/**
+	 * \brief MessageBuffer's constructor
+	 *
+	 * \param [in] storage is a memory block for contents of the buffer, \a size bytes long; if it is not aligned to
+	 * alignof(size_t), some bytes at its beginning are not used
+	 * \param [in] size is the size of \a storage, bytes
+	 */
+
+	MessageBuffer(void* storage, size_t size);
+
+	/**
+	 * \brief Commits a message in space reserved with reserve() (or any of its variants).
+	 *
+	 * Committed message becomes available to receiver when all messages reserved before it are also committed.
+	 *
+	 * \param [in] reservation is the pointer returned by reserve() (or any of its variants)
+	 * \param [in] size is the actual size of message, bytes - must not be greater than the size of reservation; zero
+	 * discards the reservation
+	 *
+	 * \return zero if message was committed successfully, error code otherwise:
+	 * - EINVAL - \a reservation is not a valid reservation or \a size is greater than the size of reservation;
+	 */
+
+	int commit(void* reservation, size_t size);
+
+	/**
+	 * \return usable capacity of the buffer, bytes
+	 */
+
+	size_t getCapacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	 * \brief Receives the oldest message from the buffer.
+	 *
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	std::pair<int, size_t> receive(void* buffer, size_t size);
+
+	/**
+	 * \brief Reserves contiguous space for a message in the buffer.
+	 *
+	 * Reserved space must be committed with commit() to make the message available to receiver.
+	 *
+	 * \param [in] size is the size of reserved space, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	std::pair<int, void*> reserve(size_t size);
+
+	/**
+	 * \brief Sends the message to the buffer.
+	 *
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	int send(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to receive the oldest message from the buffer.
+	 *
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EAGAIN - no committed message is available;
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 */
+
+	std::pair<int, size_t> tryReceive(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to receive the oldest message from the buffer for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without receiving the message
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	std::pair<int, size_t> tryReceiveFor(TickClock::duration duration, void* buffer, size_t size,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to receive the oldest message from the buffer for a given duration of time.
+	 *
+	 * Template variant of tryReceiveFor(TickClock::duration, void*, size_t, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without receiving the message
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryReceiveFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size, const TickClock::duration slack = {})
+	{
+		return tryReceiveFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, slack);
+	}
+
+	/**
+	 * \brief Tries to receive the oldest message from the buffer until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without receiving the message
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	std::pair<int, size_t> tryReceiveUntil(TickClock::time_point timePoint, void* buffer, size_t size,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to receive the oldest message from the buffer until a given time point.
+	 *
+	 * Template variant of tryReceiveUntil(TickClock::time_point, void*, size_t, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without receiving the message
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryReceiveUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size, const TickClock::duration slack = {})
+	{
+		return tryReceiveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, slack);
+	}
+
+	/**
+	 * \brief Tries to reserve contiguous space for a message in the buffer.
+	 *
+	 * \param [in] size is the size of reserved space, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EAGAIN - there's not enough contiguous free space in the buffer;
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 */
+
+	std::pair<int, void*> tryReserve(size_t size);
+
+	/**
+	 * \brief Tries to reserve contiguous space for a message in the buffer for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the space
+	 * \param [in] size is the size of reserved space, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	std::pair<int, void*> tryReserveFor(TickClock::duration duration, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to reserve contiguous space for a message in the buffer for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration, size_t, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the space
+	 * \param [in] size is the size of reserved space, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryReserveFor(const std::chrono::duration<Rep, Period> duration, const size_t size,
+			const TickClock::duration slack = {})
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration), size, slack);
+	}
+
+	/**
+	 * \brief Tries to reserve contiguous space for a message in the buffer until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the space
+	 * \param [in] size is the size of reserved space, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	std::pair<int, void*> tryReserveUntil(TickClock::time_point timePoint, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to reserve contiguous space for a message in the buffer until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point, size_t, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the space
+	 * \param [in] size is the size of reserved space, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const size_t size, const TickClock::duration slack = {})
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), size, slack);
+	}
+
+	/**
+	 * \brief Tries to send the message to the buffer.
+	 *
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EAGAIN - there's not enough contiguous free space in the buffer;
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 */
+
+	int trySend(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to send the message to the buffer for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without sending the message
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int trySendFor(TickClock::duration duration, const void* data, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to send the message to the buffer for a given duration of time.
+	 *
+	 * Template variant of trySendFor(TickClock::duration, const void*, size_t, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without sending the message
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int trySendFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size,
+			const TickClock::duration slack = {})
+	{
+		return trySendFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size, slack);
+	}
+
+	/**
+	 * \brief Tries to send the message to the buffer until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without sending the message
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int trySendUntil(TickClock::time_point timePoint, const void* data, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to send the message to the buffer until a given time point.
+	 *
+	 * Template variant of trySendUntil(TickClock::time_point, const void*, size_t, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without sending the message
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration>
+	int trySendUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void* const data,
+			const size_t size, const TickClock::duration slack = {})
+	{
+		return trySendUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size, slack);
+	}
+
+private:
+
+	/**
+	 * \brief Allocates contiguous space for record in the storage, inserting padding record at the end of storage if
+	 * needed.
+	 *
+	 * \param [in] recordSize is the size of record (including header), bytes
+	 *
+	 * \return pointer to header of allocated record, nullptr if there's not enough contiguous free space
+	 */
+
+	size_t* allocate(size_t recordSize);
+
+	/**
+	 * \return size of largest record (including header) that can be allocated right now, bytes
+	 */
+
+	size_t getContiguousFreeSpace() const;
+
+	/**
+	 * \brief Implementation of receive(), tryReceive() and tryReceiveUntil()
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the call will be terminated, used only if blocking
+	 * mode is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [out] buffer is a pointer to buffer for received message
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and size of received message, bytes; error
+	 * codes:
+	 * - EAGAIN - there's no committed message in the buffer and non-blocking mode was selected;
+	 * - EMSGSIZE - \a size is less than the size of the oldest message, message is left in the buffer and its size is
+	 * returned;
+	 * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+	 */
+
+	std::pair<int, size_t> receiveInternal(bool nonBlocking, const TickClock::time_point* timePoint,
+			TickClock::duration slack, void* buffer, size_t size);
+
+	/**
+	 * \brief Releases space of padding records at read position.
+	 */
+
+	void releasePadding();
+
+	/**
+	 * \brief Implementation of reserve(), tryReserve() and tryReserveUntil()
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the call will be terminated, used only if blocking
+	 * mode is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [in] size is the size of reserved space, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to reserved space, aligned to
+	 * alignof(size_t); error codes:
+	 * - EAGAIN - there's not enough contiguous free space in the buffer and non-blocking mode was selected;
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+	 */
+
+	std::pair<int, void*> reserveInternal(bool nonBlocking, const TickClock::time_point* timePoint,
+			TickClock::duration slack, size_t size);
+
+	/**
+	 * \brief Implementation of send(), trySend() and trySendUntil()
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the call will be terminated, used only if blocking
+	 * mode is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [in] data is a pointer to message that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if message was sent successfully, error code otherwise:
+	 * - EAGAIN - there's not enough contiguous free space in the buffer and non-blocking mode was selected;
+	 * - EINVAL - \a size is zero;
+	 * - EMSGSIZE - message of \a size bytes can never fit in the buffer;
+	 * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+	 */
+
+	int sendInternal(bool nonBlocking, const TickClock::time_point* timePoint, TickClock::duration slack,
+			const void* data, size_t size);
+
+	/// ThreadControlBlock objects blocked while waiting for committed message
+	scheduler::ThreadControlBlockList receiveBlockedList_;
+
+	/// ThreadControlBlock objects blocked while waiting for enough contiguous free space
+	scheduler::ThreadControlBlockList sendBlockedList_;
+
+	/// pointer to first byte of storage, aligned to alignof(size_t)
+	uint8_t* const storage_;
+
+	/// usable capacity of the buffer, bytes - multiple of sizeof(size_t)
+	const size_t capacity_;
+
+	/// position of header of oldest record
+	size_t readPosition_;
+
+	/// position at which next record will be allocated
+	size_t writePosition_;
+
+	/// number of bytes used by records (including headers and padding)
+	size_t used_;
+
+	/// smallest size of record required by blocked senders, 0 if no sender is blocked
+	size_t sendRequiredSize_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MESSAGEBUFFER_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_MESSAGEQUEUE_HPP_
@@ -119,6 +119,19 @@ public:
 
 #endif	// DISTORTOS_MESSAGEQUEUE_EMPLACE_SUPPORTED == 1 || DOXYGEN == 1
 
+	/**
+	 * \brief Gets semaphore which is "ready" when the queue is not empty.
+	 *
+	 * Returned semaphore may be used only with WaitForAnySet, to wait for any of several queues to become non-empty.
+	 *
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return messageQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -339,22 +352,24 @@ public:
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopFor(const TickClock::duration duration, uint8_t& priority, T& value)
+	int tryPopFor(const TickClock::duration duration, uint8_t& priority, T& value, const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return popInternal(semaphoreTryWaitForFunctor, priority, value);
 	}
 
 	/**
 	 * \brief Tries to pop oldest element with highest priority from the queue for a given duration of time.
 	 *
-	 * Template variant of tryPopFor(TickClock::duration, uint8_t&, T&).
+	 * Template variant of tryPopFor(TickClock::duration, uint8_t&, T&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -363,6 +378,8 @@ public:
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -370,9 +387,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, T& value)
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, value);
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, value, slack);
 	}
 
 	/**
@@ -384,22 +402,25 @@ public:
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopUntil(const TickClock::time_point timePoint, uint8_t& priority, T& value)
+	int tryPopUntil(const TickClock::time_point timePoint, uint8_t& priority, T& value,
+			const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return popInternal(semaphoreTryWaitUntilFunctor, priority, value);
 	}
 
 	/**
 	 * \brief Tries to pop oldest element with highest priority from the queue until a given time point.
 	 *
-	 * Template variant of tryPopUntil(TickClock::time_point, uint8_t&, T&).
+	 * Template variant of tryPopUntil(TickClock::time_point, uint8_t&, T&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
@@ -407,6 +428,8 @@ public:
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
 	 * with the value in the queue's storage and destructed when no longer needed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -414,9 +437,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority, T& value)
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority, T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, value);
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, value, slack);
 	}
 
 	/**
@@ -466,22 +490,25 @@ public:
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(const TickClock::duration duration, const uint8_t priority, const T& value)
+	int tryPushFor(const TickClock::duration duration, const uint8_t priority, const T& value,
+			const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return pushInternal(semaphoreTryWaitForFunctor, priority, value);
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, uint8_t, const T&).
+	 * Template variant of tryPushFor(TickClock::duration, uint8_t, const T&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -489,6 +516,8 @@ public:
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -496,9 +525,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, const T& value)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, const T& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, value);
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, value, slack);
 	}
 
 	/**
@@ -510,22 +540,25 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(const TickClock::duration duration, const uint8_t priority, T&& value)
+	int tryPushFor(const TickClock::duration duration, const uint8_t priority, T&& value,
+			const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 		return pushInternal(semaphoreTryWaitForFunctor, priority, std::move(value));
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, uint8_t, T&&).
+	 * Template variant of tryPushFor(TickClock::duration, uint8_t, T&&, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -534,6 +567,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitFor();
@@ -541,9 +576,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, T&& value)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, T&& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, std::move(value));
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, std::move(value), slack);
 	}
 
 	/**
@@ -554,28 +590,33 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(const TickClock::time_point timePoint, const uint8_t priority, const T& value)
+	int tryPushUntil(const TickClock::time_point timePoint, const uint8_t priority, const T& value,
+			const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return pushInternal(semaphoreTryWaitUntilFunctor, priority, value);
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, const T&).
+	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, const T&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -584,9 +625,9 @@ public:
 
 	template<typename Duration>
 	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const uint8_t priority,
-			const T& value)
+			const T& value, const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, value);
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, value, slack);
 	}
 
 	/**
@@ -598,22 +639,25 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(const TickClock::time_point timePoint, const uint8_t priority, T&& value)
+	int tryPushUntil(const TickClock::time_point timePoint, const uint8_t priority, T&& value,
+			const TickClock::duration slack = {})
 	{
-		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 		return pushInternal(semaphoreTryWaitUntilFunctor, priority, std::move(value));
 	}
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, T&&).
+	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, T&&, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
@@ -621,6 +665,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
 	 * move-constructed
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - error codes returned by Semaphore::tryWaitUntil();
@@ -628,9 +674,11 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const uint8_t priority, T&& value)
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const uint8_t priority, T&& value,
+			const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, std::move(value));
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, std::move(value),
+				slack);
 	}
 
 private:
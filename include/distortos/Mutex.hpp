@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_MUTEX_HPP_
@@ -48,6 +48,16 @@ public:
 		Recursive
 	};
 
+	/// behavior of unlock() when there are threads blocked on the mutex
+	enum class UnlockMode : uint8_t
+	{
+		/// ownership of the mutex is transferred directly to the next thread blocked on the mutex
+		Handoff,
+		/// mutex is unlocked and the next thread blocked on the mutex is unblocked to try to lock it again, so the
+		/// mutex may be locked in the meantime by any other thread
+		Barging,
+	};
+
 	/**
 	 * \brief Gets the maximum number of recursive locks possible before returning EAGAIN
 	 *
@@ -72,9 +82,12 @@ public:
 	 * \param [in] protocol is the mutex protocol, default - Protocol::None
 	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when protocol != Protocol::PriorityProtect,
 	 * default - 0
+	 * \param [in] unlockMode is the behavior of unlock() when there are threads blocked on the mutex, default -
+	 * UnlockMode::Handoff
 	 */
 
-	explicit Mutex(Type type = Type::Normal, Protocol protocol = Protocol::None, uint8_t priorityCeiling = {});
+	explicit Mutex(Type type = Type::Normal, Protocol protocol = Protocol::None, uint8_t priorityCeiling = {},
+			UnlockMode unlockMode = UnlockMode::Handoff);
 
 	/**
 	 * \brief Locks the mutex.
@@ -132,6 +145,8 @@ public:
 	 * of the duration parameter need not be checked if the mutex can be locked immediately.
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the caller successfully locked the mutex, error code otherwise:
 	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
@@ -142,17 +157,19 @@ public:
 	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
 	 */
 
-	int tryLockFor(TickClock::duration duration);
+	int tryLockFor(TickClock::duration duration, TickClock::duration slack = {});
 
 	/**
 	 * Tries to lock the mutex for given duration of time.
 	 *
-	 * Template variant of tryLockFor(TickClock::duration duration).
+	 * Template variant of tryLockFor(TickClock::duration duration, TickClock::duration slack).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the caller successfully locked the mutex, error code otherwise:
 	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
@@ -164,9 +181,9 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryLockFor(const std::chrono::duration<Rep, Period> duration)
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
 	{
-		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration), slack);
 	}
 
 	/**
@@ -185,6 +202,8 @@ public:
 	 * of the timePoint parameter need not be checked if the mutex can be locked immediately.
 	 *
 	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the caller successfully locked the mutex, error code otherwise:
 	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
@@ -195,16 +214,18 @@ public:
 	 * - ETIMEDOUT - the mutex could not be locked before the specified timeout expired;
 	 */
 
-	int tryLockUntil(TickClock::time_point timePoint);
+	int tryLockUntil(TickClock::time_point timePoint, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to lock the mutex until given time point.
 	 *
-	 * Template variant of tryLockUntil(TickClock::time_point timePoint).
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint, TickClock::duration slack).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the mutex
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the caller successfully locked the mutex, error code otherwise:
 	 * - EAGAIN - the mutex could not be acquired because the maximum number of recursive locks for mutex has been
@@ -216,9 +237,9 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const TickClock::duration slack = {})
 	{
-		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
 	}
 
 	/**
@@ -233,6 +254,13 @@ public:
 	 * highest priority thread blocked waiting, then the highest priority thread that has been waiting the longest shall
 	 * be unblocked.
 	 *
+	 * With UnlockMode::Handoff the unblocked thread becomes the new owner of the mutex. With UnlockMode::Barging the
+	 * mutex is left unlocked and the unblocked thread tries to lock it again when it is executed - if any other thread
+	 * locks the mutex in the meantime (for example the current thread, if it tries to lock the mutex again before its
+	 * time slice ends), the unblocked thread blocks again. This avoids "lock convoys" - forced context switch on each
+	 * lock() of a contended mutex - at the cost of fairness. Thread with priority higher than the priority of current
+	 * thread still gets the mutex immediately, as it preempts the current thread as soon as it is unblocked.
+	 *
 	 * \return zero if the caller successfully unlocked the mutex, error code otherwise:
 	 * - EPERM - the mutex type is ErrorChecking or Recursive, and the current thread does not own the mutex;
 	 */
@@ -266,6 +294,9 @@ private:
 
 	/// type of mutex
 	Type type_;
+
+	/// behavior of unlock() when there are threads blocked on the mutex
+	UnlockMode unlockMode_;
 };
 
 }	// namespace distortos
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_RAWFIFOQUEUE_HPP_
@@ -71,6 +71,28 @@ public:
 
 	}
 
+	/**
+	 * \return number of elements dropped by pushOverwriting() since the queue was constructed
+	 */
+
+	size_t getDroppedCount() const
+	{
+		return fifoQueueBase_.getDroppedCount();
+	}
+
+	/**
+	 * \brief Gets semaphore which is "ready" when the queue is not empty.
+	 *
+	 * Returned semaphore may be used only with WaitForAnySet, to wait for any of several queues to become non-empty.
+	 *
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return fifoQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -137,6 +159,42 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * This function never blocks and never fails because the queue is full, so it is suitable for producers (e.g.
+	 * interrupts handling sensor data) which must not wait for the consumer. If all elements in the queue were already
+	 * claimed by threads which are about to pop them, the new element is dropped instead. Each dropped element
+	 * increments the value returned by getDroppedCount().
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 *
+	 * \return zero if element was pushed (possibly dropping the oldest one) or dropped, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwriting(const void* data, size_t size);
+
+	/**
+	 * \brief Pushes the element to the queue, dropping the oldest element if the queue is full.
+	 *
+	 * \param T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to RawFifoQueue
+	 *
+	 * \return zero if element was pushed (possibly dropping the oldest one) or dropped, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	int pushOverwriting(const T& data)
+	{
+		return pushOverwriting(&data, sizeof(data));
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -176,6 +234,8 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -183,12 +243,12 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopFor(TickClock::duration duration, void* buffer, size_t size);
+	int tryPopFor(TickClock::duration duration, void* buffer, size_t size, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
 	 *
-	 * Template variant of tryPopFor(TickClock::duration, void*, size_t).
+	 * Template variant of tryPopFor(TickClock::duration, void*, size_t, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -196,6 +256,8 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -204,9 +266,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size)
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size,
+			const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, slack);
 	}
 
 	/**
@@ -218,6 +281,8 @@ public:
 	 *
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -226,9 +291,9 @@ public:
 	 */
 
 	template<typename Rep, typename Period, typename T>
-	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& buffer)
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& buffer, const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer), slack);
 	}
 
 	/**
@@ -237,6 +302,8 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -244,18 +311,20 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+	int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
-	 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t).
+	 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -264,9 +333,10 @@ public:
 	 */
 
 	template<typename Duration>
-	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer, const size_t size)
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer, const size_t size,
+			const TickClock::duration slack = {})
 	{
-		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, slack);
 	}
 
 	/**
@@ -277,6 +347,8 @@ public:
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -285,9 +357,11 @@ public:
 	 */
 
 	template<typename Duration, typename T>
-	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& buffer)
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& buffer,
+			const TickClock::duration slack = {})
 	{
-		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer));
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer),
+				slack);
 	}
 
 	/**
@@ -329,6 +403,8 @@ public:
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -336,12 +412,12 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(TickClock::duration duration, const void* data, size_t size);
+	int tryPushFor(TickClock::duration duration, const void* data, size_t size, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, const void*, size_t).
+	 * Template variant of tryPushFor(TickClock::duration, const void*, size_t, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -349,6 +425,8 @@ public:
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -357,9 +435,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size);
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size, slack);
 	}
 
 	/**
@@ -371,6 +450,8 @@ public:
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] data is a reference to data that will be pushed to RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -379,9 +460,10 @@ public:
 	 */
 
 	template<typename Rep, typename Period, typename T>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const T& data)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const T& data,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), &data, sizeof(data));
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), &data, sizeof(data), slack);
 	}
 
 	/**
@@ -390,6 +472,8 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -397,18 +481,20 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(TickClock::time_point timePoint, const void* data, size_t size);
+	int tryPushUntil(TickClock::time_point timePoint, const void* data, size_t size, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, const void*, size_t).
+	 * Template variant of tryPushUntil(TickClock::time_point, const void*, size_t, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -418,9 +504,9 @@ public:
 
 	template<typename Duration>
 	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void* const data,
-			const size_t size)
+			const size_t size, const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size);
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size, slack);
 	}
 
 	/**
@@ -431,6 +517,8 @@ public:
 	 *
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] data is a reference to data that will be pushed to RawFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
@@ -439,9 +527,10 @@ public:
 	 */
 
 	template<typename Duration, typename T>
-	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T& data)
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T& data,
+			const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data));
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data), slack);
 	}
 
 private:
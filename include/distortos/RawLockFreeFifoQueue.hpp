@@ -0,0 +1,383 @@
+/**
+ * \file
+ * \brief RawLockFreeFifoQueue class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_RAWLOCKFREEFIFOQUEUE_HPP_
+#define INCLUDE_DISTORTOS_RAWLOCKFREEFIFOQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/synchronization/MpscRingBuffer.hpp"
+#include "distortos/synchronization/SpscRingBuffer.hpp"
+#include "distortos/synchronization/MemcpyPopQueueFunctor.hpp"
+#include "distortos/synchronization/MemcpyPushQueueFunctor.hpp"
+#include "distortos/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include <atomic>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/**
+ * \brief RawLockFreeFifoQueue class is a FIFO queue for interrupt -> thread streaming of binary serializable types,
+ * which doesn't use interrupt masking.
+ *
+ * Producers never block - they can only use tryPush(), which fails with EAGAIN when the queue is full. The single
+ * consumer may either poll the queue with tryPop() or block with pop(), tryPopFor() or tryPopUntil(). In the latter case
+ * the consumer waits on internal semaphore only when the queue is empty - producer posts this semaphore (which is the
+ * only place where interrupt masking is used) only when it finds the consumer waiting.
+ *
+ * \param RingBuffer is the type of lock-free ring buffer used as storage - synchronization::SpscRingBuffer (single
+ * producer) or synchronization::MpscRingBuffer (multiple producers)
+ */
+
+template<typename RingBuffer>
+class RawLockFreeFifoQueue
+{
+public:
+
+	/**
+	 * \brief RawLockFreeFifoQueue's constructor
+	 *
+	 * \param Args are types of arguments for constructor of \a RingBuffer
+	 *
+	 * \param [in] args are arguments for constructor of \a RingBuffer
+	 */
+
+	template<typename... Args>
+	explicit RawLockFreeFifoQueue(Args&&... args) :
+			ringBuffer_{std::forward<Args>(args)...},
+			popSemaphore_{0, 1},
+			consumerWaiting_{false}
+	{
+
+	}
+
+	/**
+	 * \return size of single queue element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return ringBuffer_.getElementSize();
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int pop(void* const buffer, const size_t size)
+	{
+		const synchronization::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popInternal(&semaphoreWaitFunctor, buffer, size);
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \param T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	template<typename T>
+	int pop(T& buffer)
+	{
+		return pop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * This function never blocks and never uses interrupt masking.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 */
+
+	int tryPop(void* const buffer, const size_t size)
+	{
+		return popInternal(nullptr, buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \param T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 */
+
+	template<typename T>
+	int tryPop(T& buffer)
+	{
+		return tryPop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size,
+			const TickClock::duration slack = {})
+	{
+		return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size, slack);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 * \param T is the type of data popped from the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& buffer, const TickClock::duration slack = {})
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer), slack);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size,
+			const TickClock::duration slack = {})
+	{
+		const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
+		return popInternal(&semaphoreTryWaitUntilFunctor, buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 * \param T is the type of data popped from the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration, typename T>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& buffer,
+			const TickClock::duration slack = {})
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer),
+				slack);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * This function never blocks. Interrupt masking is used only when the consumer is blocked waiting for data.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawLockFreeFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 */
+
+	int tryPush(const void* const data, const size_t size)
+	{
+		if (size != getElementSize())
+			return EMSGSIZE;
+
+		const synchronization::MemcpyPushQueueFunctor memcpyPushQueueFunctor {data, size};
+		const auto ret = ringBuffer_.push(memcpyPushQueueFunctor);
+		if (ret != 0)
+			return ret;
+
+		// pairs with the fence in popInternal() - either the consumer sees the new element or this producer sees the
+		// consumer waiting
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (consumerWaiting_.load(std::memory_order_relaxed) == true && consumerWaiting_.exchange(false) == true)
+			popSemaphore_.post();
+
+		return 0;
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \param T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to RawLockFreeFifoQueue
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 */
+
+	template<typename T>
+	int tryPush(const T& data)
+	{
+		return tryPush(&data, sizeof(data));
+	}
+
+	RawLockFreeFifoQueue(const RawLockFreeFifoQueue&) = delete;
+	RawLockFreeFifoQueue(RawLockFreeFifoQueue&&) = delete;
+	const RawLockFreeFifoQueue& operator=(const RawLockFreeFifoQueue&) = delete;
+	RawLockFreeFifoQueue& operator=(RawLockFreeFifoQueue&&) = delete;
+
+private:
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * Internal version - builds the Functor object and optionally waits for data when the queue is empty.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a pointer to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * when the queue is empty, nullptr to return EAGAIN instead of waiting
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
+	 * RawLockFreeFifoQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty and \a waitSemaphoreFunctor is nullptr;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawLockFreeFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int popInternal(const synchronization::SemaphoreFunctor* const waitSemaphoreFunctor, void* const buffer,
+			const size_t size)
+	{
+		if (size != getElementSize())
+			return EMSGSIZE;
+
+		const synchronization::MemcpyPopQueueFunctor memcpyPopQueueFunctor {buffer, size};
+
+		while (1)
+		{
+			{
+				const auto ret = ringBuffer_.pop(memcpyPopQueueFunctor);
+				if (ret != EAGAIN || waitSemaphoreFunctor == nullptr)
+					return ret;
+			}
+
+			consumerWaiting_.store(true, std::memory_order_relaxed);
+			// pairs with the fence in tryPush()
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			{
+				// the queue must be checked once again - producer could have pushed the element before seeing the flag
+				const auto ret = ringBuffer_.pop(memcpyPopQueueFunctor);
+				if (ret != EAGAIN)
+				{
+					consumerWaiting_.store(false, std::memory_order_relaxed);
+					return ret;
+				}
+			}
+
+			// the semaphore may also be "stale" (posted by a producer which raced with clearing of the flag above), in
+			// that case the loop just checks the queue once again
+			const auto ret = (*waitSemaphoreFunctor)(popSemaphore_);
+			if (ret != 0)
+			{
+				consumerWaiting_.store(false, std::memory_order_relaxed);
+				return ret;
+			}
+		}
+	}
+
+	/// lock-free ring buffer used as storage for elements
+	RingBuffer ringBuffer_;
+
+	/// binary semaphore on which the consumer waits when the queue is empty
+	Semaphore popSemaphore_;
+
+	/// true if the consumer is (about to be) blocked on \a popSemaphore_, false otherwise
+	std::atomic<bool> consumerWaiting_;
+};
+
+/// RawSpscFifoQueue is a RawLockFreeFifoQueue for single producer and single consumer
+using RawSpscFifoQueue = RawLockFreeFifoQueue<synchronization::SpscRingBuffer>;
+
+/// RawMpscFifoQueue is a RawLockFreeFifoQueue for multiple producers (possibly interrupts of different priorities) and
+/// single consumer
+using RawMpscFifoQueue = RawLockFreeFifoQueue<synchronization::MpscRingBuffer>;
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RAWLOCKFREEFIFOQUEUE_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-18
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_RAWMESSAGEQUEUE_HPP_
@@ -90,6 +90,19 @@ public:
 
 	}
 
+	/**
+	 * \brief Gets semaphore which is "ready" when the queue is not empty.
+	 *
+	 * Returned semaphore may be used only with WaitForAnySet, to wait for any of several queues to become non-empty.
+	 *
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return messageQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -219,6 +232,8 @@ public:
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
 	 * RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -226,12 +241,13 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopFor(TickClock::duration duration, uint8_t& priority, void* buffer, size_t size);
+	int tryPopFor(TickClock::duration duration, uint8_t& priority, void* buffer, size_t size,
+			TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to pop the oldest element with highest priority from the queue for a given duration of time.
 	 *
-	 * Template variant of tryPopFor(TickClock::duration, uint8_t&, void*, size_t).
+	 * Template variant of tryPopFor(TickClock::duration, uint8_t&, void*, size_t, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -241,6 +257,8 @@ public:
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
 	 * RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -250,9 +268,9 @@ public:
 
 	template<typename Rep, typename Period>
 	int tryPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, void* const buffer,
-			const size_t size)
+			const size_t size, const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, buffer, size);
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, buffer, size, slack);
 	}
 
 	/**
@@ -267,6 +285,8 @@ public:
 	 * \param [in] duration is the duration after which the call will be terminated without popping the element
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -275,9 +295,11 @@ public:
 	 */
 
 	template<typename Rep, typename Period, typename T>
-	int tryPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, T& buffer)
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, T& buffer,
+			const TickClock::duration slack = {})
 	{
-		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, &buffer, sizeof(buffer));
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, &buffer, sizeof(buffer),
+				slack);
 	}
 
 	/**
@@ -290,6 +312,8 @@ public:
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
 	 * RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -297,12 +321,13 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPopUntil(TickClock::time_point timePoint, uint8_t& priority, void* buffer, size_t size);
+	int tryPopUntil(TickClock::time_point timePoint, uint8_t& priority, void* buffer, size_t size,
+			TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to pop the oldest element with highest priority from the queue until a given time point.
 	 *
-	 * Template variant of tryPopUntil(TickClock::time_point, uint8_t&, void*, size_t).
+	 * Template variant of tryPopUntil(TickClock::time_point, uint8_t&, void*, size_t, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
@@ -311,6 +336,8 @@ public:
 	 * \param [out] buffer is a pointer to buffer for popped element
 	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of
 	 * RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -320,9 +347,9 @@ public:
 
 	template<typename Duration>
 	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority, void* const buffer,
-			const size_t size)
+			const size_t size, const TickClock::duration slack = {})
 	{
-		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, buffer, size);
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, buffer, size, slack);
 	}
 
 	/**
@@ -336,6 +363,8 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
 	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
 	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was popped successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -344,10 +373,11 @@ public:
 	 */
 
 	template<typename Duration, typename T>
-	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority, T& buffer)
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority, T& buffer,
+			const TickClock::duration slack = {})
 	{
 		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, &buffer,
-				sizeof(buffer));
+				sizeof(buffer), slack);
 	}
 
 	/**
@@ -398,6 +428,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -405,12 +437,13 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushFor(TickClock::duration duration, uint8_t priority, const void* data, size_t size);
+	int tryPushFor(TickClock::duration duration, uint8_t priority, const void* data, size_t size,
+			TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to push the element to the queue for a given duration of time.
 	 *
-	 * Template variant of tryPushFor(TickClock::duration, uint8_t, const void*, size_t).
+	 * Template variant of tryPushFor(TickClock::duration, uint8_t, const void*, size_t, TickClock::duration).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
@@ -419,6 +452,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -428,9 +463,9 @@ public:
 
 	template<typename Rep, typename Period>
 	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, const void* const data,
-			const size_t size)
+			const size_t size, const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, data, size);
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, data, size, slack);
 	}
 
 	/**
@@ -445,6 +480,8 @@ public:
 	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a reference to data that will be pushed to RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -453,9 +490,11 @@ public:
 	 */
 
 	template<typename Rep, typename Period, typename T>
-	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, const T& data)
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority, const T& data,
+			const TickClock::duration slack = {})
 	{
-		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, &data, sizeof(data));
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, &data, sizeof(data),
+				slack);
 	}
 
 	/**
@@ -467,6 +506,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -474,12 +515,13 @@ public:
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int tryPushUntil(TickClock::time_point timePoint, uint8_t priority, const void* data, size_t size);
+	int tryPushUntil(TickClock::time_point timePoint, uint8_t priority, const void* data, size_t size,
+			TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
-	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, const void*, size_t).
+	 * Template variant of tryPushUntil(TickClock::time_point, uint8_t, const void*, size_t, TickClock::duration).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
@@ -487,6 +529,8 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
 	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -496,9 +540,9 @@ public:
 
 	template<typename Duration>
 	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const uint8_t priority,
-			const void* const data, const size_t size)
+			const void* const data, const size_t size, const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, data, size);
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, data, size, slack);
 	}
 
 	/**
@@ -512,6 +556,8 @@ public:
 	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
 	 * \param [in] priority is the priority of new element
 	 * \param [in] data is a reference to data that will be pushed to RawMessageQueue
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if element was pushed successfully, error code otherwise:
 	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawMessageQueue;
@@ -521,10 +567,10 @@ public:
 
 	template<typename Duration, typename T>
 	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const uint8_t priority,
-			const T& data)
+			const T& data, const TickClock::duration slack = {})
 	{
-		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, &data,
-				sizeof(data));
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, &data, sizeof(data),
+				slack);
 	}
 
 private:
@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief SchedulerLock class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-14
+ */
+
+#ifndef INCLUDE_DISTORTOS_SCHEDULERLOCK_HPP_
+#define INCLUDE_DISTORTOS_SCHEDULERLOCK_HPP_
+
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief SchedulerLock class is a RAII wrapper for ThisThread::disablePreemption() / ThisThread::enablePreemption()
+ *
+ * Code in the scope of the lock is atomic with respect to other threads (as long as the thread doesn't block), but -
+ * unlike architecture::InterruptMaskingLock - it doesn't increase latency of interrupts. Locks may be nested.
+ *
+ * \note This class may be used only in thread context.
+ */
+
+class SchedulerLock
+{
+public:
+
+	/**
+	 * \brief SchedulerLock's constructor
+	 *
+	 * Disables preemption of current thread.
+	 */
+
+	SchedulerLock() :
+			locked_{ThisThread::disablePreemption() == 0}
+	{
+
+	}
+
+	/**
+	 * \brief SchedulerLock's destructor
+	 *
+	 * Enables preemption of current thread (if it was disabled by constructor), executing context switch that was
+	 * deferred while the lock was held.
+	 */
+
+	~SchedulerLock()
+	{
+		if (locked_ == true)
+			ThisThread::enablePreemption();
+	}
+
+	SchedulerLock(const SchedulerLock&) = delete;
+	SchedulerLock(SchedulerLock&&) = delete;
+	SchedulerLock& operator=(const SchedulerLock&) = delete;
+	SchedulerLock& operator=(SchedulerLock&&) = delete;
+
+private:
+
+	/// true if preemption was disabled by constructor, false otherwise (max nesting depth was reached)
+	bool locked_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SCHEDULERLOCK_HPP_
@@ -2,13 +2,13 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-25
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SEMAPHORE_HPP_
@@ -19,6 +19,15 @@
 namespace distortos
 {
 
+class WaitForAnySet;
+
+namespace synchronization
+{
+
+struct SemaphoreObserver;
+
+}	// namespace synchronization
+
 /**
  * \brief Semaphore is the basic synchronization primitive
  *
@@ -81,6 +90,8 @@ public:
 	 * shall be unblocked, and if there is more than one highest priority thread blocked waiting for the semaphore, then
 	 * the highest priority thread that has been waiting the longest shall be unblocked.
 	 *
+	 * If the semaphore value was incremented, all threads waiting for this semaphore in WaitForAnySet are unblocked.
+	 *
 	 * \return zero if the calling process successfully "posted" the semaphore, error code otherwise:
 	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
 	 */
@@ -115,31 +126,35 @@ public:
 	 * validity of the duration parameter need not be checked if the semaphore can be locked immediately.
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
 	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
 	 */
 
-	int tryWaitFor(TickClock::duration duration);
+	int tryWaitFor(TickClock::duration duration, TickClock::duration slack = {});
 
 	/**
 	 * Tries to lock the semaphore for given duration of time.
 	 *
-	 * Template variant of tryWaitFor(TickClock::duration duration).
+	 * Template variant of tryWaitFor(TickClock::duration duration, TickClock::duration slack).
 	 *
 	 * \param Rep is type of tick counter
 	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
 	 *
 	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
 	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
 	 */
 
 	template<typename Rep, typename Period>
-	int tryWaitFor(const std::chrono::duration<Rep, Period> duration)
+	int tryWaitFor(const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
 	{
-		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration), slack);
 	}
 
 	/**
@@ -155,30 +170,34 @@ public:
 	 * validity of the timePoint parameter need not be checked if the semaphore can be locked immediately.
 	 *
 	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
 	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
 	 */
 
-	int tryWaitUntil(TickClock::time_point timePoint);
+	int tryWaitUntil(TickClock::time_point timePoint, TickClock::duration slack = {});
 
 	/**
 	 * \brief Tries to lock the semaphore until given time point.
 	 *
-	 * Template variant of tryWaitUntil(TickClock::time_point timePoint).
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint, TickClock::duration slack).
 	 *
 	 * \param Duration is a std::chrono::duration type used to measure duration
 	 *
 	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
 	 *
 	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
 	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
 	 */
 
 	template<typename Duration>
-	int tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	int tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const TickClock::duration slack = {})
 	{
-		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
 	}
 
 	/**
@@ -198,6 +217,8 @@ public:
 
 private:
 
+	friend class WaitForAnySet;
+
 	/**
 	 * \brief Internal version of tryWait().
 	 *
@@ -212,6 +233,9 @@ private:
 	/// ThreadControlBlock objects blocked on this semaphore
 	scheduler::ThreadControlBlockList blockedList_;
 
+	/// first element of intrusive list of observers registered by WaitForAnySet objects, nullptr if list is empty
+	mutable synchronization::SemaphoreObserver* observers_;
+
 	/// internal value of the semaphore
 	Value value_;
 
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-24
+ * \date 2015-06-10
  */
 
 #ifndef INCLUDE_DISTORTOS_SOFTWARETIMER_HPP_
@@ -33,6 +33,21 @@ class SoftwareTimer : public SoftwareTimerBase
 {
 public:
 
+	/**
+	 * \brief SoftwareTimer's constructor
+	 *
+	 * \param [in] executionContext is the context in which \a function will be executed
+	 * \param [in] function is a function that will be executed at a later time
+	 * \param [in] args are arguments for function
+	 */
+
+	SoftwareTimer(const ExecutionContext executionContext, Function&& function, Args&&... args) :
+			SoftwareTimerBase{executionContext},
+			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+	{
+
+	}
+
 	/**
 	 * \brief SoftwareTimer's constructor
 	 *
@@ -41,8 +56,7 @@ public:
 	 */
 
 	SoftwareTimer(Function&& function, Args&&... args) :
-			SoftwareTimerBase{},
-			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+			SoftwareTimer{ExecutionContext::Interrupt, std::forward<Function>(function), std::forward<Args>(args)...}
 	{
 
 	}
@@ -82,6 +96,26 @@ SoftwareTimer<Function, Args...> makeSoftwareTimer(Function&& function, Args&&..
 	return {std::forward<Function>(function), std::forward<Args>(args)...};
 }
 
+/**
+ * \brief Helper factory function to make SoftwareTimer object with deduced template arguments
+ *
+ * \param Function is the function that will be executed
+ * \param Args are the arguments for function
+ *
+ * \param [in] executionContext is the context in which \a function will be executed
+ * \param [in] function is a function that will be executed at a later time
+ * \param [in] args are arguments for function
+ *
+ * \return SoftwareTimer object with deduced template arguments
+ */
+
+template<typename Function, typename... Args>
+SoftwareTimer<Function, Args...> makeSoftwareTimer(const SoftwareTimerBase::ExecutionContext executionContext,
+		Function&& function, Args&&... args)
+{
+	return {executionContext, std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_SOFTWARETIMER_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-24
+ * \date 2015-06-12
  */
 
 #ifndef INCLUDE_DISTORTOS_SOFTWARETIMERBASE_HPP_
@@ -24,16 +24,32 @@ class SoftwareTimerBase : private scheduler::SoftwareTimerControlBlock
 {
 public:
 
+	/// import ExecutionContext type from scheduler::SoftwareTimerControlBlock
+	using ExecutionContext = scheduler::SoftwareTimerControlBlock::ExecutionContext;
+
 	/**
 	 * \brief SoftwareTimerBase's constructor
+	 *
+	 * \param [in] executionContext is the context in which software timer's function is executed, default -
+	 * ExecutionContext::Interrupt
 	 */
 
-	SoftwareTimerBase() :
-			SoftwareTimerControlBlock{}
+	explicit SoftwareTimerBase(const ExecutionContext executionContext = ExecutionContext::Interrupt) :
+			SoftwareTimerControlBlock{executionContext}
 	{
 
 	}
 
+	using SoftwareTimerControlBlock::getDeadline;
+
+	using SoftwareTimerControlBlock::getExecutionContext;
+
+	using SoftwareTimerControlBlock::getOverrunCount;
+
+	using SoftwareTimerControlBlock::getPeriod;
+
+	using SoftwareTimerControlBlock::getSlack;
+
 	using SoftwareTimerControlBlock::isRunning;
 
 	using SoftwareTimerControlBlock::start;
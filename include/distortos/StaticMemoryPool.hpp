@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \brief StaticMemoryPool class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-27
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+
+#include "MemoryPool.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticMemoryPool class is a variant of MemoryPool that has automatic storage for pool's blocks.
+ *
+ * Size of each block is rounded up, so that it can hold a pointer and all blocks are suitably aligned for any object of
+ * requested size.
+ *
+ * \param BlockSize is the requested size of single block, bytes
+ * \param BlockCount is the number of blocks in the pool
+ */
+
+template<size_t BlockSize, size_t BlockCount>
+class StaticMemoryPool : public MemoryPool
+{
+public:
+
+	/**
+	 * \brief StaticMemoryPool's constructor
+	 */
+
+	explicit StaticMemoryPool() :
+			MemoryPool{storage_.data(), sizeof(Block), BlockCount}
+	{
+
+	}
+
+private:
+
+	/// type of uninitialized storage for single block
+	using Block = typename std::aligned_storage<BlockSize < sizeof(void*) ? sizeof(void*) : BlockSize>::type;
+
+	/// storage for pool's blocks
+	std::array<Block, BlockCount> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
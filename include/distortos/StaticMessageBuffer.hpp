@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief StaticMessageBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-08
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICMESSAGEBUFFER_HPP_
+#define INCLUDE_DISTORTOS_STATICMESSAGEBUFFER_HPP_
+
+#include "MessageBuffer.hpp"
+
+#include <type_traits>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticMessageBuffer class is a variant of MessageBuffer that has automatic storage for buffer's contents.
+ *
+ * \param Size is the capacity of the buffer, bytes - each message uses sizeof(size_t) bytes for header and is padded to
+ * the multiple of sizeof(size_t)
+ */
+
+template<size_t Size>
+class StaticMessageBuffer : public MessageBuffer
+{
+public:
+
+	/**
+	 * \brief StaticMessageBuffer's constructor
+	 */
+
+	explicit StaticMessageBuffer() :
+			MessageBuffer{&storage_, sizeof(storage_)}
+	{
+
+	}
+
+private:
+
+	/// storage for buffer's contents
+	typename std::aligned_storage<Size, alignof(size_t)>::type storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICMESSAGEBUFFER_HPP_
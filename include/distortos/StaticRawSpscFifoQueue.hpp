@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief StaticRawSpscFifoQueue class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICRAWSPSCFIFOQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICRAWSPSCFIFOQUEUE_HPP_
+
+#include "RawLockFreeFifoQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief StaticRawSpscFifoQueue class is a variant of RawSpscFifoQueue that has automatic storage for queue's contents.
+ *
+ * \param T is the type of data in queue
+ * \param QueueSize is the maximum number of elements in queue, must be a power of two
+ */
+
+template<typename T, size_t QueueSize>
+class StaticRawSpscFifoQueue : public RawSpscFifoQueue
+{
+	static_assert(QueueSize != 0 && (QueueSize & (QueueSize - 1)) == 0, "QueueSize must be a power of two!");
+
+public:
+
+	/**
+	 * \brief StaticRawSpscFifoQueue's constructor
+	 */
+
+	explicit StaticRawSpscFifoQueue() :
+			RawSpscFifoQueue{storage_.data(), sizeof(T), QueueSize}
+	{
+
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<typename std::aligned_storage<sizeof(T), alignof(T)>::type, QueueSize> storage_;
+};
+
+/**
+ * \brief StaticRawSpscFifoQueueFromSize type alias is a variant of StaticRawSpscFifoQueue which uses size of element
+ * (instead of type) as template argument.
+ *
+ * \param ElementSize is the size of single queue element, bytes
+ * \param QueueSize is the maximum number of elements in queue, must be a power of two
+ */
+
+template<size_t ElementSize, size_t QueueSize>
+using StaticRawSpscFifoQueueFromSize =
+		StaticRawSpscFifoQueue<typename std::aligned_storage<ElementSize, ElementSize>::type, QueueSize>;
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICRAWSPSCFIFOQUEUE_HPP_
@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief StaticStreamBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-08
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
+#define INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
+
+#include "StreamBuffer.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticStreamBuffer class is a variant of StreamBuffer that has automatic storage for buffer's contents.
+ *
+ * \param Size is the capacity of the buffer, bytes
+ */
+
+template<size_t Size>
+class StaticStreamBuffer : public StreamBuffer
+{
+public:
+
+	/**
+	 * \brief StaticStreamBuffer's constructor
+	 *
+	 * \param [in] triggerLevel is the number of bytes that must be available in the buffer to unblock receiver, values
+	 * outside of [1; Size] range are clamped, default - 1
+	 */
+
+	explicit StaticStreamBuffer(const size_t triggerLevel = 1) :
+			StreamBuffer{storage_.data(), storage_.size(), triggerLevel}
+	{
+
+	}
+
+private:
+
+	/// storage for buffer's contents
+	std::array<uint8_t, Size> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSTREAMBUFFER_HPP_
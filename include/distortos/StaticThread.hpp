@@ -8,15 +8,19 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_STATICTHREAD_HPP_
 #define INCLUDE_DISTORTOS_STATICTHREAD_HPP_
 
-#include "distortos/Thread.hpp"
+#include "distortos/ThreadCommon.hpp"
 #include "distortos/StaticSignalsReceiver.hpp"
 
+#include "distortos/scheduler/ReentStorage.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -29,18 +33,20 @@ namespace distortos
  * 0 to disable queuing of signals for this thread
  * \param SignalActions is the max number of different SignalAction objects for this thread, relevant only if
  * CanReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param SharedReentrancy selects whether this thread shares global newlib's _reent structure with other threads (true)
+ * or whether it has thread-specific _reent structure (false)
  * \param Function is the function that will be executed in separate thread
  * \param Args are the arguments for Function
  */
 
-template<size_t StackSize, bool CanReceiveSignals, size_t QueuedSignals, size_t SignalActions, typename Function,
-		typename... Args>
-class StaticThread : public Thread<Function, Args...>
+template<size_t StackSize, bool CanReceiveSignals, size_t QueuedSignals, size_t SignalActions, bool SharedReentrancy,
+		typename Function, typename... Args>
+class StaticThread : public ThreadCommon<Function, Args...>
 {
 public:
 
 	/// base of StaticThread
-	using Base = Thread<Function, Args...>;
+	using Base = ThreadCommon<Function, Args...>;
 
 	/**
 	 * \brief StaticThread's constructor
@@ -52,8 +58,8 @@ public:
 	 */
 
 	StaticThread(const uint8_t priority, const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
-			Base{&stack_, sizeof(stack_), priority, schedulingPolicy, std::forward<Function>(function),
-					std::forward<Args>(args)...}
+			Base{&stack_, sizeof(stack_), priority, schedulingPolicy, nullptr, reentStorage_.get(),
+					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
 
 	}
@@ -80,8 +86,11 @@ public:
 
 private:
 
-	/// stack buffer
-	typename std::aligned_storage<StackSize>::type stack_;
+	/// stack buffer, size is scaled by CONFIG_STACK_SIZE_MULTIPLIER
+	typename std::aligned_storage<StackSize * CONFIG_STACK_SIZE_MULTIPLIER>::type stack_;
+
+	/// storage for thread-specific newlib's _reent structure, empty if SharedReentrancy == true
+	scheduler::ReentStorage<SharedReentrancy> reentStorage_;
 };
 
 /**
@@ -95,17 +104,21 @@ private:
  * thread
  * \param SignalActions is the max number of different SignalAction objects for this thread, relevant only if
  * CanReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param SharedReentrancy selects whether this thread shares global newlib's _reent structure with other threads (true)
+ * or whether it has thread-specific _reent structure (false)
  * \param Function is the function that will be executed in separate thread
  * \param Args are the arguments for Function
  */
 
-template<size_t StackSize, size_t QueuedSignals, size_t SignalActions, typename Function, typename... Args>
-class StaticThread<StackSize, true, QueuedSignals, SignalActions, Function, Args...> : public Thread<Function, Args...>
+template<size_t StackSize, size_t QueuedSignals, size_t SignalActions, bool SharedReentrancy, typename Function,
+		typename... Args>
+class StaticThread<StackSize, true, QueuedSignals, SignalActions, SharedReentrancy, Function, Args...> :
+		public ThreadCommon<Function, Args...>
 {
 public:
 
 	/// base of StaticThread
-	using Base = Thread<Function, Args...>;
+	using Base = ThreadCommon<Function, Args...>;
 
 	/**
 	 * \brief StaticThread's constructor
@@ -117,7 +130,7 @@ public:
 	 */
 
 	StaticThread(const uint8_t priority, const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
-			Base{&stack_, sizeof(stack_), priority, schedulingPolicy, &staticSignalsReceiver_,
+			Base{&stack_, sizeof(stack_), priority, schedulingPolicy, &staticSignalsReceiver_, reentStorage_.get(),
 					std::forward<Function>(function), std::forward<Args>(args)...},
 			staticSignalsReceiver_{}
 	{
@@ -146,11 +159,14 @@ public:
 
 private:
 
-	/// stack buffer
-	typename std::aligned_storage<StackSize>::type stack_;
+	/// stack buffer, size is scaled by CONFIG_STACK_SIZE_MULTIPLIER
+	typename std::aligned_storage<StackSize * CONFIG_STACK_SIZE_MULTIPLIER>::type stack_;
 
 	/// internal StaticSignalsReceiver object
 	StaticSignalsReceiver<QueuedSignals, SignalActions> staticSignalsReceiver_;
+
+	/// storage for thread-specific newlib's _reent structure, empty if SharedReentrancy == true
+	scheduler::ReentStorage<SharedReentrancy> reentStorage_;
 };
 
 /**
@@ -162,6 +178,8 @@ private:
  * 0 to disable queuing of signals for this thread
  * \param SignalActions is the max number of different SignalAction objects for this thread, relevant only if
  * CanReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param SharedReentrancy selects whether this thread shares global newlib's _reent structure with other threads (true)
+ * or whether it has thread-specific _reent structure (false)
  * \param Function is the function that will be executed
  * \param Args are the arguments for Function
  *
@@ -174,8 +192,8 @@ private:
  */
 
 template<size_t StackSize, bool CanReceiveSignals = {}, size_t QueuedSignals = {}, size_t SignalActions = {},
-		typename Function, typename... Args>
-StaticThread<StackSize, CanReceiveSignals, QueuedSignals, SignalActions, Function, Args...>
+		bool SharedReentrancy = {}, typename Function, typename... Args>
+StaticThread<StackSize, CanReceiveSignals, QueuedSignals, SignalActions, SharedReentrancy, Function, Args...>
 makeStaticThread(const uint8_t priority, const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args)
 {
 	return {priority, schedulingPolicy, std::forward<Function>(function), std::forward<Args>(args)...};
@@ -190,6 +208,8 @@ makeStaticThread(const uint8_t priority, const SchedulingPolicy schedulingPolicy
  * 0 to disable queuing of signals for this thread
  * \param SignalActions is the max number of different SignalAction objects for this thread, relevant only if
  * CanReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param SharedReentrancy selects whether this thread shares global newlib's _reent structure with other threads (true)
+ * or whether it has thread-specific _reent structure (false)
  * \param Function is the function that will be executed
  * \param Args are the arguments for Function
  *
@@ -201,8 +221,8 @@ makeStaticThread(const uint8_t priority, const SchedulingPolicy schedulingPolicy
  */
 
 template<size_t StackSize, bool CanReceiveSignals = {}, size_t QueuedSignals = {}, size_t SignalActions = {},
-		typename Function, typename... Args>
-StaticThread<StackSize, CanReceiveSignals, QueuedSignals, SignalActions, Function, Args...>
+		bool SharedReentrancy = {}, typename Function, typename... Args>
+StaticThread<StackSize, CanReceiveSignals, QueuedSignals, SignalActions, SharedReentrancy, Function, Args...>
 makeStaticThread(const uint8_t priority, Function&& function, Args&&... args)
 {
 	return {priority, std::forward<Function>(function), std::forward<Args>(args)...};
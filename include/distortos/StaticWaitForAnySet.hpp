@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief StaticWaitForAnySet class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-29
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICWAITFORANYSET_HPP_
+#define INCLUDE_DISTORTOS_STATICWAITFORANYSET_HPP_
+
+#include "distortos/WaitForAnySet.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief StaticWaitForAnySet class is a variant of WaitForAnySet that has automatic storage for observers.
+ *
+ * \param Count is the number of semaphores in the set
+ */
+
+template<size_t Count>
+class StaticWaitForAnySet : public WaitForAnySet
+{
+public:
+
+	/**
+	 * \brief StaticWaitForAnySet's constructor
+	 *
+	 * \param Semaphores are types of semaphores in the set - all must be Semaphore
+	 *
+	 * \param [in] semaphores are references to semaphores in the set, index of each semaphore is equal to its position
+	 * on this list
+	 */
+
+	template<typename... Semaphores>
+	explicit StaticWaitForAnySet(const Semaphores&... semaphores) :
+			WaitForAnySet{observers_, Count},
+			observers_{synchronization::SemaphoreObserver{semaphores}...}
+	{
+		static_assert(sizeof...(semaphores) == Count, "Number of semaphores doesn't match Count!");
+	}
+
+private:
+
+	/// observers, one for each semaphore in the set
+	synchronization::SemaphoreObserver observers_[Count];
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICWAITFORANYSET_HPP_
@@ -0,0 +1,381 @@
+/**
+ * \file
+ * \brief StreamBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
+#define INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
+
+#include "distortos/scheduler/ThreadControlBlockList.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+/**
+ * \brief StreamBuffer class is a byte ring buffer for passing stream of bytes of arbitrary length between threads and
+ * interrupts.
+ *
+ * Unlike RawFifoQueue, StreamBuffer has no notion of elements - any number of bytes (up to the capacity of the buffer)
+ * can be sent at once and any number of bytes can be received at once, so no storage is wasted on padding of short
+ * transfers to the size of the largest one.
+ *
+ * Sender is blocked until the whole data fits in the buffer - it is woken only when enough bytes are free, not after
+ * each receive. Receiver is blocked until at least "trigger level" bytes are available - it is woken only when this
+ * level is reached, not after each send.
+ *
+ * Blocking functions are intended mainly for single sender and single receiver (each of them may be either a thread or
+ * - with non-blocking functions - an interrupt). Several threads may block as senders or as receivers at the same
+ * time - when the smallest requirement of blocked threads is satisfied, all of them are woken and each one checks its
+ * own requirement again, blocking again if it is still not satisfied. Threads are woken in the order of priority, but
+ * there is no other fairness guarantee - thread with higher priority may starve the others.
+ */
+
+class StreamBuffer
+{
+public:
+
+	/**
+	 * \brief StreamBuffer's constructor
+	 *
+	 * \param [in] storage is a memory block for contents of the buffer, \a size bytes long
+	 * \param [in] size is the size of \a storage, bytes
+	 * \param [in] triggerLevel is the number of bytes that must be available in the buffer to unblock receiver, values
+	 * outside of [1; size] range are clamped, default - 1
+	 */
+
+	StreamBuffer(void* storage, size_t size, size_t triggerLevel = 1);
+
+	/**
+	 * \return capacity of the buffer, bytes
+	 */
+
+	size_t getCapacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	 * \return number of bytes available in the buffer
+	 */
+
+	size_t getSize() const
+	{
+		return used_;
+	}
+
+	/**
+	 * \brief Receives data from the buffer.
+	 *
+	 * Blocks until at least min(trigger level, \a size) bytes are available, then copies up to \a size bytes.
+	 *
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	std::pair<int, size_t> receive(void* buffer, size_t size);
+
+	/**
+	 * \brief Sends data to the buffer.
+	 *
+	 * Blocks until \a size bytes are free, then copies the whole data. Data is never sent partially.
+	 *
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	int send(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to receive data from the buffer.
+	 *
+	 * If less than min(trigger level, \a size) bytes are available, all of them are received.
+	 *
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EAGAIN - the buffer is empty;
+	 * - EINVAL - \a size is zero;
+	 */
+
+	std::pair<int, size_t> tryReceive(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to receive data from the buffer for a given duration of time.
+	 *
+	 * If less than min(trigger level, \a size) bytes are available after \a duration, all of them are received.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::blockUntil() (ETIMEDOUT only if the buffer is empty);
+	 */
+
+	std::pair<int, size_t> tryReceiveFor(TickClock::duration duration, void* buffer, size_t size,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to receive data from the buffer for a given duration of time.
+	 *
+	 * Template variant of tryReceiveFor(TickClock::duration, void*, size_t, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::blockUntil() (ETIMEDOUT only if the buffer is empty);
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryReceiveFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size, const TickClock::duration slack = {})
+	{
+		return tryReceiveFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, slack);
+	}
+
+	/**
+	 * \brief Tries to receive data from the buffer until a given time point.
+	 *
+	 * If less than min(trigger level, \a size) bytes are available at \a timePoint, all of them are received.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::blockUntil() (ETIMEDOUT only if the buffer is empty);
+	 */
+
+	std::pair<int, size_t> tryReceiveUntil(TickClock::time_point timePoint, void* buffer, size_t size,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to receive data from the buffer until a given time point.
+	 *
+	 * Template variant of tryReceiveUntil(TickClock::time_point, void*, size_t, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::blockUntil() (ETIMEDOUT only if the buffer is empty);
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryReceiveUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size, const TickClock::duration slack = {})
+	{
+		return tryReceiveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, slack);
+	}
+
+	/**
+	 * \brief Tries to send data to the buffer.
+	 *
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EAGAIN - there's not enough free space in the buffer;
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 */
+
+	int trySend(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to send data to the buffer for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without sending the data
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int trySendFor(TickClock::duration duration, const void* data, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to send data to the buffer for a given duration of time.
+	 *
+	 * Template variant of trySendFor(TickClock::duration, const void*, size_t, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without sending the data
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int trySendFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size,
+			const TickClock::duration slack = {})
+	{
+		return trySendFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size, slack);
+	}
+
+	/**
+	 * \brief Tries to send data to the buffer until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without sending the data
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int trySendUntil(TickClock::time_point timePoint, const void* data, size_t size, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to send data to the buffer until a given time point.
+	 *
+	 * Template variant of trySendUntil(TickClock::time_point, const void*, size_t, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without sending the data
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration>
+	int trySendUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void* const data,
+			const size_t size, const TickClock::duration slack = {})
+	{
+		return trySendUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size, slack);
+	}
+
+private:
+
+	/**
+	 * \brief Implementation of receive(), tryReceive() and tryReceiveUntil()
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the call will be terminated, used only if blocking
+	 * mode is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [out] buffer is a pointer to buffer for received data
+	 * \param [in] size is the size of \a buffer, bytes
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of received bytes; error codes:
+	 * - EAGAIN - the buffer is empty and non-blocking mode was selected;
+	 * - EINVAL - \a size is zero;
+	 * - error codes returned by Scheduler::block() and Scheduler::blockUntil() (ETIMEDOUT only if the buffer is
+	 * empty);
+	 */
+
+	std::pair<int, size_t> receiveInternal(bool nonBlocking, const TickClock::time_point* timePoint,
+			TickClock::duration slack, void* buffer, size_t size);
+
+	/**
+	 * \brief Implementation of send(), trySend() and trySendUntil()
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the call will be terminated, used only if blocking
+	 * mode is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [in] data is a pointer to data that will be sent to the buffer
+	 * \param [in] size is the size of \a data, bytes
+	 *
+	 * \return zero if data was sent successfully, error code otherwise:
+	 * - EAGAIN - there's not enough free space in the buffer and non-blocking mode was selected;
+	 * - EMSGSIZE - \a size is greater than capacity of the buffer;
+	 * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+	 */
+
+	int sendInternal(bool nonBlocking, const TickClock::time_point* timePoint, TickClock::duration slack,
+			const void* data, size_t size);
+
+	/// ThreadControlBlock objects blocked while waiting for enough bytes to be available
+	scheduler::ThreadControlBlockList receiveBlockedList_;
+
+	/// ThreadControlBlock objects blocked while waiting for enough bytes to be free
+	scheduler::ThreadControlBlockList sendBlockedList_;
+
+	/// pointer to first byte of storage
+	uint8_t* const storage_;
+
+	/// capacity of the buffer, bytes
+	const size_t capacity_;
+
+	/// number of bytes that must be available in the buffer to unblock receiver
+	const size_t triggerLevel_;
+
+	/// position of first byte available for receiving
+	size_t readPosition_;
+
+	/// number of bytes available in the buffer
+	size_t used_;
+
+	/// smallest number of bytes required by blocked receivers, 0 if no receiver is blocked
+	size_t receiveRequiredSize_;
+
+	/// smallest number of free bytes required by blocked senders, 0 if no sender is blocked
+	size_t sendRequiredSize_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STREAMBUFFER_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-29
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_THISTHREAD_SIGNALS_HPP_
@@ -169,6 +169,8 @@ std::pair<int, SignalInformation> tryWait(const SignalSet& signalSet);
  *
  * \param [in] signalSet is a reference to set of signals that will be waited for
  * \param [in] duration is the duration after which the wait for signals will be terminated
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (termination is never delayed)
  *
  * \return pair with return code (0 on success, error code otherwise) and SignalInformation object for accepted signal;
  * error codes:
@@ -176,18 +178,21 @@ std::pair<int, SignalInformation> tryWait(const SignalSet& signalSet);
  * - ETIMEDOUT - no signal specified by \a signalSet was generated before the specified \a duration passed;
  */
 
-std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet, TickClock::duration duration);
+std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet, TickClock::duration duration,
+		TickClock::duration slack = {});
 
 /**
  * \brief Tries to wait for signals for given duration of time.
  *
- * Template variant of tryWaitFor(const SignalSet&, TickClock::duration).
+ * Template variant of tryWaitFor(const SignalSet&, TickClock::duration, TickClock::duration).
  *
  * \param Rep is type of tick counter
  * \param Period is std::ratio type representing the tick period of the clock, in seconds
  *
  * \param [in] signalSet is a reference to set of signals that will be waited for
  * \param [in] duration is the duration after which the wait for signals will be terminated
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (termination is never delayed)
  *
  * \return pair with return code (0 on success, error code otherwise) and SignalInformation object for accepted signal;
  * error codes:
@@ -197,9 +202,9 @@ std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet, TickClo
 
 template<typename Rep, typename Period>
 std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet,
-		const std::chrono::duration<Rep, Period> duration)
+		const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
 {
-	return tryWaitFor(signalSet, std::chrono::duration_cast<TickClock::duration>(duration));
+	return tryWaitFor(signalSet, std::chrono::duration_cast<TickClock::duration>(duration), slack);
 }
 
 /**
@@ -213,6 +218,8 @@ std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet,
  *
  * \param [in] signalSet is a reference to set of signals that will be waited for
  * \param [in] timePoint is the time point at which the wait for signals will be terminated
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (termination is never delayed)
  *
  * \return pair with return code (0 on success, error code otherwise) and SignalInformation object for accepted signal;
  * error codes:
@@ -220,17 +227,20 @@ std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet,
  * - ETIMEDOUT - no signal specified by \a signalSet was generated before specified \a timePoint;
  */
 
-std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet, TickClock::time_point timePoint);
+std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet, TickClock::time_point timePoint,
+		TickClock::duration slack = {});
 
 /**
  * \brief Tries to wait for signals until given time point.
  *
- * Template variant of tryWaitUntil(const SignalSet&, TickClock::time_point).
+ * Template variant of tryWaitUntil(const SignalSet&, TickClock::time_point, TickClock::duration).
  *
  * \param Duration is a std::chrono::duration type used to measure duration
  *
  * \param [in] signalSet is a reference to set of signals that will be waited for
  * \param [in] timePoint is the time point at which the wait for signals will be terminated
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (termination is never delayed)
  *
  * \return pair with return code (0 on success, error code otherwise) and SignalInformation object for accepted signal;
  * error codes:
@@ -240,9 +250,9 @@ std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet, TickC
 
 template<typename Duration>
 std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet,
-		const std::chrono::time_point<TickClock, Duration> timePoint)
+		const std::chrono::time_point<TickClock, Duration> timePoint, const TickClock::duration slack = {})
 {
-	return tryWaitUntil(signalSet, std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	return tryWaitUntil(signalSet, std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
 }
 
 /**
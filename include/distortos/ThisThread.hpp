@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-02-16
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_THISTHREAD_HPP_
@@ -25,6 +25,34 @@ class ThreadBase;
 namespace ThisThread
 {
 
+/**
+ * \brief Disables preemption of calling (current) thread.
+ *
+ * While preemption is disabled, the thread is not switched out due to higher-priority thread becoming ready or due to
+ * round-robin scheduling - such context switch is deferred until preemption is enabled again. Interrupts are not
+ * masked, so they - and kernel functions called from them - are fully functional. Calls may be nested, each one must
+ * be matched with a call to enablePreemption().
+ *
+ * \note If the thread blocks while its preemption is disabled, context switch is done anyway.
+ *
+ * \return 0 on success, error code otherwise:
+ * - EAGAIN - max nesting depth of disabled preemption was reached;
+ */
+
+int disablePreemption();
+
+/**
+ * \brief Enables preemption of calling (current) thread.
+ *
+ * When the outermost call to disablePreemption() is undone, context switch which was deferred while preemption was
+ * disabled is executed.
+ *
+ * \return 0 on success, error code otherwise:
+ * - EPERM - preemption of calling (current) thread is not disabled;
+ */
+
+int enablePreemption();
+
 /**
  * \return reference to ThreadBase object of currently active thread
  */
@@ -62,9 +90,11 @@ void setPriority(uint8_t priority, bool alwaysBehind = {});
  * \note To fulfill the "at least" requirement, one additional tick is always added to the sleep duration.
  *
  * \param [in] duration is the duration after which the thread will be woken
+ * \param [in] slack is the max duration by which waking of the thread may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (waking is never delayed)
  */
 
-void sleepFor(TickClock::duration duration);
+void sleepFor(TickClock::duration duration, TickClock::duration slack = {});
 
 /**
  * \brief Makes the calling (current) thread sleep for at least given duration.
@@ -77,12 +107,14 @@ void sleepFor(TickClock::duration duration);
  * \param Period is std::ratio type representing the tick period of the clock, in seconds
  *
  * \param [in] duration is the duration after which the thread will be woken
+ * \param [in] slack is the max duration by which waking of the thread may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (waking is never delayed)
  */
 
 template<typename Rep, typename Period>
-void sleepFor(const std::chrono::duration<Rep, Period> duration)
+void sleepFor(const std::chrono::duration<Rep, Period> duration, const TickClock::duration slack = {})
 {
-	sleepFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	sleepFor(std::chrono::duration_cast<TickClock::duration>(duration), slack);
 }
 
 /**
@@ -91,9 +123,11 @@ void sleepFor(const std::chrono::duration<Rep, Period> duration)
  * Current thread's state is changed to "sleeping".
  *
  * \param [in] timePoint is the time point at which the thread will be woken
+ * \param [in] slack is the max duration by which waking of the thread may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (waking is never delayed)
  */
 
-void sleepUntil(TickClock::time_point timePoint);
+void sleepUntil(TickClock::time_point timePoint, TickClock::duration slack = {});
 
 /**
  * \brief Makes the calling (current) thread sleep until some time point is reached.
@@ -103,12 +137,14 @@ void sleepUntil(TickClock::time_point timePoint);
  * \param Duration is a std::chrono::duration type used to measure duration
  *
  * \param [in] timePoint is the time point at which the thread will be woken
+ * \param [in] slack is the max duration by which waking of the thread may be delayed, so that it is coalesced with
+ * other expirations of software timers, default - 0 (waking is never delayed)
  */
 
 template<typename Duration>
-void sleepUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+void sleepUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const TickClock::duration slack = {})
 {
-	sleepUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	sleepUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slack);
 }
 
 /**
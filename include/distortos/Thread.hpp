@@ -8,13 +8,15 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-14
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_THREAD_HPP_
 #define INCLUDE_DISTORTOS_THREAD_HPP_
 
-#include "distortos/ThreadBase.hpp"
+#include "distortos/ThreadCommon.hpp"
+
+#include "distortos/scheduler/ReentStorage.hpp"
 
 namespace distortos
 {
@@ -22,17 +24,19 @@ namespace distortos
 /**
  * \brief Thread class is a templated interface for thread
  *
+ * Thread has thread-specific newlib's _reent structure, kept in the Thread object - separately from stack's buffer.
+ *
  * \param Function is the function that will be executed in separate thread
  * \param Args are the arguments for Function
  */
 
 template<typename Function, typename... Args>
-class Thread : public ThreadBase
+class Thread : public ThreadCommon<Function, Args...>
 {
 public:
 
 	/// base of Thread
-	using Base = ThreadBase;
+	using Base = ThreadCommon<Function, Args...>;
 
 	/**
 	 * \brief Thread's constructor
@@ -49,8 +53,8 @@ public:
 
 	Thread(void* const buffer, const size_t size, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
 			SignalsReceiver* const signalsReceiver, Function&& function, Args&&... args) :
-			ThreadBase{buffer, size, priority, schedulingPolicy, nullptr, signalsReceiver},
-			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+			Base{buffer, size, priority, schedulingPolicy, signalsReceiver, reentStorage_.get(),
+					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
 
 	}
@@ -118,16 +122,8 @@ public:
 
 private:
 
-	/**
-	 * \brief Thread's internal function.
-	 *
-	 * Executes bound function object.
-	 */
-
-	virtual void run() override { boundFunction_(); }
-
-	/// bound function object
-	decltype(std::bind(std::declval<Function>(), std::declval<Args>()...)) boundFunction_;
+	/// storage for thread-specific newlib's _reent structure
+	scheduler::ReentStorage<false> reentStorage_;
 };
 
 /**
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-31
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_THREADBASE_HPP_
@@ -41,10 +41,13 @@ public:
 	 * be added, nullptr to inherit thread group from currently running thread
 	 * \param [in] signalsReceiver is a pointer to SignalsReceiver object for this thread, nullptr to disable reception
 	 * of signals for this thread
+	 * \param [in] reent is a pointer to storage for newlib's _reent structure for this thread, nullptr to share global
+	 * _reent structure with other threads
 	 */
 
 	ThreadBase(void* buffer, size_t size, uint8_t priority, SchedulingPolicy schedulingPolicy,
-			scheduler::ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver);
+			scheduler::ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver,
+			_reent* reent);
 
 	/**
 	 * \brief ThreadBase's constructor.
@@ -56,10 +59,13 @@ public:
 	 * be added, nullptr to inherit thread group from currently running thread
 	 * \param [in] signalsReceiver is a pointer to SignalsReceiver object for this thread, nullptr to disable reception
 	 * of signals for this thread
+	 * \param [in] reent is a pointer to storage for newlib's _reent structure for this thread, nullptr to share global
+	 * _reent structure with other threads
 	 */
 
 	ThreadBase(architecture::Stack&& stack, uint8_t priority, SchedulingPolicy schedulingPolicy,
-			scheduler::ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver);
+			scheduler::ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver,
+			_reent* reent);
 
 	/**
 	 * \brief Generates signal for thread.
@@ -99,6 +105,15 @@ public:
 
 	SignalSet getPendingSignalSet() const;
 
+	/**
+	 * \return preemption threshold of thread, 0 - no preemption threshold
+	 */
+
+	uint8_t getPreemptionThreshold() const
+	{
+		return threadControlBlock_.getPreemptionThreshold();
+	}
+
 	/**
 	 * \return priority of thread
 	 */
@@ -163,6 +178,23 @@ public:
 
 	int queueSignal(uint8_t signalNumber, sigval value) const;
 
+	/**
+	 * \brief Changes preemption threshold of thread.
+	 *
+	 * Similar to ThreadX's preemption-threshold - the thread runs with its priority, but once it is switched to, it can
+	 * be preempted only by threads with priority higher than the threshold. This gives mutual non-preemption of a group
+	 * of threads without changing their priorities, avoiding unnecessary context switches. Threshold stays in effect
+	 * until the thread blocks.
+	 *
+	 * \param [in] preemptionThreshold is the new preemption threshold of thread, thresholds lower or equal to thread's
+	 * effective priority have no effect, 0 - no preemption threshold
+	 */
+
+	void setPreemptionThreshold(const uint8_t preemptionThreshold)
+	{
+		threadControlBlock_.setPreemptionThreshold(preemptionThreshold);
+	}
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
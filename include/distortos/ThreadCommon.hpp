@@ -0,0 +1,83 @@
+/**
+ * \file
+ * \brief ThreadCommon class header
+ *
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADCOMMON_HPP_
+#define INCLUDE_DISTORTOS_THREADCOMMON_HPP_
+
+#include "distortos/ThreadBase.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief ThreadCommon class is a templated common part of Thread and StaticThread - it executes bound function, but
+ * provides no storage for newlib's _reent structure.
+ *
+ * \param Function is the function that will be executed in separate thread
+ * \param Args are the arguments for Function
+ */
+
+template<typename Function, typename... Args>
+class ThreadCommon : public ThreadBase
+{
+public:
+
+	/// base of ThreadCommon
+	using Base = ThreadBase;
+
+	/**
+	 * \brief ThreadCommon's constructor
+	 *
+	 * \param [in] buffer is a pointer to stack's buffer
+	 * \param [in] size is the size of stack's buffer, bytes
+	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] signalsReceiver is a pointer to SignalsReceiver object for this thread, nullptr to disable reception
+	 * of signals for this thread
+	 * \param [in] reent is a pointer to storage for newlib's _reent structure for this thread, nullptr to share global
+	 * _reent structure with other threads
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for function
+	 */
+
+	ThreadCommon(void* const buffer, const size_t size, const uint8_t priority,
+			const SchedulingPolicy schedulingPolicy, SignalsReceiver* const signalsReceiver, _reent* const reent,
+			Function&& function, Args&&... args) :
+			Base{buffer, size, priority, schedulingPolicy, nullptr, signalsReceiver, reent},
+			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+	{
+
+	}
+
+	ThreadCommon(const ThreadCommon&) = delete;
+	ThreadCommon(ThreadCommon&&) = default;
+	const ThreadCommon& operator=(const ThreadCommon&) = delete;
+	ThreadCommon& operator=(ThreadCommon&&) = delete;
+
+private:
+
+	/**
+	 * \brief ThreadCommon's internal function.
+	 *
+	 * Executes bound function object.
+	 */
+
+	virtual void run() override { boundFunction_(); }
+
+	/// bound function object
+	decltype(std::bind(std::declval<Function>(), std::declval<Args>()...)) boundFunction_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_THREADCOMMON_HPP_
@@ -0,0 +1,254 @@
+/**
+ * \file
+ * \brief WaitForAnySet class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_WAITFORANYSET_HPP_
+#define INCLUDE_DISTORTOS_WAITFORANYSET_HPP_
+
+#include "distortos/synchronization/SemaphoreObserver.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace scheduler
+{
+
+class ThreadControlBlockList;
+
+}	// namespace scheduler
+
+/**
+ * \brief WaitForAnySet class is a set of semaphores, which allows a thread to wait until any of them becomes "ready".
+ *
+ * Similar to poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html
+ *
+ * Semaphore is "ready" when its value is positive. Queues (FifoQueue, RawFifoQueue, MessageQueue and RawMessageQueue)
+ * provide their internal semaphores with getPopSemaphore() - such semaphore is "ready" when the queue is not empty.
+ *
+ * While waiting, the thread is registered in each semaphore of the set. Semaphore::post() which increments the value of
+ * the semaphore unblocks the thread, and all registrations are removed when the thread is unblocked (for any reason).
+ *
+ * Waiting doesn't modify the semaphore (or the queue) that became ready. Other threads may consume it before the
+ * unblocked thread gets a chance to run, so the thread should use tryWait() (or tryPop()) on returned object and
+ * repeat the wait if that fails.
+ *
+ * \note Only one thread at a time may wait using the same WaitForAnySet object.
+ */
+
+class WaitForAnySet
+{
+public:
+
+	/**
+	 * \brief WaitForAnySet's constructor
+	 *
+	 * \param [in] observers is a pointer to array of observers, one for each semaphore in the set
+	 * \param [in] count is the number of elements in \a observers array
+	 */
+
+	constexpr WaitForAnySet(synchronization::SemaphoreObserver* const observers, const size_t count) :
+			observers_{observers},
+			count_{count},
+			waitingList_{},
+			readyIndex_{}
+	{
+
+	}
+
+	/**
+	 * \return number of semaphores in the set
+	 */
+
+	size_t getCount() const
+	{
+		return count_;
+	}
+
+	/**
+	 * \brief Tries to find a ready semaphore in the set.
+	 *
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 *
+	 * \return zero if ready semaphore was found, error code otherwise:
+	 * - EAGAIN - no semaphore in the set is ready;
+	 * - EBUSY - other thread is currently waiting using this set;
+	 */
+
+	int tryWait(size_t& index);
+
+	/**
+	 * \brief Tries to wait for any semaphore in the set to become ready for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without any semaphore becoming
+	 * ready
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EBUSY - other thread is currently waiting using this set;
+	 * - ETIMEDOUT - no semaphore in the set became ready before the specified timeout expired;
+	 */
+
+	int tryWaitFor(TickClock::duration duration, size_t& index, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to wait for any semaphore in the set to become ready for a given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration, size_t&, TickClock::duration).
+	 *
+	 * \param Rep is type of tick counter
+	 * \param Period is std::ratio type representing the tick period of the clock, in seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without any semaphore becoming
+	 * ready
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EBUSY - other thread is currently waiting using this set;
+	 * - ETIMEDOUT - no semaphore in the set became ready before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryWaitFor(const std::chrono::duration<Rep, Period> duration, size_t& index,
+			const TickClock::duration slack = {})
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration), index, slack);
+	}
+
+	/**
+	 * \brief Tries to wait for any semaphore in the set to become ready until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without any semaphore becoming
+	 * ready
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EBUSY - other thread is currently waiting using this set;
+	 * - ETIMEDOUT - no semaphore in the set became ready before the specified timeout expired;
+	 */
+
+	int tryWaitUntil(TickClock::time_point timePoint, size_t& index, TickClock::duration slack = {});
+
+	/**
+	 * \brief Tries to wait for any semaphore in the set to become ready until a given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point, size_t&, TickClock::duration).
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without any semaphore becoming
+	 * ready
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, so that it is coalesced
+	 * with other expirations of software timers, default - 0 (termination is never delayed)
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EBUSY - other thread is currently waiting using this set;
+	 * - ETIMEDOUT - no semaphore in the set became ready before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint, size_t& index,
+			const TickClock::duration slack = {})
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), index, slack);
+	}
+
+	/**
+	 * \brief Waits for any semaphore in the set to become ready.
+	 *
+	 * If some semaphores are already ready, the one with the lowest index is returned without blocking.
+	 *
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EBUSY - other thread is currently waiting using this set;
+	 */
+
+	int wait(size_t& index);
+
+	WaitForAnySet(const WaitForAnySet&) = delete;
+	WaitForAnySet(WaitForAnySet&&) = delete;
+	const WaitForAnySet& operator=(const WaitForAnySet&) = delete;
+	WaitForAnySet& operator=(WaitForAnySet&&) = delete;
+
+private:
+
+	friend class Semaphore;
+
+	class UnblockFunctor;
+
+	/**
+	 * \brief Removes all observers of the set from their semaphores.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 */
+
+	void detach();
+
+	/**
+	 * \brief Called by Semaphore::post() when value of semaphore with registered observer was incremented.
+	 *
+	 * Saves index of ready semaphore and unblocks waiting thread, which removes all observers of the set.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \param [in] observer is a reference to observer registered in the semaphore that became ready
+	 */
+
+	void notify(const synchronization::SemaphoreObserver& observer);
+
+	/**
+	 * \brief Implementation of wait(), tryWait() and tryWaitUntil().
+	 *
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode
+	 * is selected, nullptr to block without timeout
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if
+	 * \a timePoint is not nullptr
+	 * \param [out] index is a reference to variable in which index of ready semaphore will be returned
+	 *
+	 * \return zero if any semaphore in the set is ready, error code otherwise:
+	 * - EAGAIN - no semaphore in the set is ready and non-blocking mode was selected;
+	 * - EBUSY - other thread is currently waiting using this set;
+	 * - ETIMEDOUT - no semaphore in the set became ready before \a timePoint;
+	 */
+
+	int waitImplementation(bool nonBlocking, const TickClock::time_point* timePoint, TickClock::duration slack,
+			size_t& index);
+
+	/// pointer to array of observers, one for each semaphore in the set
+	synchronization::SemaphoreObserver* const observers_;
+
+	/// number of elements in \a observers_ array
+	const size_t count_;
+
+	/// pointer to list with thread waiting using this set, nullptr if no thread is waiting
+	scheduler::ThreadControlBlockList* waitingList_;
+
+	/// index of semaphore that became ready while the thread was waiting
+	size_t readyIndex_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WAITFORANYSET_HPP_
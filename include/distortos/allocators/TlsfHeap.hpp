@@ -0,0 +1,251 @@
+/**
+ * \file
+ * \brief TlsfHeap class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-28
+ */
+
+#ifndef INCLUDE_DISTORTOS_ALLOCATORS_TLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_ALLOCATORS_TLSFHEAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace allocators
+{
+
+/**
+ * \brief TlsfHeap class is a heap with "two-level segregated fit" allocation algorithm.
+ *
+ * Free blocks are kept on segregated lists - first level splits sizes into powers of two, second level splits each
+ * power of two into \a secondLevelCount linear ranges. Bitmaps of non-empty lists allow finding suitable free block with
+ * a few bit-scan instructions, so allocate() and deallocate() execute in constant time, independent of the number of
+ * blocks. Adjacent free blocks are merged immediately.
+ *
+ * \note This class is not thread-safe - concurrent access must be serialized by the caller.
+ */
+
+class TlsfHeap
+{
+public:
+
+	/// statistics of the heap
+	struct Statistics
+	{
+		/// size of area managed by the heap, bytes
+		size_t totalSize;
+
+		/// total size of free blocks (excluding headers), bytes
+		size_t freeSize;
+
+		/// lowest value of \a freeSize since the heap was constructed, bytes
+		size_t minimumFreeSize;
+
+		/// size of the largest free block (excluding header), bytes
+		size_t largestFreeBlock;
+
+		/// number of free blocks
+		size_t freeBlocks;
+
+		/// number of allocated blocks
+		size_t usedBlocks;
+
+		/// fragmentation of free space - 0 if all free space is in a single block, approaching 100 if free space is
+		/// scattered among many small blocks, percent
+		uint8_t fragmentation;
+	};
+
+	/// alignment of all blocks, bytes
+	constexpr static size_t alignment {8};
+
+	/**
+	 * \brief TlsfHeap's constructor
+	 *
+	 * \param [in] storage is a pointer to memory area managed by the heap
+	 * \param [in] size is the size of \a storage, bytes
+	 */
+
+	TlsfHeap(void* storage, size_t size);
+
+	/**
+	 * \brief Allocates block of memory.
+	 *
+	 * \param [in] size is the requested size of block, bytes
+	 *
+	 * \return pointer to allocated block (aligned to \a alignment), nullptr if there is no free block large enough
+	 */
+
+	void* allocate(size_t size);
+
+	/**
+	 * \brief Allocates block of memory with requested alignment.
+	 *
+	 * \param [in] blockAlignment is the requested alignment of block, must be a power of two
+	 * \param [in] size is the requested size of block, bytes
+	 *
+	 * \return pointer to allocated block, nullptr if there is no free block large enough
+	 */
+
+	void* allocateAligned(size_t blockAlignment, size_t size);
+
+	/**
+	 * \brief Deallocates block of memory.
+	 *
+	 * \param [in] storage is a pointer to block previously returned by allocate(), allocateAligned() or resize(),
+	 * nullptr is ignored
+	 */
+
+	void deallocate(void* storage);
+
+	/**
+	 * \param [in] storage is a pointer to allocated block
+	 *
+	 * \return usable size of allocated block, bytes
+	 */
+
+	static size_t getBlockSize(const void* storage);
+
+	/**
+	 * \brief Gets statistics of the heap.
+	 *
+	 * \note Finding the largest free block requires walking one segregated list, all other values are maintained on the
+	 * fly.
+	 *
+	 * \return statistics of the heap
+	 */
+
+	Statistics getStatistics() const;
+
+	/**
+	 * \brief Tries to resize allocated block in place.
+	 *
+	 * Block is shrunk if \a size is smaller than current size, or grown by absorbing next physical block if it is free
+	 * and large enough.
+	 *
+	 * \param [in] storage is a pointer to allocated block
+	 * \param [in] size is the requested size of block, bytes
+	 *
+	 * \return true if block was resized, false otherwise (block is not modified in that case)
+	 */
+
+	bool resize(void* storage, size_t size);
+
+	TlsfHeap(const TlsfHeap&) = delete;
+	TlsfHeap(TlsfHeap&&) = delete;
+	const TlsfHeap& operator=(const TlsfHeap&) = delete;
+	TlsfHeap& operator=(TlsfHeap&&) = delete;
+
+private:
+
+	struct Block;
+
+	/// log2 of number of second level lists for each first level
+	constexpr static size_t secondLevelCountLog2 {4};
+
+	/// number of second level lists for each first level
+	constexpr static size_t secondLevelCount {1 << secondLevelCountLog2};
+
+	/// log2 of the smallest size handled by first level lists other than the first one
+	constexpr static size_t firstLevelShift {secondLevelCountLog2 + 3};
+
+	/// log2 of max size of block, 16 MB is more than enough for any microcontroller
+	constexpr static size_t firstLevelMax {24};
+
+	/// number of first level lists
+	constexpr static size_t firstLevelCount {firstLevelMax - firstLevelShift + 1};
+
+	/**
+	 * \brief Finds free block which is large enough for requested size and removes it from its list.
+	 *
+	 * \param [in] size is the requested size of block (already adjusted), bytes
+	 *
+	 * \return pointer to found block, nullptr if there is no free block large enough
+	 */
+
+	Block* findAndRemoveFreeBlock(size_t size);
+
+	/**
+	 * \brief Inserts free block to proper segregated list.
+	 *
+	 * \param [in] block is a pointer to inserted block
+	 */
+
+	void insertFreeBlock(Block* block);
+
+	/**
+	 * \brief Marks block as used, splitting the unneeded tail as a new free block.
+	 *
+	 * \param [in] block is a pointer to block which is not on any free list
+	 * \param [in] size is the requested size of block (already adjusted), bytes
+	 *
+	 * \return pointer to usable storage of block
+	 */
+
+	void* markUsed(Block* block, size_t size);
+
+	/**
+	 * \brief Merges free block with next physical block, if it is also free.
+	 *
+	 * \param [in] block is a pointer to block which is not on any free list
+	 */
+
+	void mergeWithNext(Block* block);
+
+	/**
+	 * \brief Removes free block from its segregated list.
+	 *
+	 * \param [in] block is a pointer to removed block
+	 */
+
+	void removeFreeBlock(Block* block);
+
+	/**
+	 * \brief Splits block, creating a new free block from the tail (if it's large enough).
+	 *
+	 * \param [in] block is a pointer to split block
+	 * \param [in] size is the new size of \a block, bytes
+	 *
+	 * \return pointer to new block created from the tail (not inserted to any list), nullptr if the tail is too small
+	 */
+
+	Block* split(Block* block, size_t size);
+
+	/// lists of free blocks, indexed with first and second level indexes
+	Block* freeLists_[firstLevelCount][secondLevelCount];
+
+	/// bitmaps of non-empty second level lists, one for each first level
+	uint32_t secondLevelBitmaps_[firstLevelCount];
+
+	/// bitmap of first levels with at least one non-empty second level list
+	uint32_t firstLevelBitmap_;
+
+	/// size of area managed by the heap, bytes
+	size_t totalSize_;
+
+	/// total size of free blocks (excluding headers), bytes
+	size_t freeSize_;
+
+	/// lowest value of \a freeSize_ since the heap was constructed, bytes
+	size_t minimumFreeSize_;
+
+	/// number of free blocks
+	size_t freeBlocks_;
+
+	/// number of allocated blocks
+	size_t usedBlocks_;
+};
+
+}	// namespace allocators
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ALLOCATORS_TLSFHEAP_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-07
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGLOCK_HPP_
@@ -26,7 +26,31 @@ namespace architecture
 /// InterruptMaskingLock class is a RAII wrapper for enableInterruptMasking() / restoreInterruptMasking()
 class InterruptMaskingLock : private InterruptMaskingUnmaskingLock<enableInterruptMasking>
 {
+public:
 
+	/**
+	 * \brief InterruptMaskingLock's constructor
+	 *
+	 * \note Always inlined, see InterruptMaskingUnmaskingLock.
+	 */
+
+	__attribute__ ((always_inline))
+	InterruptMaskingLock()
+	{
+
+	}
+
+	/**
+	 * \brief InterruptMaskingLock's destructor
+	 *
+	 * \note Always inlined, see InterruptMaskingUnmaskingLock.
+	 */
+
+	__attribute__ ((always_inline))
+	~InterruptMaskingLock()
+	{
+
+	}
 };
 
 }	// namespace architecture
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGUNMASKINGLOCK_HPP_
@@ -16,6 +16,14 @@
 
 #include "distortos/architecture/restoreInterruptMasking.hpp"
 
+#include "distortos/architecture/interruptMaskingProfiler.hpp"
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include "distortos/architecture/enableInterruptMasking.hpp"
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 namespace distortos
 {
 
@@ -25,6 +33,11 @@ namespace architecture
 /**
  * \brief InterruptMaskingUnmaskingLock class is a RAII wrapper for interrupt mask manipulation.
  *
+ * If CONFIG_INTERRUPT_MASKING_PROFILER == 1, each transition of interrupt masking between disabled and enabled state
+ * done by this class starts or finishes an interrupt masking section measured by the profiler. All functions of this
+ * class (and of derived classes) are always inlined, so that the return address of startInterruptMaskingSection() -
+ * used as call site of the section - points into the function which uses the lock, not into the lock itself.
+ *
  * \param Function is a reference to function which modifies interrupt mask and returns InterruptMask;
  * enableInterruptMasking() or disableInterruptMasking() should be used
  */
@@ -40,8 +53,9 @@ public:
 	 * Enables/disables interrupt masking, saving current interrupt mask for use in destructor.
 	 */
 
+	__attribute__ ((always_inline))
 	InterruptMaskingUnmaskingLock() :
-			interruptMask_{Function()}
+			interruptMask_{modifyInterruptMasking()}
 	{}
 
 	/**
@@ -50,9 +64,25 @@ public:
 	 * Restores previous interrupt masking state by restoring interrupt mask saved in constructor.
 	 */
 
+	__attribute__ ((always_inline))
 	~InterruptMaskingUnmaskingLock()
 	{
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+		const auto wasMasked = interruptMask_ != InterruptMask{};
+		if (masking == true && wasMasked == false)
+			finishInterruptMaskingSection();
+
 		restoreInterruptMasking(interruptMask_);
+
+		if (masking == false && wasMasked == true)
+			startInterruptMaskingSection();
+
+#else	// CONFIG_INTERRUPT_MASKING_PROFILER != 1
+
+		restoreInterruptMasking(interruptMask_);
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER != 1
 	}
 
 	InterruptMaskingUnmaskingLock(const InterruptMaskingUnmaskingLock&) = delete;
@@ -62,6 +92,41 @@ public:
 
 private:
 
+	/**
+	 * \brief Enables/disables interrupt masking with \a Function.
+	 *
+	 * \return previous value of interrupts' mask
+	 */
+
+	__attribute__ ((always_inline))
+	static InterruptMask modifyInterruptMasking()
+	{
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+		if (masking == false)
+			finishInterruptMaskingSection();
+
+		const auto interruptMask = Function();
+
+		if (masking == true && interruptMask == InterruptMask{})
+			startInterruptMaskingSection();
+
+		return interruptMask;
+
+#else	// CONFIG_INTERRUPT_MASKING_PROFILER != 1
+
+		return Function();
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER != 1
+	}
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+	/// true if \a Function enables interrupt masking, false if it disables interrupt masking
+	constexpr static bool masking {&Function == &enableInterruptMasking};
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 	/// interrupt mask
 	const InterruptMask interruptMask_;
 };
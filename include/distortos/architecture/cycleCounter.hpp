@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief enableCycleCounter() and getCycleCount() declarations
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_CYCLECOUNTER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_CYCLECOUNTER_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Enables cycle counter.
+ *
+ * Must be called (once) before getCycleCount() is used. If the core doesn't provide working cycle counter (e.g. when
+ * executed in a simulator), cycle count is emulated with the tick timer.
+ *
+ * \return true if cycle counter of the core is used, false if cycle count is emulated
+ */
+
+bool enableCycleCounter();
+
+/**
+ * \brief Gets current value of cycle counter.
+ *
+ * The value wraps around, so only differences of values obtained with this function are meaningful (as long as the
+ * measured interval is shorter than period of the counter).
+ *
+ * \return current value of cycle counter
+ */
+
+uint32_t getCycleCount();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_CYCLECOUNTER_HPP_
@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \brief Declarations of interrupt masking profiler
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGPROFILER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGPROFILER_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include <array>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// InterruptMaskingSection holds duration and call site of single interrupt masking section
+struct InterruptMaskingSection
+{
+	/// duration of section, cycles of getCycleCount()
+	uint32_t duration;
+
+	/// address of code which started the section (just after the call to startInterruptMaskingSection()), nullptr if
+	/// entry is unused
+	const void* callSite;
+};
+
+/// the longest interrupt masking sections (each with distinct call site), sorted by decreasing duration
+using InterruptMaskingProfile = std::array<InterruptMaskingSection, CONFIG_INTERRUPT_MASKING_PROFILER_ENTRIES>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Finishes current interrupt masking section and records its duration if it is one of the longest.
+ *
+ * Does nothing if no section was started.
+ *
+ * \attention This function must be called with enabled interrupt masking, just before it is disabled.
+ */
+
+void finishInterruptMaskingSection();
+
+/**
+ * \return copy of profile with the longest interrupt masking sections
+ *
+ * \attention This function must be called with enabled interrupt masking.
+ */
+
+InterruptMaskingProfile getInterruptMaskingProfile();
+
+/**
+ * \brief Clears all recorded interrupt masking sections.
+ *
+ * \attention This function must be called with enabled interrupt masking.
+ */
+
+void resetInterruptMaskingProfile();
+
+/**
+ * \brief Starts new interrupt masking section.
+ *
+ * Return address of this function is used as call site of the section - InterruptMaskingUnmaskingLock's functions are
+ * always inlined, so this address points into the function which enabled interrupt masking.
+ *
+ * \attention This function must be called with enabled interrupt masking, just after it is enabled.
+ */
+
+void startInterruptMaskingSection();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGPROFILER_HPP_
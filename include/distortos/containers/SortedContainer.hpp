@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-15
+ * \date 2015-06-13
  */
 
 #ifndef INCLUDE_DISTORTOS_CONTAINERS_SORTEDCONTAINER_HPP_
@@ -200,6 +200,9 @@ protected:
  *
  * \note The elements are sorted as long as the user does not modify the contents via iterators.
  *
+ * \note Insert position is found with linear search. SortedSkipList and SortedPairingHeap provide the same interface
+ * with faster insertion for long lists - their latencies are compared by SortedContainerHoldBenchmarkCase.
+ *
  * \param Container is the underlying container, it must provide following functions: begin(), emplace(), empty(),
  * end(), pop_front() and splice(). It must contain following types: allocator_type, const_iterator, iterator and
  * value_type. Optionally functions erase() and size() of Container are forwarded if they exist.
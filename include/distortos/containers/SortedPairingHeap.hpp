@@ -0,0 +1,538 @@
+/**
+ * \file
+ * \brief SortedPairingHeap class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#ifndef INCLUDE_DISTORTOS_CONTAINERS_SORTEDPAIRINGHEAP_HPP_
+#define INCLUDE_DISTORTOS_CONTAINERS_SORTEDPAIRINGHEAP_HPP_
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace containers
+{
+
+/**
+ * \brief SortedPairingHeap class is a pairing heap that keeps the first element available during emplace or transfer.
+ *
+ * It provides the same interface as SortedContainer - sortedEmplace(), sortedSplice(), begin(), empty(), end(),
+ * erase(), pop_front() and size() - so it can be used as an alternative backend for sorted lists that only need access
+ * to their first element. Insertion and transfer are O(1), removal of the first element or of arbitrary element is
+ * O(log n) amortized. Elements are not kept in sorted sequence, so iterators cannot be incremented - begin() gives
+ * access only to the first element.
+ *
+ * Each inserted element gets a sequence number which is used to resolve ties between "equal" elements, so the order
+ * of equal elements is FIFO - just like in SortedContainer. Sequence numbers are compared with wrap-around, so the
+ * order is correct as long as the number of insertions between the oldest and the newest element in the heap is less
+ * than 2^31.
+ *
+ * \param T is the type of elements
+ * \param Compare is a type of functor used for comparison, std::less results in descending order, std::greater - in
+ * ascending order.
+ * \param Allocator is the allocator of T, rebound to internal node type, all containers between which the elements
+ * are transfered must use allocators that compare equal
+ */
+
+template<typename T, typename Compare, typename Allocator = std::allocator<T>>
+class SortedPairingHeap
+{
+	/// node of the pairing heap
+	struct Node
+	{
+		/**
+		 * \brief Node's constructor
+		 *
+		 * \param Args are types of argument for T constructor
+		 *
+		 * \param [in] args are arguments for T constructor
+		 */
+
+		template<typename... Args>
+		Node(Args&&... args) :
+				value(std::forward<Args>(args)...),
+				child{},
+				next{},
+				previous{},
+				sequence{}
+		{
+
+		}
+
+		/// element kept in the node
+		T value;
+
+		/// first child of the node
+		Node* child;
+
+		/// next sibling of the node
+		Node* next;
+
+		/// previous sibling of the node or its parent if this node is the first child
+		Node* previous;
+
+		/// sequence number used to resolve ties between "equal" elements
+		uint32_t sequence;
+	};
+
+	/**
+	 * \brief Iterator class is an iterator of element of SortedPairingHeap.
+	 *
+	 * Iterator can only be dereferenced and compared, it cannot be incremented.
+	 *
+	 * \param Const selects whether the iterator gives access to const element (true) or not (false)
+	 */
+
+	template<bool Const>
+	class Iterator
+	{
+		friend SortedPairingHeap;
+
+		template<bool>
+		friend class Iterator;
+
+		/// pointer to node
+		using NodePointer = typename std::conditional<Const == true, const Node*, Node*>::type;
+
+	public:
+
+		/// type of element
+		using value_type = T;
+
+		/// pointer to element
+		using pointer = typename std::conditional<Const == true, const T*, T*>::type;
+
+		/// reference to element
+		using reference = typename std::conditional<Const == true, const T&, T&>::type;
+
+		/**
+		 * \brief Iterator's constructor
+		 *
+		 * \param [in] node is a pointer to node, nullptr for iterator pointing to end
+		 */
+
+		constexpr explicit Iterator(const NodePointer node = {}) :
+				node_{node}
+		{
+
+		}
+
+		/**
+		 * \brief Iterator's converting constructor
+		 *
+		 * Used to convert non-const iterator to const iterator.
+		 *
+		 * \param [in] other is a reference to non-const iterator
+		 */
+
+		template<bool C = Const, typename = typename std::enable_if<C == true>::type>
+		constexpr Iterator(const Iterator<false>& other) :
+				node_{other.node_}
+		{
+
+		}
+
+		/**
+		 * \return reference to element
+		 */
+
+		reference operator*() const
+		{
+			return node_->value;
+		}
+
+		/**
+		 * \return pointer to element
+		 */
+
+		pointer operator->() const
+		{
+			return &node_->value;
+		}
+
+		/**
+		 * \param [in] other is a reference to other iterator
+		 *
+		 * \return true if both iterators point to the same element, false otherwise
+		 */
+
+		bool operator==(const Iterator& other) const
+		{
+			return node_ == other.node_;
+		}
+
+		/**
+		 * \param [in] other is a reference to other iterator
+		 *
+		 * \return true if iterators point to different elements, false otherwise
+		 */
+
+		bool operator!=(const Iterator& other) const
+		{
+			return node_ != other.node_;
+		}
+
+	private:
+
+		/// pointer to node, nullptr for iterator pointing to end
+		NodePointer node_;
+	};
+
+	/// allocator of nodes
+	using NodeAllocator = typename Allocator::template rebind<Node>::other;
+
+public:
+
+	/// iterator
+	using iterator = Iterator<false>;
+
+	/// const_iterator
+	using const_iterator = Iterator<true>;
+
+	/// value_type
+	using value_type = T;
+
+	/// allocator_type
+	using allocator_type = Allocator;
+
+	/// size_type
+	using size_type = size_t;
+
+	/**
+	 * \brief SortedPairingHeap's constructor
+	 *
+	 * \param [in] allocator is a reference to allocator_type object used to copy-construct allocator of nodes
+	 */
+
+	explicit SortedPairingHeap(const allocator_type& allocator) :
+			SortedPairingHeap{Compare{}, allocator}
+	{
+
+	}
+
+	/**
+	 * \brief SortedPairingHeap's constructor
+	 *
+	 * \param [in] compare is a reference to Compare object used to copy-construct comparison functor
+	 * \param [in] allocator is a reference to allocator_type object used to copy-construct allocator of nodes
+	 */
+
+	explicit SortedPairingHeap(const Compare& compare = Compare{},
+			const allocator_type& allocator = allocator_type{}) :
+			root_{},
+			size_{},
+			allocator_(allocator),
+			compare_(compare),
+			sequence_{}
+	{
+
+	}
+
+	/**
+	 * \brief SortedPairingHeap's destructor
+	 *
+	 * Destroys all elements.
+	 */
+
+	~SortedPairingHeap()
+	{
+		while (empty() == false)
+			pop_front();
+	}
+
+	/**
+	 * \return iterator to first element
+	 */
+
+	iterator begin()
+	{
+		return iterator{root_};
+	}
+
+	/**
+	 * \return const iterator to first element
+	 */
+
+	const_iterator begin() const
+	{
+		return const_iterator{root_};
+	}
+
+	/**
+	 * \return true if container is empty, false otherwise
+	 */
+
+	bool empty() const
+	{
+		return root_ == nullptr;
+	}
+
+	/**
+	 * \return iterator which is not associated with any element
+	 */
+
+	iterator end()
+	{
+		return iterator{};
+	}
+
+	/**
+	 * \return const iterator which is not associated with any element
+	 */
+
+	const_iterator end() const
+	{
+		return const_iterator{};
+	}
+
+	/**
+	 * \brief Destroys selected element.
+	 *
+	 * \param [in] position is the iterator of destroyed element
+	 */
+
+	void erase(const const_iterator position)
+	{
+		const auto node = const_cast<Node*>(position.node_);
+		unlink(*node);
+		destroy(*node);
+	}
+
+	/**
+	 * \brief Destroys first element.
+	 */
+
+	void pop_front()
+	{
+		const auto node = root_;
+		unlink(*node);
+		destroy(*node);
+	}
+
+	/**
+	 * \return number of elements in the container
+	 */
+
+	size_type size() const
+	{
+		return size_;
+	}
+
+	/**
+	 * \brief Sorted emplace()
+	 *
+	 * \param Args are types of argument for value_type constructor
+	 *
+	 * \param [in] args are arguments for value_type constructor
+	 *
+	 * \return iterator to emplaced element
+	 */
+
+	template<typename... Args>
+	iterator sortedEmplace(Args&&... args)
+	{
+		const auto node = allocator_.allocate(1);
+		allocator_.construct(node, std::forward<Args>(args)...);
+		link(*node);
+		return iterator{node};
+	}
+
+	/**
+	 * \brief Sorted splice()
+	 *
+	 * \param [in] other is the container from which the object is transfered
+	 * \param [in] otherPosition is the position of the transfered object in the other container
+	 */
+
+	void sortedSplice(SortedPairingHeap& other, const iterator otherPosition)
+	{
+		other.unlink(*otherPosition.node_);
+		link(*otherPosition.node_);
+	}
+
+	SortedPairingHeap(const SortedPairingHeap&) = delete;
+	SortedPairingHeap(SortedPairingHeap&&) = delete;
+	const SortedPairingHeap& operator=(const SortedPairingHeap&) = delete;
+	SortedPairingHeap& operator=(SortedPairingHeap&&) = delete;
+
+private:
+
+	/**
+	 * \brief Destroys node and deallocates its storage.
+	 *
+	 * \param [in] node is a reference to destroyed node, it must not be linked in the container
+	 */
+
+	void destroy(Node& node)
+	{
+		allocator_.destroy(&node);
+		allocator_.deallocate(&node, 1);
+	}
+
+	/**
+	 * \brief Links the node into the container.
+	 *
+	 * \param [in] node is a reference to linked node
+	 */
+
+	void link(Node& node)
+	{
+		node.child = {};
+		node.next = {};
+		node.previous = {};
+		node.sequence = sequence_++;
+		root_ = meld(root_, &node);
+		++size_;
+	}
+
+	/**
+	 * \brief Melds two heaps.
+	 *
+	 * \param [in] left is a pointer to root of first heap, may be nullptr
+	 * \param [in] right is a pointer to root of second heap, may be nullptr
+	 *
+	 * \return pointer to root of melded heap
+	 */
+
+	Node* meld(Node* left, Node* right) const
+	{
+		if (left == nullptr)
+			return right;
+		if (right == nullptr)
+			return left;
+
+		if (precedes(*right, *left) == true)
+			std::swap(left, right);
+
+		right->previous = left;
+		right->next = left->child;
+		if (left->child != nullptr)
+			left->child->previous = right;
+		left->child = right;
+		return left;
+	}
+
+	/**
+	 * \brief Melds list of sibling heaps with standard two-pass method.
+	 *
+	 * \param [in] first is a pointer to first heap on the list of siblings, may be nullptr
+	 *
+	 * \return pointer to root of melded heap
+	 */
+
+	Node* meldSiblings(Node* first) const
+	{
+		// first pass - meld pairs from left to right, results are collected on a list in reverse order
+		Node* pairs {};
+		while (first != nullptr)
+		{
+			const auto left = first;
+			const auto right = left->next;
+			first = right != nullptr ? right->next : nullptr;
+
+			left->next = {};
+			left->previous = {};
+			if (right != nullptr)
+			{
+				right->next = {};
+				right->previous = {};
+			}
+
+			const auto pair = meld(left, right);
+			pair->next = pairs;
+			pairs = pair;
+		}
+
+		// second pass - meld results from right to left
+		Node* root {};
+		while (pairs != nullptr)
+		{
+			const auto pair = pairs;
+			pairs = pair->next;
+			pair->next = {};
+			root = meld(root, pair);
+		}
+
+		return root;
+	}
+
+	/**
+	 * \param [in] left is a reference to node on the left side of comparison
+	 * \param [in] right is a reference to node on the right side of comparison
+	 *
+	 * \return true if \a left should precede \a right in sorted sequence, false otherwise
+	 */
+
+	bool precedes(const Node& left, const Node& right) const
+	{
+		if (compare_(right.value, left.value) == true)
+			return true;
+		if (compare_(left.value, right.value) == true)
+			return false;
+
+		return static_cast<int32_t>(left.sequence - right.sequence) < 0;
+	}
+
+	/**
+	 * \brief Unlinks the node from the container.
+	 *
+	 * \param [in] node is a reference to unlinked node, it must be linked in the container
+	 */
+
+	void unlink(Node& node)
+	{
+		if (&node == root_)
+			root_ = meldSiblings(node.child);
+		else
+		{
+			if (node.previous->child == &node)
+				node.previous->child = node.next;
+			else
+				node.previous->next = node.next;
+			if (node.next != nullptr)
+				node.next->previous = node.previous;
+
+			root_ = meld(root_, meldSiblings(node.child));
+		}
+
+		node.child = {};
+		node.next = {};
+		node.previous = {};
+		--size_;
+	}
+
+	/// root of the heap - first element
+	Node* root_;
+
+	/// number of elements in the container
+	size_type size_;
+
+	/// allocator of nodes
+	NodeAllocator allocator_;
+
+	/// instance of functor used for comparison
+	Compare compare_;
+
+	/// sequence number of next linked node
+	uint32_t sequence_;
+};
+
+}	// namespace containers
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_CONTAINERS_SORTEDPAIRINGHEAP_HPP_
@@ -0,0 +1,528 @@
+/**
+ * \file
+ * \brief SortedSkipList class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-13
+ */
+
+#ifndef INCLUDE_DISTORTOS_CONTAINERS_SORTEDSKIPLIST_HPP_
+#define INCLUDE_DISTORTOS_CONTAINERS_SORTEDSKIPLIST_HPP_
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace containers
+{
+
+/**
+ * \brief SortedSkipList class is a skip list that keeps the elements sorted during emplace or transfer.
+ *
+ * It provides the same interface as SortedContainer - sortedEmplace(), sortedSplice(), begin(), empty(), end(),
+ * erase(), pop_front() and size() - so it can be used as an alternative backend for sorted lists, but the insert
+ * position is found in O(log n) expected time instead of O(n). Element inserted with the same key as elements already
+ * in the container is placed after all of them, so the order of equal elements is FIFO - just like in SortedContainer.
+ * Removal of the first element is O(1) - as many links as there are levels of removed node are updated.
+ *
+ * Each node has storage for \a MaxLevel links - height of the node is selected pseudo-randomly (with deterministic
+ * generator) with probability of each next level equal to 1/4. The container is efficient for up to about
+ * 4^MaxLevel elements.
+ *
+ * \param T is the type of elements
+ * \param Compare is a type of functor used for comparison, std::less results in descending order, std::greater - in
+ * ascending order.
+ * \param Allocator is the allocator of T, rebound to internal node type, all containers between which the elements
+ * are transfered must use allocators that compare equal
+ * \param MaxLevel is the max number of levels of the skip list, [1; UINT8_MAX]
+ */
+
+template<typename T, typename Compare, typename Allocator = std::allocator<T>, uint8_t MaxLevel = 6>
+class SortedSkipList
+{
+	static_assert(MaxLevel != 0, "MaxLevel must not be zero!");
+
+	/// node of the skip list
+	struct Node
+	{
+		/**
+		 * \brief Node's constructor
+		 *
+		 * \param Args are types of argument for T constructor
+		 *
+		 * \param [in] heightValue is the number of levels on which this node is linked, [1; MaxLevel]
+		 * \param [in] args are arguments for T constructor
+		 */
+
+		template<typename... Args>
+		Node(const uint8_t heightValue, Args&&... args) :
+				value(std::forward<Args>(args)...),
+				next{},
+				height{heightValue}
+		{
+
+		}
+
+		/// element kept in the node
+		T value;
+
+		/// links to next nodes on each level
+		Node* next[MaxLevel];
+
+		/// number of levels on which this node is linked
+		uint8_t height;
+	};
+
+	/**
+	 * \brief Iterator class is a forward iterator over elements of SortedSkipList.
+	 *
+	 * \param Const selects whether the iterator gives access to const elements (true) or not (false)
+	 */
+
+	template<bool Const>
+	class Iterator
+	{
+		friend SortedSkipList;
+
+		template<bool>
+		friend class Iterator;
+
+		/// pointer to node
+		using NodePointer = typename std::conditional<Const == true, const Node*, Node*>::type;
+
+	public:
+
+		/// iterator category
+		using iterator_category = std::forward_iterator_tag;
+
+		/// type of element
+		using value_type = T;
+
+		/// type of difference between iterators
+		using difference_type = std::ptrdiff_t;
+
+		/// pointer to element
+		using pointer = typename std::conditional<Const == true, const T*, T*>::type;
+
+		/// reference to element
+		using reference = typename std::conditional<Const == true, const T&, T&>::type;
+
+		/**
+		 * \brief Iterator's constructor
+		 *
+		 * \param [in] node is a pointer to node, nullptr for iterator pointing to end
+		 */
+
+		constexpr explicit Iterator(const NodePointer node = {}) :
+				node_{node}
+		{
+
+		}
+
+		/**
+		 * \brief Iterator's converting constructor
+		 *
+		 * Used to convert non-const iterator to const iterator.
+		 *
+		 * \param [in] other is a reference to non-const iterator
+		 */
+
+		template<bool C = Const, typename = typename std::enable_if<C == true>::type>
+		constexpr Iterator(const Iterator<false>& other) :
+				node_{other.node_}
+		{
+
+		}
+
+		/**
+		 * \return reference to element
+		 */
+
+		reference operator*() const
+		{
+			return node_->value;
+		}
+
+		/**
+		 * \return pointer to element
+		 */
+
+		pointer operator->() const
+		{
+			return &node_->value;
+		}
+
+		/**
+		 * \brief Pre-increment operator
+		 *
+		 * \return reference to this iterator, advanced to next element
+		 */
+
+		Iterator& operator++()
+		{
+			node_ = node_->next[0];
+			return *this;
+		}
+
+		/**
+		 * \brief Post-increment operator
+		 *
+		 * \return copy of this iterator before it was advanced to next element
+		 */
+
+		Iterator operator++(int)
+		{
+			const auto copy = *this;
+			++*this;
+			return copy;
+		}
+
+		/**
+		 * \param [in] other is a reference to other iterator
+		 *
+		 * \return true if both iterators point to the same element, false otherwise
+		 */
+
+		bool operator==(const Iterator& other) const
+		{
+			return node_ == other.node_;
+		}
+
+		/**
+		 * \param [in] other is a reference to other iterator
+		 *
+		 * \return true if iterators point to different elements, false otherwise
+		 */
+
+		bool operator!=(const Iterator& other) const
+		{
+			return node_ != other.node_;
+		}
+
+	private:
+
+		/// pointer to node, nullptr for iterator pointing to end
+		NodePointer node_;
+	};
+
+	/// allocator of nodes
+	using NodeAllocator = typename Allocator::template rebind<Node>::other;
+
+public:
+
+	/// iterator
+	using iterator = Iterator<false>;
+
+	/// const_iterator
+	using const_iterator = Iterator<true>;
+
+	/// value_type
+	using value_type = T;
+
+	/// allocator_type
+	using allocator_type = Allocator;
+
+	/// size_type
+	using size_type = size_t;
+
+	/**
+	 * \brief SortedSkipList's constructor
+	 *
+	 * \param [in] allocator is a reference to allocator_type object used to copy-construct allocator of nodes
+	 */
+
+	explicit SortedSkipList(const allocator_type& allocator) :
+			SortedSkipList{Compare{}, allocator}
+	{
+
+	}
+
+	/**
+	 * \brief SortedSkipList's constructor
+	 *
+	 * \param [in] compare is a reference to Compare object used to copy-construct comparison functor
+	 * \param [in] allocator is a reference to allocator_type object used to copy-construct allocator of nodes
+	 */
+
+	explicit SortedSkipList(const Compare& compare = Compare{}, const allocator_type& allocator = allocator_type{}) :
+			head_{},
+			size_{},
+			allocator_(allocator),
+			compare_(compare),
+			random_{UINT32_C(0x9e3779b9)}
+	{
+
+	}
+
+	/**
+	 * \brief SortedSkipList's destructor
+	 *
+	 * Destroys all elements.
+	 */
+
+	~SortedSkipList()
+	{
+		while (empty() == false)
+			pop_front();
+	}
+
+	/**
+	 * \return iterator to first element
+	 */
+
+	iterator begin()
+	{
+		return iterator{head_[0]};
+	}
+
+	/**
+	 * \return const iterator to first element
+	 */
+
+	const_iterator begin() const
+	{
+		return const_iterator{head_[0]};
+	}
+
+	/**
+	 * \return true if container is empty, false otherwise
+	 */
+
+	bool empty() const
+	{
+		return head_[0] == nullptr;
+	}
+
+	/**
+	 * \return iterator to element following the last element
+	 */
+
+	iterator end()
+	{
+		return iterator{};
+	}
+
+	/**
+	 * \return const iterator to element following the last element
+	 */
+
+	const_iterator end() const
+	{
+		return const_iterator{};
+	}
+
+	/**
+	 * \brief Destroys selected element.
+	 *
+	 * \param [in] position is the iterator of destroyed element
+	 *
+	 * \return iterator to element following the destroyed one
+	 */
+
+	iterator erase(const const_iterator position)
+	{
+		const auto node = const_cast<Node*>(position.node_);
+		const iterator next {node->next[0]};
+		unlink(*node);
+		destroy(*node);
+		return next;
+	}
+
+	/**
+	 * \brief Destroys first element.
+	 */
+
+	void pop_front()
+	{
+		const auto node = head_[0];
+		for (uint8_t level {}; level < node->height; ++level)
+			head_[level] = node->next[level];
+		--size_;
+		destroy(*node);
+	}
+
+	/**
+	 * \return number of elements in the container
+	 */
+
+	size_type size() const
+	{
+		return size_;
+	}
+
+	/**
+	 * \brief Sorted emplace()
+	 *
+	 * \param Args are types of argument for value_type constructor
+	 *
+	 * \param [in] args are arguments for value_type constructor
+	 *
+	 * \return iterator to emplaced element
+	 */
+
+	template<typename... Args>
+	iterator sortedEmplace(Args&&... args)
+	{
+		const auto node = allocator_.allocate(1);
+		allocator_.construct(node, getRandomHeight(), std::forward<Args>(args)...);
+		link(*node);
+		return iterator{node};
+	}
+
+	/**
+	 * \brief Sorted splice()
+	 *
+	 * \param [in] other is the container from which the object is transfered
+	 * \param [in] otherPosition is the position of the transfered object in the other container
+	 */
+
+	void sortedSplice(SortedSkipList& other, const iterator otherPosition)
+	{
+		other.unlink(*otherPosition.node_);
+		link(*otherPosition.node_);
+	}
+
+	SortedSkipList(const SortedSkipList&) = delete;
+	SortedSkipList(SortedSkipList&&) = delete;
+	const SortedSkipList& operator=(const SortedSkipList&) = delete;
+	SortedSkipList& operator=(SortedSkipList&&) = delete;
+
+private:
+
+	/**
+	 * \brief Destroys node and deallocates its storage.
+	 *
+	 * \param [in] node is a reference to destroyed node, it must not be linked in the container
+	 */
+
+	void destroy(Node& node)
+	{
+		allocator_.destroy(&node);
+		allocator_.deallocate(&node, 1);
+	}
+
+	/**
+	 * \brief Finds predecessors of a position on all levels.
+	 *
+	 * On each level - starting from the highest one - the search advances as long as the functor returns true for next
+	 * node.
+	 *
+	 * \param Functor is the type of functor - bool(const Node&, uint8_t)
+	 *
+	 * \param [out] predecessors is an array in which links of predecessors (either \a head_ or \a next of a node) for
+	 * each level will be stored
+	 * \param [in] functor is a functor called with next node and current level, it should return true if the search
+	 * should advance past this node and false otherwise
+	 */
+
+	template<typename Functor>
+	void findPredecessors(Node** (&predecessors)[MaxLevel], Functor functor)
+	{
+		Node** links = head_;
+		for (uint8_t level {MaxLevel}; level-- > 0;)
+		{
+			while (links[level] != nullptr && functor(*links[level], level) == true)
+				links = links[level]->next;
+			predecessors[level] = links;
+		}
+	}
+
+	/**
+	 * \return pseudo-random height of new node, [1; MaxLevel]
+	 */
+
+	uint8_t getRandomHeight()
+	{
+		// xorshift generator from "Xorshift RNGs" by George Marsaglia
+		random_ ^= random_ << 13;
+		random_ ^= random_ >> 17;
+		random_ ^= random_ << 5;
+
+		auto random = random_;
+		uint8_t height {1};
+		while (height < MaxLevel && (random & 3) == 0)
+		{
+			++height;
+			random >>= 2;
+		}
+		return height;
+	}
+
+	/**
+	 * \brief Links the node into the container, after all nodes which are not "less" than the node.
+	 *
+	 * \param [in] node is a reference to linked node
+	 */
+
+	void link(Node& node)
+	{
+		Node** predecessors[MaxLevel];
+		findPredecessors(predecessors,
+				[this, &node](const Node& next, uint8_t) -> bool
+				{
+					return compare_(next.value, node.value) == false;
+				});
+
+		for (uint8_t level {}; level < node.height; ++level)
+		{
+			node.next[level] = predecessors[level][level];
+			predecessors[level][level] = &node;
+		}
+		++size_;
+	}
+
+	/**
+	 * \brief Unlinks the node from the container.
+	 *
+	 * On levels above the height of the node the search stops before the first node "equal" to unlinked one, on the
+	 * other levels it advances until the node itself is found.
+	 *
+	 * \param [in] node is a reference to unlinked node, it must be linked in the container
+	 */
+
+	void unlink(Node& node)
+	{
+		Node** predecessors[MaxLevel];
+		findPredecessors(predecessors,
+				[this, &node](const Node& next, const uint8_t level) -> bool
+				{
+					return &next != &node && (level < node.height || compare_(node.value, next.value) == true);
+				});
+
+		for (uint8_t level {}; level < node.height; ++level)
+			predecessors[level][level] = node.next[level];
+		--size_;
+	}
+
+	/// links to first nodes on each level
+	Node* head_[MaxLevel];
+
+	/// number of elements in the container
+	size_type size_;
+
+	/// allocator of nodes
+	NodeAllocator allocator_;
+
+	/// instance of functor used for comparison
+	Compare compare_;
+
+	/// state of pseudo-random generator used to select height of new nodes
+	uint32_t random_;
+};
+
+}	// namespace containers
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_CONTAINERS_SORTEDSKIPLIST_HPP_
@@ -0,0 +1,132 @@
+/**
+ * \file
+ * \brief deferredRequests namespace header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#ifndef INCLUDE_DISTORTOS_DEFERREDREQUESTS_HPP_
+#define INCLUDE_DISTORTOS_DEFERREDREQUESTS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include <type_traits>
+
+#include <cstdint>
+#include <cstring>
+
+namespace distortos
+{
+
+template<typename T>
+class FifoQueue;
+
+class Semaphore;
+class ThreadBase;
+
+/**
+ * \brief deferredRequests namespace groups functions which can be used by interrupt handlers with priority higher than
+ * CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI ("zero-latency" interrupts, which are never masked by the kernel).
+ *
+ * Such handlers must not call any other function of the system. Functions from this namespace don't use interrupt
+ * masking - they only put the request into lock-free queue and request context switch. The requests are executed (in
+ * the order in which they were queued) at the beginning of the next context switch (PendSV on ARMv7-M), which happens
+ * as soon as all interrupts exit and interrupt masking of the kernel is disabled. Functions from this namespace may
+ * also be used from any other context.
+ *
+ * \note Result of the request itself (e.g. EOVERFLOW returned by Semaphore::post()) is not available to the caller.
+ */
+
+namespace deferredRequests
+{
+
+/// type of function executed by deferred request - \a object and \a argument are the values passed to call()
+using Function = void(void* object, uintptr_t argument);
+
+/**
+ * \brief Requests deferred execution of function.
+ *
+ * \param [in] function is a reference to function that will be executed
+ * \param [in] object is the first argument for \a function
+ * \param [in] argument is the second argument for \a function
+ *
+ * \return zero if request was queued successfully, error code otherwise:
+ * - EAGAIN - queue of deferred requests is full;
+ */
+
+int call(Function& function, void* object, uintptr_t argument);
+
+/**
+ * \brief Requests deferred generation of signal for thread.
+ *
+ * Deferred version of ThreadBase::generateSignal().
+ *
+ * \param [in] thread is a reference to thread for which the signal will be generated
+ * \param [in] signalNumber is the signal to be generated, [0; 31]
+ *
+ * \return zero if request was queued successfully, error code otherwise:
+ * - EAGAIN - queue of deferred requests is full;
+ */
+
+int generateSignal(const ThreadBase& thread, uint8_t signalNumber);
+
+/**
+ * \brief Requests deferred post of semaphore.
+ *
+ * Deferred version of Semaphore::post().
+ *
+ * \param [in] semaphore is a reference to semaphore that will be posted
+ *
+ * \return zero if request was queued successfully, error code otherwise:
+ * - EAGAIN - queue of deferred requests is full;
+ */
+
+int post(Semaphore& semaphore);
+
+/**
+ * \brief Requests deferred push of element to FifoQueue.
+ *
+ * Deferred version of FifoQueue::tryPush(). The value is stored in the request itself, so it must be trivially
+ * copyable and not larger than uintptr_t.
+ *
+ * \param T is the type of data in queue
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue to which the element will be pushed
+ * \param [in] value is the value that will be pushed
+ *
+ * \return zero if request was queued successfully, error code otherwise:
+ * - EAGAIN - queue of deferred requests is full;
+ */
+
+template<typename T>
+int tryPush(FifoQueue<T>& fifoQueue, const T value)
+{
+	static_assert(std::is_trivially_copyable<T>::value == true && sizeof(T) <= sizeof(uintptr_t),
+			"T must be trivially copyable and not larger than uintptr_t!");
+
+	uintptr_t argument {};
+	memcpy(&argument, &value, sizeof(value));
+	const auto function = static_cast<Function*>([](void* const object, const uintptr_t argumentValue)
+			{
+				T valueCopy;
+				memcpy(&valueCopy, &argumentValue, sizeof(valueCopy));
+				static_cast<FifoQueue<T>*>(object)->tryPush(valueCopy);
+			});
+	return call(*function, &fifoQueue, argument);
+}
+
+}	// namespace deferredRequests
+
+}	// namespace distortos
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#endif	// INCLUDE_DISTORTOS_DEFERREDREQUESTS_HPP_
@@ -8,17 +8,28 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_DISTORTOSCONFIGURATION_H_
 #define INCLUDE_DISTORTOS_DISTORTOSCONFIGURATION_H_
 
+/**
+ * \brief architecture used by system - ARMv7-M (default) or Linux host (CONFIG_ARCHITECTURE_LINUX is defined by
+ * Makefile when ARCHITECTURE = Linux)
+ */
+
+#ifndef CONFIG_ARCHITECTURE_LINUX
+#define CONFIG_ARCHITECTURE_ARMV7_M
+#endif	/* ndef CONFIG_ARCHITECTURE_LINUX */
+
 /**
  * \brief chip used by system
  */
 
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M
 #define CONFIG_CHIP_STM32F407
+#endif	/* def CONFIG_ARCHITECTURE_ARMV7_M */
 
 /**
  * \brief max priority (inclusive) of interrupt handlers that can use system's functions
@@ -37,10 +48,15 @@
 #define CONFIG_TICK_CLOCK 16000000
 
 /**
- * \brief system's tick rate, Hz
+ * \brief system's tick rate, Hz - lower on Linux host, so that the process is less likely to be preempted by the host
+ * for longer than one tick
  */
 
+#ifdef CONFIG_ARCHITECTURE_LINUX
+#define CONFIG_TICK_RATE_HZ 100
+#else
 #define CONFIG_TICK_RATE_HZ 1000
+#endif	/* def CONFIG_ARCHITECTURE_LINUX */
 
 /**
  * \brief round-robin rate, Hz
@@ -68,4 +84,92 @@
 
 #define CONFIG_MAIN_THREAD_SIGNAL_ACTIONS	0
 
+/**
+ * \brief multiplier of stack size of StaticThread objects - stacks on Linux host must be much larger, because signal
+ * frames of emulated interrupts are placed on them
+ */
+
+#ifdef CONFIG_ARCHITECTURE_LINUX
+#define CONFIG_STACK_SIZE_MULTIPLIER	256
+#else
+#define CONFIG_STACK_SIZE_MULTIPLIER	1
+#endif	/* def CONFIG_ARCHITECTURE_LINUX */
+
+/**
+ * \brief selects whether newlib is the C library (1) or not (0) - newlib's reentrancy structure for each thread and
+ * system calls from source/syscalls are used only in the first case, Linux host uses its own C library
+ */
+
+#ifdef CONFIG_ARCHITECTURE_LINUX
+#define CONFIG_NEWLIB	0
+#else
+#define CONFIG_NEWLIB	1
+#endif	/* def CONFIG_ARCHITECTURE_LINUX */
+
+/**
+ * \brief selects whether malloc() and related functions use TLSF heap (1) or newlib's allocator (0), TLSF heap takes
+ * ownership of whole area between __heap_start and __heap_end, so _sbrk_r() always fails when it is enabled; requires
+ * CONFIG_NEWLIB == 1
+ */
+
+#if CONFIG_NEWLIB == 1
+#define CONFIG_TLSF_HEAP	1
+#else
+#define CONFIG_TLSF_HEAP	0
+#endif	/* CONFIG_NEWLIB == 1 */
+
+/**
+ * \brief selects whether kernel's hot data (scheduler instance, idle and main threads with their pools) is placed in
+ * CCM RAM and time-critical functions (context switch, tick interrupt handler) are executed from SRAM (1) or whether
+ * default placement - SRAM for data and flash for code - is used (0); available only on chips with CCM RAM
+ */
+
+#ifdef CONFIG_CHIP_STM32F407
+#define CONFIG_FAST_MEMORY_PLACEMENT	1
+#else
+#define CONFIG_FAST_MEMORY_PLACEMENT	0
+#endif	/* def CONFIG_CHIP_STM32F407 */
+
+/**
+ * \brief selects whether durations of interrupt masking sections (code executed with interrupt masking enabled by
+ * InterruptMaskingLock) are measured with architecture::getCycleCount() (1) or not (0); the longest sections can be
+ * read with statistics::getInterruptMaskingProfile()
+ */
+
+#define CONFIG_INTERRUPT_MASKING_PROFILER	0
+
+/**
+ * \brief number of the longest interrupt masking sections (each with distinct call site) recorded by the profiler,
+ * relevant only if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+ */
+
+#define CONFIG_INTERRUPT_MASKING_PROFILER_ENTRIES	8
+
+/**
+ * \brief max number of requests queued with functions from deferredRequests namespace (used by interrupt handlers with
+ * priority higher than CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI), must be a power of two, 0 to disable deferred
+ * requests
+ */
+
+#define CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE	16
+
+/**
+ * \brief size of stack of software timer service thread (which executes functions of software timers created with
+ * SoftwareTimerBase::ExecutionContext::ServiceThread), bytes, 0 to disable the service thread - functions of all
+ * software timers are executed from "tick" interrupt then
+ */
+
+#ifdef CONFIG_ARCHITECTURE_LINUX
+#define CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE	1024
+#else
+#define CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE	0
+#endif	/* def CONFIG_ARCHITECTURE_LINUX */
+
+/**
+ * \brief priority of software timer service thread, 0 - lowest, 255 - highest, relevant only if
+ * CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+ */
+
+#define CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_PRIORITY	255
+
 #endif	/* INCLUDE_DISTORTOS_DISTORTOSCONFIGURATION_H_ */
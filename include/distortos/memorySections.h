@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief Attributes which place objects and functions in dedicated memory sections
+ *
+ * CCM RAM (core coupled memory) is accessed by the core without wait states and without contention with DMA, but it
+ * is not accessible by DMA and code cannot be executed from it. Objects placed there must not be used as DMA buffers.
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-02
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYSECTIONS_H_
+#define INCLUDE_DISTORTOS_MEMORYSECTIONS_H_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_FAST_MEMORY_PLACEMENT == 1
+
+/**
+ * \brief Places zero-initialized object (without initializer or with std::aligned_storage type) in CCM RAM.
+ *
+ * The section is zeroed by startup code, initial value from object's initializer is ignored.
+ */
+
+#define DISTORTOS_CCM_BSS	__attribute__ ((section(".ccm.bss")))
+
+/**
+ * \brief Places initialized object in CCM RAM.
+ *
+ * Initial value is copied from flash by startup code, so this attribute should not be used for large objects without
+ * initializer (like stacks) - use DISTORTOS_CCM_BSS for them.
+ */
+
+#define DISTORTOS_CCM_DATA	__attribute__ ((section(".ccm.data")))
+
+/**
+ * \brief Places function in SRAM - it is copied from flash by startup code, so it is executed without flash wait
+ * states.
+ */
+
+#define DISTORTOS_RAMFUNC	__attribute__ ((section(".ramfunc")))
+
+#else	/* CONFIG_FAST_MEMORY_PLACEMENT != 1 */
+
+#define DISTORTOS_CCM_BSS
+#define DISTORTOS_CCM_DATA
+#define DISTORTOS_RAMFUNC
+
+#endif	/* CONFIG_FAST_MEMORY_PLACEMENT != 1 */
+
+#endif	/* INCLUDE_DISTORTOS_MEMORYSECTIONS_H_ */
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-14
+ * \date 2015-06-09
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_MAINTHREAD_HPP_
@@ -22,7 +22,8 @@ namespace distortos
 namespace scheduler
 {
 
-/// MainThread class is a ThreadBase for main()
+/// MainThread class is a ThreadBase for main(), it uses global newlib's _reent structure - the same one that was used
+/// before the scheduler was started
 class MainThread : public ThreadBase
 {
 public:
@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief ReentStorage class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-09
+ */
+
+#ifndef INCLUDE_DISTORTOS_SCHEDULER_REENTSTORAGE_HPP_
+#define INCLUDE_DISTORTOS_SCHEDULER_REENTSTORAGE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <type_traits>
+
+#if CONFIG_NEWLIB == 1
+
+#include <reent.h>
+
+#else	// CONFIG_NEWLIB != 1
+
+/// newlib's reentrancy structure
+struct _reent;
+
+#endif	// CONFIG_NEWLIB != 1
+
+namespace distortos
+{
+
+namespace scheduler
+{
+
+/**
+ * \brief ReentStorage class is a storage for thread-specific newlib's _reent structure.
+ *
+ * Storage is initialized by ThreadControlBlock's constructor and reclaimed by its destructor.
+ *
+ * \param Shared selects whether thread shares global _reent structure with other threads (true) - no storage is
+ * provided in that case - or whether it has thread-specific _reent structure (false)
+ */
+
+template<bool Shared>
+class ReentStorage
+{
+public:
+
+	/**
+	 * \return pointer to storage for thread-specific _reent structure, nullptr if CONFIG_NEWLIB == 0
+	 */
+
+	_reent* get()
+	{
+#if CONFIG_NEWLIB == 1
+		return reinterpret_cast<_reent*>(&storage_);
+#else	// CONFIG_NEWLIB != 1
+		return nullptr;
+#endif	// CONFIG_NEWLIB != 1
+	}
+
+#if CONFIG_NEWLIB == 1
+
+private:
+
+	/// storage for thread-specific _reent structure
+	typename std::aligned_storage<sizeof(_reent), alignof(_reent)>::type storage_;
+
+#endif	// CONFIG_NEWLIB == 1
+};
+
+/**
+ * \brief ReentStorage class is a storage for thread-specific newlib's _reent structure.
+ *
+ * Specialization for threads which share global _reent structure with other threads - no storage is provided.
+ */
+
+template<>
+class ReentStorage<true>
+{
+public:
+
+	/**
+	 * \return nullptr, shared global _reent structure should be used
+	 */
+
+	constexpr static _reent* get()
+	{
+		return nullptr;
+	}
+};
+
+}	// namespace scheduler
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SCHEDULER_REENTSTORAGE_HPP_
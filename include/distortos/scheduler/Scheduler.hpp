@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-04
+ * \date 2015-06-15
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_SCHEDULER_HPP_
@@ -17,6 +17,8 @@
 #include "distortos/scheduler/ThreadControlBlockList.hpp"
 #include "distortos/scheduler/SoftwareTimerControlBlockSupervisor.hpp"
 
+#include "distortos/synchronization/VersionedValue.hpp"
+
 namespace distortos
 {
 
@@ -89,19 +91,55 @@ public:
 	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
 	 * \param [in] unblockFunctor is a pointer to ThreadControlBlock::UnblockFunctor which will be executed in
 	 * ThreadControlBlock::unblockHook(), default - nullptr (no functor will be executed)
+	 * \param [in] slack is the max duration by which unblocking of the thread after \a timePoint may be delayed, so
+	 * that it is coalesced with other expirations of software timers, default - 0 (unblocking is never delayed)
 	 *
 	 * \return 0 on success, error code otherwise:
 	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
 	 */
 
 	int blockUntil(ThreadControlBlockList& container, TickClock::time_point timePoint,
-			const ThreadControlBlock::UnblockFunctor* unblockFunctor = {});
+			const ThreadControlBlock::UnblockFunctor* unblockFunctor = {}, TickClock::duration slack = {});
+
+	/**
+	 * \brief Disables preemption of current thread.
+	 *
+	 * While preemption is disabled, all context switches requested by Scheduler::maybeRequestContextSwitch() (e.g.
+	 * because higher-priority thread was unblocked from interrupt or due to round-robin scheduling) are deferred until
+	 * preemption is enabled again. Interrupts are not masked, so they - and kernel functions called from them - are
+	 * fully functional. Calls may be nested.
+	 *
+	 * \note If current thread blocks while its preemption is disabled, context switch is done anyway. Preemption stays
+	 * disabled only for this thread, so other threads may be preempted normally until it is resumed.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EAGAIN - max nesting depth of disabled preemption was reached;
+	 */
+
+	int disablePreemption();
+
+	/**
+	 * \brief Enables preemption of current thread.
+	 *
+	 * When the outermost call to Scheduler::disablePreemption() is undone, context switch which was deferred while
+	 * preemption was disabled is requested.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EPERM - preemption of current thread is not disabled;
+	 */
+
+	int enablePreemption();
 
 	/**
+	 * \note This function doesn't mask interrupts and may be called from any context.
+	 *
 	 * \return number of context switches
 	 */
 
-	uint64_t getContextSwitchCount() const;
+	uint64_t getContextSwitchCount() const
+	{
+		return contextSwitchCount_.load();
+	}
 
 	/**
 	 * \return reference to currently active ThreadControlBlock
@@ -158,10 +196,15 @@ public:
 	}
 
 	/**
+	 * \note This function doesn't mask interrupts and may be called from any context.
+	 *
 	 * \return current value of tick count
 	 */
 
-	uint64_t getTickCount() const;
+	uint64_t getTickCount() const
+	{
+		return tickCount_.load();
+	}
 
 	/**
 	 * \brief Scheduler's initialization
@@ -311,7 +354,12 @@ private:
 	 * Context switch is required in following situations:
 	 * - current thread is no longer on "runnable" list,
 	 * - current thread is no longer on the beginning of the "runnable" list (because higher-priority thread is
-	 * available or current thread was "rotated" due to round-robin scheduling policy).
+	 * available or current thread was "rotated" due to round-robin scheduling policy) and preemption of current thread
+	 * is not disabled.
+	 *
+	 * Preemption threshold of current thread is handled by ordering of the "runnable" list - while the threshold is
+	 * active, the thread is sorted with scheduling priority raised to the threshold, so only threads with priority
+	 * higher than the threshold are placed before it.
 	 *
 	 * \return true if context switch is required
 	 */
@@ -355,11 +403,11 @@ private:
 	/// internal SoftwareTimerControlBlockSupervisor object
 	SoftwareTimerControlBlockSupervisor softwareTimerControlBlockSupervisor_;
 
-	/// number of context switches
-	uint64_t contextSwitchCount_;
+	/// number of context switches, modified only with interrupts masked
+	synchronization::VersionedValue<uint64_t> contextSwitchCount_;
 
-	/// tick count
-	uint64_t tickCount_;
+	/// tick count, modified only with interrupts masked
+	synchronization::VersionedValue<uint64_t> tickCount_;
 };
 
 }	// namespace scheduler
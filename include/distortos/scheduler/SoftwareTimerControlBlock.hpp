@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-24
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
@@ -36,18 +36,32 @@ public:
 	/// type of object used as storage for SoftwareTimerControlBlockList elements - 3 pointers
 	using Link = std::array<std::aligned_storage<sizeof(void*), alignof(void*)>::type, 3>;
 
+	/// context in which software timer's function is executed
+	enum class ExecutionContext : uint8_t
+	{
+		/// function is executed from "tick" interrupt, with interrupts masked
+		Interrupt,
+		/// function is executed by software timer service thread, requires
+		/// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0 - otherwise it is executed from "tick" interrupt
+		ServiceThread,
+	};
+
 	/**
 	 * \brief SoftwareTimerControlBlock's constructor
+	 *
+	 * \param [in] executionContext is the context in which software timer's function is executed, default -
+	 * ExecutionContext::Interrupt
 	 */
 
-	SoftwareTimerControlBlock();
+	explicit SoftwareTimerControlBlock(ExecutionContext executionContext = ExecutionContext::Interrupt);
 
 	/**
 	 * \brief Execute software timer's function.
 	 *
 	 * Calls internal pure virtual execute_(), which should be provided by derived classes.
 	 *
-	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler()
+	 * \note this should only be called by SoftwareTimerControlBlockSupervisor::tickInterruptHandler() or
+	 * SoftwareTimerControlBlockSupervisor::serviceExpired()
 	 */
 
 	void execute() const
@@ -55,6 +69,44 @@ public:
 		execute_();
 	}
 
+	/**
+	 * \return deadline of the timer - expiration time point increased by slack, the timer is handled not later than at
+	 * this time point
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return timePoint_ + slack_;
+	}
+
+	/**
+	 * \return context in which software timer's function is executed
+	 */
+
+	ExecutionContext getExecutionContext() const
+	{
+		return executionContext_;
+	}
+
+	/**
+	 * \return number of expirations which were skipped before the most recent execution of periodic timer's function,
+	 * because it was executed too late - for example when previous execution took longer than period of the timer
+	 */
+
+	uint64_t getOverrunCount() const
+	{
+		return overrunCount_;
+	}
+
+	/**
+	 * \return period of the timer, 0 for one-shot timer
+	 */
+
+	TickClock::duration getPeriod() const
+	{
+		return period_;
+	}
+
 	/**
 	 * \return reference to internal storage for list link
 	 */
@@ -64,6 +116,15 @@ public:
 		return link_;
 	}
 
+	/**
+	 * \return max duration by which each expiration may be delayed
+	 */
+
+	TickClock::duration getSlack() const
+	{
+		return slack_;
+	}
+
 	/**
 	 * \return const reference to expiration time point
 	 */
@@ -74,7 +135,8 @@ public:
 	}
 
 	/**
-	 * \return true if the timer is running, false otherwise
+	 * \return true if the timer is running (including the time between expiration and execution of its function by
+	 * software timer service thread), false otherwise
 	 */
 
 	bool isRunning() const
@@ -82,6 +144,19 @@ public:
 		return list_ != nullptr;
 	}
 
+	/**
+	 * \brief Reloads periodic timer after its expiration.
+	 *
+	 * Expiration time point is advanced by an integer multiple of period, so that it is later than \a timePoint -
+	 * executions are never accumulated and the timer doesn't drift. Skipped expirations are counted as overruns.
+	 *
+	 * \note this should only be called by SoftwareTimerControlBlockSupervisor for periodic timer
+	 *
+	 * \param [in] timePoint is the current time point
+	 */
+
+	void reload(TickClock::time_point timePoint);
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -96,12 +171,17 @@ public:
 	/**
 	 * \brief Starts the timer.
 	 *
+	 * If the timer is running it is restarted.
+	 *
 	 * \note The duration will never be shorter, so one additional tick is always added to the duration.
 	 *
 	 * \param [in] duration is the duration after which the function will be executed
 	 */
 
-	void start(TickClock::duration duration);
+	void start(TickClock::duration duration)
+	{
+		start(duration, TickClock::duration{});
+	}
 
 	/**
 	 * \brief Starts the timer.
@@ -120,13 +200,59 @@ public:
 		start(std::chrono::duration_cast<TickClock::duration>(duration));
 	}
 
+	/**
+	 * \brief Starts periodic timer.
+	 *
+	 * If the timer is running it is restarted.
+	 *
+	 * \note The duration will never be shorter, so one additional tick is always added to the duration.
+	 *
+	 * \param [in] duration is the duration after which the function will be executed for the first time
+	 * \param [in] period is the period of further executions of the function, 0 for one-shot timer
+	 * \param [in] slack is the max duration by which each expiration may be delayed, so that it is handled together
+	 * with other expirations (coalesced), default - 0 (expiration is never delayed)
+	 */
+
+	void start(TickClock::duration duration, TickClock::duration period,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Starts periodic timer.
+	 *
+	 * \note The duration must not be shorter, so one additional tick is always added to the duration.
+	 *
+	 * \param Rep1 is type of tick counter used in \a duration
+	 * \param Period1 is std::ratio type representing the tick period of the clock used in \a duration, in seconds
+	 * \param Rep2 is type of tick counter used in \a period
+	 * \param Period2 is std::ratio type representing the tick period of the clock used in \a period, in seconds
+	 *
+	 * \param [in] duration is the duration after which the function will be executed for the first time
+	 * \param [in] period is the period of further executions of the function, 0 for one-shot timer, negative value is
+	 * treated as 0
+	 * \param [in] slack is the max duration by which each expiration may be delayed, so that it is handled together
+	 * with other expirations (coalesced), default - 0 (expiration is never delayed)
+	 */
+
+	template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+	void start(const std::chrono::duration<Rep1, Period1> duration, const std::chrono::duration<Rep2, Period2> period,
+			const TickClock::duration slack = {})
+	{
+		start(std::chrono::duration_cast<TickClock::duration>(duration), period > period.zero() ?
+				std::chrono::duration_cast<TickClock::duration>(period) : TickClock::duration{}, slack);
+	}
+
 	/**
 	 * \brief Starts the timer.
 	 *
+	 * If the timer is running it is restarted.
+	 *
 	 * \param [in] timePoint is the time point at which the function will be executed
 	 */
 
-	void start(TickClock::time_point timePoint);
+	void start(TickClock::time_point timePoint)
+	{
+		start(timePoint, TickClock::duration{});
+	}
 
 	/**
 	 * \brief Starts the timer.
@@ -142,8 +268,50 @@ public:
 		start(std::chrono::time_point_cast<TickClock::duration>(timePoint));
 	}
 
+	/**
+	 * \brief Starts periodic timer.
+	 *
+	 * If the timer is running it is restarted. Expiration time points are defined by \a timePoint and \a period
+	 * only, so the timer doesn't drift, even if its function is executed late.
+	 *
+	 * \param [in] timePoint is the time point at which the function will be executed for the first time
+	 * \param [in] period is the period of further executions of the function, 0 for one-shot timer
+	 * \param [in] slack is the max duration by which each expiration may be delayed, so that it is handled together
+	 * with other expirations (coalesced), default - 0 (expiration is never delayed)
+	 */
+
+	void start(TickClock::time_point timePoint, TickClock::duration period,
+			TickClock::duration slack = {});
+
+	/**
+	 * \brief Starts periodic timer.
+	 *
+	 * \param Duration is a std::chrono::duration type used to measure duration
+	 * \param Rep is type of tick counter used in \a period
+	 * \param Period is std::ratio type representing the tick period of the clock used in \a period, in seconds
+	 *
+	 * \param [in] timePoint is the time point at which the function will be executed for the first time
+	 * \param [in] period is the period of further executions of the function, 0 for one-shot timer, negative value is
+	 * treated as 0
+	 * \param [in] slack is the max duration by which each expiration may be delayed, so that it is handled together
+	 * with other expirations (coalesced), default - 0 (expiration is never delayed)
+	 */
+
+	template<typename Duration, typename Rep, typename Period>
+	void start(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const std::chrono::duration<Rep, Period> period, const TickClock::duration slack = {})
+	{
+		start(std::chrono::time_point_cast<TickClock::duration>(timePoint), period > period.zero() ?
+				std::chrono::duration_cast<TickClock::duration>(period) : TickClock::duration{}, slack);
+	}
+
 	/**
 	 * \brief Stops the timer.
+	 *
+	 * If function of the timer with ExecutionContext::ServiceThread is being executed by software timer service thread,
+	 * this function waits until it returns (unless it is called by that function).
+	 *
+	 * \warning For timer with ExecutionContext::ServiceThread this function must not be called from interrupt context.
 	 */
 
 	void stop();
@@ -153,7 +321,9 @@ protected:
 	/**
 	 * \brief SoftwareTimerControlBlock's destructor
 	 *
-	 * If the timer is running it is stopped.
+	 * If the timer is running it is stopped. If its function is being executed by software timer service thread, the
+	 * destructor waits until it returns, so timer with ExecutionContext::ServiceThread must not be destroyed in
+	 * interrupt context.
 	 */
 
 	~SoftwareTimerControlBlock();
@@ -171,6 +341,15 @@ private:
 	///time point of expiration
 	TickClock::time_point timePoint_;
 
+	/// period of the timer, 0 for one-shot timer
+	TickClock::duration period_;
+
+	/// max duration by which each expiration may be delayed
+	TickClock::duration slack_;
+
+	/// number of expirations which were skipped before the most recent execution of periodic timer's function
+	uint64_t overrunCount_;
+
 	/// storage for list link
 	Link link_;
 
@@ -179,6 +358,9 @@ private:
 
 	/// iterator of this object on the list, valid after it has been added to some list
 	SoftwareTimerControlBlockListIterator iterator_;
+
+	/// context in which software timer's function is executed
+	ExecutionContext executionContext_;
 };
 
 }	// namespace scheduler
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-13
+ * \date 2015-06-12
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERCONTROLBLOCKLIST_HPP_
@@ -24,7 +24,7 @@ namespace distortos
 namespace scheduler
 {
 
-/// functor which gives ascending expiration time point order of elements on the list
+/// functor which gives ascending deadline order of elements on the list
 struct SoftwareTimerControlBlockAscendingTimePoint
 {
 	/**
@@ -33,13 +33,13 @@ struct SoftwareTimerControlBlockAscendingTimePoint
 	 * \param [in] left is the object on the left side of comparison
 	 * \param [in] right is the object on the right side of comparison
 	 *
-	 * \return true if left's expiration time point is greater than right's expiration time point
+	 * \return true if left's deadline is greater than right's deadline
 	 */
 
 	bool operator()(const SoftwareTimerControlBlockListValueType& left,
 			const SoftwareTimerControlBlockListValueType& right) const
 	{
-		return left.get().getTimePoint() > right.get().getTimePoint();
+		return left.get().getDeadline() > right.get().getDeadline();
 	}
 };
 
@@ -50,7 +50,7 @@ using SoftwareTimerControlBlockListBase = containers::SortedContainer
 				SoftwareTimerControlBlockAscendingTimePoint
 		>;
 
-/// list of SoftwareTimerControlBlock objects in ascending order of expiration time point
+/// list of SoftwareTimerControlBlock objects in ascending order of deadline
 class SoftwareTimerControlBlockList : public SoftwareTimerControlBlockListBase
 {
 public:
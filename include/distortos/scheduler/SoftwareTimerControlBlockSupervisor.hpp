@@ -2,13 +2,13 @@
  * \file
  * \brief SoftwareTimerControlBlockSupervisor class header
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-09-18
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERCONTROLBLOCKSUPERVISOR_HPP_
@@ -16,6 +16,12 @@
 
 #include "distortos/scheduler/SoftwareTimerControlBlockList.hpp"
 
+#include "distortos/scheduler/ThreadControlBlockList.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -43,9 +49,23 @@ public:
 
 	SoftwareTimerControlBlockListIterator add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+	/**
+	 * \brief Removes SoftwareTimerControlBlock from supervisor, effectively stopping the software timer.
+	 *
+	 * \param [in] list is a reference to list on which the SoftwareTimerControlBlock is currently placed
+	 * \param [in] iterator is the iterator to removed SoftwareTimerControlBlock object on \a list
+	 */
+
+	void remove(SoftwareTimerControlBlockList& list, SoftwareTimerControlBlockListIterator iterator);
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
+	 * Only the beginning of the list of active software timers is examined - search stops at the first software timer
+	 * with deadline later than \a timePoint increased by the largest slack of active software timers, as no further
+	 * software timer can be expired. After execution of function of software timer, the search continues from the next
+	 * element, unless the function added or removed some software timer - then it is restarted.
+	 *
 	 * \note this must not be called by user code
 	 *
 	 * \param [in] timePoint is the current time point
@@ -53,6 +73,34 @@ public:
 
 	void tickInterruptHandler(TickClock::time_point timePoint);
 
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	/**
+	 * \brief Waits for expiration of software timers with SoftwareTimerControlBlock::ExecutionContext::ServiceThread
+	 * and executes their functions.
+	 *
+	 * Returns after all expired software timers handed over by tickInterruptHandler() were executed.
+	 *
+	 * \note this must not be called by user code - it should only be called by software timer service thread
+	 */
+
+	void serviceExpired();
+
+	/**
+	 * \brief Waits until function of software timer executed by software timer service thread returns.
+	 *
+	 * Returns immediately if function of provided software timer is not being executed or if it is called by software
+	 * timer service thread (e.g. when the function stops its own timer).
+	 *
+	 * \warning This function must not be called from interrupt context.
+	 *
+	 * \param [in] softwareTimerControlBlock is a reference to SoftwareTimerControlBlock whose function is waited for
+	 */
+
+	void waitForExecution(const SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
 private:
 
 	/// pool instance used by allocator_
@@ -61,8 +109,33 @@ private:
 	/// PoolAllocator<> of SoftwareTimerControlBlockList
 	SoftwareTimerControlBlockListAllocator allocator_;
 
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	/// list of expired software timers waiting for execution by software timer service thread
+	SoftwareTimerControlBlockList expiredList_;
+
+	/// semaphore used to notify software timer service thread about expired software timers
+	Semaphore expiredSemaphore_;
+
+	/// list of threads waiting until function of software timer executed by software timer service thread returns
+	ThreadControlBlockList executionWaitList_;
+
+	/// pointer to software timer whose function is executed by software timer service thread, nullptr if none
+	const SoftwareTimerControlBlock* executedSoftwareTimerControlBlock_;
+
+	/// pointer to ThreadControlBlock of software timer service thread, nullptr before its first execution
+	const ThreadControlBlock* serviceThreadControlBlock_;
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerControlBlockList activeList_;
+
+	/// largest slack of software timers on \a activeList_, reset when the list becomes empty
+	TickClock::duration maxSlack_;
+
+	/// counter of additions and removals of software timers, used to detect changes done by functions of timers
+	uint32_t changeCount_;
 };
 
 }	// namespace scheduler
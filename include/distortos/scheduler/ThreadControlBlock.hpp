@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-09
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_THREADCONTROLBLOCK_HPP_
@@ -24,6 +24,13 @@
 
 #include "distortos/estd/TypeErasedFunctor.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+/// newlib's reentrancy structure
+struct _reent;
+
 namespace distortos
 {
 
@@ -68,6 +75,17 @@ public:
 		BlockedOnConditionVariable,
 		/// thread is waiting for signal
 		WaitingForSignal,
+		/// thread is waiting in WaitForAnySet
+		WaitingForAny,
+		/// thread is blocked on LatestValue, waiting for update
+		BlockedOnLatestValue,
+		/// thread is blocked on StreamBuffer
+		BlockedOnStreamBuffer,
+		/// thread is blocked on MessageBuffer
+		BlockedOnMessageBuffer,
+		/// thread is blocked on SoftwareTimer, waiting until its function executed by software timer service thread
+		/// returns
+		BlockedOnSoftwareTimer,
 	};
 
 	/// reason of thread unblocking
@@ -99,11 +117,15 @@ public:
 	 * be added, nullptr to inherit thread group from currently running thread
 	 * \param [in] signalsReceiver is a pointer to SignalsReceiver object for this thread, nullptr to disable reception
 	 * of signals for this thread
+	 * \param [in] reent is a pointer to storage for newlib's _reent structure for this thread, nullptr to share global
+	 * _reent structure (_global_impure_ptr) with other threads that don't have their own; ignored if
+	 * CONFIG_NEWLIB == 0
 	 * \param [in] owner is a reference to ThreadBase object that owns this ThreadControlBlock
 	 */
 
 	ThreadControlBlock(architecture::Stack&& stack, uint8_t priority, SchedulingPolicy schedulingPolicy,
-			ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver, ThreadBase& owner);
+			ThreadGroupControlBlock* threadGroupControlBlock, SignalsReceiver* signalsReceiver, _reent* reent,
+			ThreadBase& owner);
 
 	/**
 	 * \brief ThreadControlBlock's destructor
@@ -128,9 +150,10 @@ public:
 	/**
 	 * \brief Block hook function of thread
 	 *
-	 * Saves pointer to UnblockFunctor.
+	 * Saves pointer to UnblockFunctor and deactivates preemption threshold.
 	 *
-	 * \attention This function should be called only by Scheduler::blockInternal().
+	 * \attention This function should be called only by Scheduler::blockInternal(), before the thread is transferred
+	 * to the new list.
 	 *
 	 * \param [in] unblockFunctor is a pointer to UnblockFunctor which will be executed in unblockHook()
 	 */
@@ -138,6 +161,7 @@ public:
 	void blockHook(const UnblockFunctor* const unblockFunctor)
 	{
 		unblockFunctor_ = unblockFunctor;
+		preemptionThresholdActive_ = false;
 	}
 
 	/**
@@ -194,6 +218,24 @@ public:
 		return owner_;
 	}
 
+	/**
+	 * \return nesting depth of disabled preemption of the thread, 0 if preemption is enabled
+	 */
+
+	uint8_t getPreemptionDisableCount() const
+	{
+		return preemptionDisableCount_;
+	}
+
+	/**
+	 * \return preemption threshold of ThreadControlBlock, 0 - no preemption threshold
+	 */
+
+	uint8_t getPreemptionThreshold() const
+	{
+		return preemptionThreshold_;
+	}
+
 	/**
 	 * \return priority of ThreadControlBlock
 	 */
@@ -212,6 +254,23 @@ public:
 		return roundRobinQuantum_;
 	}
 
+	/**
+	 * \brief Gets scheduling priority of ThreadControlBlock.
+	 *
+	 * Scheduling priority is used for ordering of threads on lists. It is equal to effective priority, but when
+	 * preemption threshold is active (from the moment the thread is switched to until it blocks), it is raised to
+	 * preemption threshold.
+	 *
+	 * \return scheduling priority of ThreadControlBlock
+	 */
+
+	uint8_t getSchedulingPriority() const
+	{
+		const auto effectivePriority = getEffectivePriority();
+		return preemptionThresholdActive_ == true ? std::max(effectivePriority, preemptionThreshold_) :
+				effectivePriority;
+	}
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -289,6 +348,32 @@ public:
 		list_ = list;
 	}
 
+	/**
+	 * \param [in] preemptionDisableCount is the new nesting depth of disabled preemption of the thread
+	 */
+
+	void setPreemptionDisableCount(const uint8_t preemptionDisableCount)
+	{
+		preemptionDisableCount_ = preemptionDisableCount;
+	}
+
+	/**
+	 * \brief Changes preemption threshold of thread.
+	 *
+	 * Thread with preemption threshold can be preempted only by threads with priority higher than the threshold.
+	 * Threshold is activated when the thread is switched to and deactivated when it blocks - until then it stays in
+	 * effect even when the thread is preempted by a thread with even higher priority. If the threshold of active thread
+	 * is changed, the position in the thread list is adjusted and context switch may be requested.
+	 *
+	 * \note Threads with active preemption threshold are scheduled in round-robin fashion (and yield()) only with other
+	 * threads which have priority equal to the threshold.
+	 *
+	 * \param [in] preemptionThreshold is the new preemption threshold of thread, thresholds lower or equal to thread's
+	 * effective priority have no effect, 0 - no preemption threshold
+	 */
+
+	void setPreemptionThreshold(uint8_t preemptionThreshold);
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -331,14 +416,26 @@ public:
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
-	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable.
+	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ pointer and activates preemption threshold. Thread
+	 * which was not preempted because its preemption is disabled may be kept running while it is not the first one on
+	 * the "runnable" list, so if activation of the threshold raises its scheduling priority, the thread is
+	 * repositioned.
 	 *
 	 * \attention This function should be called only by Scheduler::switchContext().
 	 */
 
 	void switchedToHook()
 	{
-		_impure_ptr = &reent_;
+		if (preemptionThresholdActive_ == false)
+		{
+			const auto previousSchedulingPriority = getSchedulingPriority();
+			preemptionThresholdActive_ = true;
+			if (previousSchedulingPriority != getSchedulingPriority() && list_ != nullptr)
+				reposition(false);
+		}
+#if CONFIG_NEWLIB == 1
+		_impure_ptr = reent_;
+#endif	// CONFIG_NEWLIB == 1
 	}
 
 	/**
@@ -435,8 +532,13 @@ private:
 	/// receive signals
 	synchronization::SignalsReceiverControlBlock* signalsReceiverControlBlock_;
 
-	/// newlib's _reent structure with thread-specific data
-	_reent reent_;
+#if CONFIG_NEWLIB == 1
+
+	/// pointer to newlib's _reent structure used by this thread - either thread-specific one or the shared global one
+	/// (_global_impure_ptr)
+	_reent* reent_;
+
+#endif	// CONFIG_NEWLIB == 1
 
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
 	uint8_t priority_;
@@ -444,6 +546,15 @@ private:
 	/// thread's boosted priority, 0 - no boosting
 	uint8_t boostedPriority_;
 
+	/// nesting depth of disabled preemption of the thread, 0 if preemption is enabled
+	uint8_t preemptionDisableCount_;
+
+	/// thread's preemption threshold, 0 - no preemption threshold
+	uint8_t preemptionThreshold_;
+
+	/// true if preemption threshold is active (thread was switched to and didn't block since then), false otherwise
+	bool preemptionThresholdActive_;
+
 	/// round-robin quantum
 	RoundRobinQuantum roundRobinQuantum_;
 
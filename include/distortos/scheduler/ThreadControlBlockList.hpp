@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-13
+ * \date 2015-06-15
  */
 
 #ifndef INCLUDE_DISTORTOS_SCHEDULER_THREADCONTROLBLOCKLIST_HPP_
@@ -24,21 +24,21 @@ namespace distortos
 namespace scheduler
 {
 
-/// functor which gives descending effective priority order of elements on the list
-struct ThreadControlBlockDescendingEffectivePriority
+/// functor which gives descending scheduling priority order of elements on the list
+struct ThreadControlBlockDescendingSchedulingPriority
 {
 	/**
-	 * \brief ThreadControlBlockDescendingEffectivePriority's function call operator
+	 * \brief ThreadControlBlockDescendingSchedulingPriority's function call operator
 	 *
 	 * \param [in] left is the object on the left side of comparison
 	 * \param [in] right is the object on the right side of comparison
 	 *
-	 * \return true if left's effective priority is less than right's effective priority
+	 * \return true if left's scheduling priority is less than right's scheduling priority
 	 */
 
 	bool operator()(const ThreadControlBlockListValueType& left, const ThreadControlBlockListValueType& right) const
 	{
-		return left.get().getEffectivePriority() < right.get().getEffectivePriority();
+		return left.get().getSchedulingPriority() < right.get().getSchedulingPriority();
 	}
 };
 
@@ -46,10 +46,10 @@ struct ThreadControlBlockDescendingEffectivePriority
 using ThreadControlBlockListBase = containers::SortedContainer
 		<
 				ThreadControlBlockUnsortedList,
-				ThreadControlBlockDescendingEffectivePriority
+				ThreadControlBlockDescendingSchedulingPriority
 		>;
 
-/// List of ThreadControlBlock objects in descending order of effective priority that configures state of kept objects
+/// List of ThreadControlBlock objects in descending order of scheduling priority that configures state of kept objects
 class ThreadControlBlockList : private ThreadControlBlockListBase
 {
 public:
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief executeDeferredRequests() declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#ifndef INCLUDE_DISTORTOS_SCHEDULER_EXECUTEDEFERREDREQUESTS_HPP_
+#define INCLUDE_DISTORTOS_SCHEDULER_EXECUTEDEFERREDREQUESTS_HPP_
+
+namespace distortos
+{
+
+namespace scheduler
+{
+
+/**
+ * \brief Executes all requests queued with functions from deferredRequests namespace.
+ *
+ * \attention This function must be called from interrupt context with priority lower than or equal to the priority of
+ * interrupts that may use the kernel (PendSV on ARMv7-M), before the context of current thread is saved.
+ */
+
+void executeDeferredRequests();
+
+}	// namespace scheduler
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SCHEDULER_EXECUTEDEFERREDREQUESTS_HPP_
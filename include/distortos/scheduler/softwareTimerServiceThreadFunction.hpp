@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief softwareTimerServiceThreadFunction() declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-10
+ */
+
+#ifndef INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERSERVICETHREADFUNCTION_HPP_
+#define INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERSERVICETHREADFUNCTION_HPP_
+
+namespace distortos
+{
+
+namespace scheduler
+{
+
+/**
+ * \brief Software timer service thread's function
+ *
+ * Executes functions of expired software timers with SoftwareTimerControlBlock::ExecutionContext::ServiceThread.
+ */
+
+void softwareTimerServiceThreadFunction();
+
+}	// namespace scheduler
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SCHEDULER_SOFTWARETIMERSERVICETHREADFUNCTION_HPP_
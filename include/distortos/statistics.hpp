@@ -8,12 +8,26 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-04
+ * \date 2015-06-04
  */
 
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_TLSF_HEAP == 1
+
+#include "distortos/allocators/TlsfHeap.hpp"
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include "distortos/architecture/interruptMaskingProfiler.hpp"
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 #include <cstdint>
 
 namespace distortos
@@ -29,6 +43,33 @@ namespace statistics
 
 uint64_t getContextSwitchCount();
 
+#if CONFIG_TLSF_HEAP == 1
+
+/**
+ * \return statistics of heap used by malloc() and related functions
+ */
+
+allocators::TlsfHeap::Statistics getHeapStatistics();
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+/**
+ * \return the longest interrupt masking sections (each with distinct call site) recorded since startup or since last
+ * call to resetInterruptMaskingProfile(), sorted by decreasing duration
+ */
+
+architecture::InterruptMaskingProfile getInterruptMaskingProfile();
+
+/**
+ * \brief Clears all interrupt masking sections recorded by the profiler.
+ */
+
+void resetInterruptMaskingProfile();
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 }	// namespace statistics
 
 }	// namespace distortos
@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief BasicMutexControlBlock class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-05
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_BASICMUTEXCONTROLBLOCK_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_BASICMUTEXCONTROLBLOCK_HPP_
+
+#include "distortos/synchronization/MutexControlBlock.hpp"
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief BasicMutexControlBlock class is a control block for BasicMutex with priority protocol.
+ *
+ * \param MutexProtocol is the mutex protocol
+ */
+
+template<MutexControlBlock::Protocol MutexProtocol>
+class BasicMutexControlBlock : public MutexControlBlock
+{
+public:
+
+	/**
+	 * \brief BasicMutexControlBlock constructor
+	 *
+	 * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when MutexProtocol != PriorityProtect
+	 */
+
+	explicit BasicMutexControlBlock(const uint8_t priorityCeiling) :
+			MutexControlBlock{MutexProtocol, priorityCeiling}
+	{
+
+	}
+};
+
+/**
+ * \brief BasicMutexControlBlock class is a control block for BasicMutex without priority protocol.
+ *
+ * Specialization for Protocol::None - it has no storage and no code related to priority protocols.
+ */
+
+template<>
+class BasicMutexControlBlock<MutexControlBlock::Protocol::None> : public MutexControlBlockBase
+{
+public:
+
+	/**
+	 * \brief BasicMutexControlBlock constructor
+	 *
+	 * \param [in] priorityCeiling is ignored
+	 */
+
+	explicit BasicMutexControlBlock(uint8_t) :
+			MutexControlBlockBase{}
+	{
+
+	}
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_BASICMUTEXCONTROLBLOCK_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_FIFOQUEUEBASE_HPP_
@@ -34,12 +34,20 @@ public:
 	 * \brief FifoQueueBase's constructor
 	 *
 	 * \param [in] storageBegin is the beginning of storage for queue elements
-	 * \param [in] storageEnd is the pointer to past-the-last element of storage for queue elements
 	 * \param [in] elementSize is the size of single queue element, bytes
 	 * \param [in] maxElements is the number of elements in storage
 	 */
 
-	FifoQueueBase(void* storageBegin, const void* storageEnd, size_t elementSize, size_t maxElements);
+	FifoQueueBase(void* storageBegin, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \return number of elements dropped by pushOverwriting() since the queue was constructed
+	 */
+
+	size_t getDroppedCount() const
+	{
+		return droppedCount_;
+	}
 
 	/**
 	 * \return size of single queue element, bytes
@@ -50,6 +58,15 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -84,8 +101,40 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
 	}
 
+	/**
+	 * \brief Implementation of pushOverwriting() using type-erased functors
+	 *
+	 * This function never blocks. If the queue is not full, the element is pushed just like with push(). Otherwise the
+	 * oldest element is dropped - \a dropFunctor is executed with readPosition_, which is then advanced - and the new
+	 * element takes its place. In this case one "pop" is taken and one "pop" is given, while \a pushSemaphore_ is not
+	 * touched, so values of both semaphores still match the contents of the queue.
+	 *
+	 * If the queue is full and all of its elements were already claimed by threads unblocked from \a popSemaphore_
+	 * which haven't popped them yet, the oldest element cannot be dropped - in that case the new element is dropped
+	 * instead. Each drop - of the oldest or of the new element - is counted in droppedCount_.
+	 *
+	 * \param [in] dropFunctor is a pointer to QueueFunctor which will execute actions related to dropping the oldest
+	 * element - it will get readPosition_ as argument, nullptr if no actions are needed
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get
+	 * writePosition_ as argument
+	 *
+	 * \return zero if element was pushed (possibly dropping another one) or dropped, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushOverwriting(const QueueFunctor* dropFunctor, const QueueFunctor& functor);
+
 private:
 
+	/**
+	 * \brief Advances pointer to storage by one element, wrapping around at the end of storage.
+	 *
+	 * \param [in,out] storage is a reference to pointer to storage which will be advanced, readPosition_ or
+	 * writePosition_
+	 */
+
+	void advance(void*& storage) const;
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased functor
 	 *
@@ -127,6 +176,9 @@ private:
 
 	/// size of single queue element, bytes
 	const size_t elementSize_;
+
+	/// number of elements dropped by pushOverwriting()
+	size_t droppedCount_;
 };
 
 }	// namespace synchronization
@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \brief LatestValueBase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_LATESTVALUEBASE_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_LATESTVALUEBASE_HPP_
+
+#include "distortos/scheduler/ThreadControlBlockList.hpp"
+
+#include "distortos/estd/TypeErasedFunctor.hpp"
+
+#include <atomic>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/// LatestValueBase class implements basic functionality of LatestValue template class
+class LatestValueBase
+{
+public:
+
+	/// WriteFunctor is a type-erased functor executed by write() with interrupts masked, it receives new version of the
+	/// value, which selects the slot that should be written
+	class WriteFunctor : public estd::TypeErasedFunctor<void(uint32_t)>
+	{
+
+	};
+
+	/**
+	 * \brief LatestValueBase's constructor
+	 */
+
+	LatestValueBase();
+
+	/**
+	 * \note This function may be called from any context and it doesn't mask interrupts.
+	 *
+	 * \return current version of the value, incremented by each write()
+	 */
+
+	uint32_t getVersion() const
+	{
+		return version_.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * \brief Blocks current thread until the version of the value is different than the one given.
+	 *
+	 * \param [in] version is the version of the value known to the caller
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	int waitForUpdate(uint32_t version);
+
+	/**
+	 * \brief Blocks current thread until the version of the value is different than the one given or until given
+	 * time point.
+	 *
+	 * \param [in] version is the version of the value known to the caller
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] slack is the max duration by which termination of the wait may be delayed
+	 *
+	 * \return zero if the value was updated, error code otherwise:
+	 * - ETIMEDOUT - the value was not updated before the specified timeout expired;
+	 */
+
+	int waitForUpdateUntil(uint32_t version, TickClock::time_point timePoint, TickClock::duration slack);
+
+	/**
+	 * \brief Writes the value using type-erased functor.
+	 *
+	 * With interrupts masked executes the functor, increments the version of the value and unblocks all threads waiting
+	 * for update.
+	 *
+	 * \param [in] functor is a reference to WriteFunctor which will write the value to the slot selected by new
+	 * version
+	 */
+
+	void write(const WriteFunctor& functor);
+
+	LatestValueBase(const LatestValueBase&) = delete;
+	LatestValueBase(LatestValueBase&&) = delete;
+	const LatestValueBase& operator=(const LatestValueBase&) = delete;
+	LatestValueBase& operator=(LatestValueBase&&) = delete;
+
+private:
+
+	/// ThreadControlBlock objects blocked while waiting for update
+	scheduler::ThreadControlBlockList blockedList_;
+
+	/// version of the value, incremented after each write
+	std::atomic<uint32_t> version_;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_LATESTVALUEBASE_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-13
+ * \date 2015-05-29
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_MESSAGEQUEUEBASE_HPP_
@@ -21,6 +21,7 @@
 
 #include "distortos/allocators/FeedablePool.hpp"
 
+#include <array>
 #include <forward_list>
 
 namespace distortos
@@ -83,35 +84,100 @@ public:
 		typename std::aligned_storage<sizeof(T), alignof(T)>::type valueStorage;
 	};
 
-	/// functor which gives descending priority order of elements on the list
-	struct DescendingPriority
+	/// type of pool
+	using Pool = allocators::FeedablePool;
+
+	/// type of pool allocator
+	using PoolAllocator = allocators::PoolAllocator<Entry, Pool>;
+
+	/// type of free entry list
+	using FreeEntryList = std::forward_list<Entry, PoolAllocator>;
+
+	/**
+	 * \brief EntryList class is a list of entries sorted in descending order of priority, with FIFO order of entries
+	 * with equal priority.
+	 *
+	 * Entries are kept on a single forward list, which is logically split into per-priority FIFO buckets. The last entry
+	 * of each non-empty bucket is remembered and a bitmap marks non-empty buckets, so both insertion and removal of
+	 * entry are O(1) - no walk over the list is needed, regardless of its length.
+	 */
+
+	class EntryList
 	{
+	public:
+
+		/// type of underlying list
+		using List = std::forward_list<Entry, PoolAllocator>;
+
+		/// iterator of EntryList
+		using iterator = List::iterator;
+
 		/**
-		 * \brief DescendingPriority's function call operator
+		 * \brief EntryList's constructor
 		 *
-		 * \param [in] left is the object on the left side of comparison
-		 * \param [in] right is the object on the right side of comparison
-		 *
-		 * \return true if left's priority is less than right's priority
+		 * \param [in] allocator is a reference to PoolAllocator used by the list
 		 */
 
-		bool operator()(const Entry& left, const Entry& right) const
+		explicit EntryList(const PoolAllocator& allocator) :
+				list_{allocator},
+				lastEntries_{},
+				bitmap_{}
 		{
-			return left.priority < right.priority;
+
 		}
-	};
 
-	/// type of pool
-	using Pool = allocators::FeedablePool;
+		/**
+		 * \return iterator to first entry on the list (oldest entry with highest priority)
+		 */
 
-	/// type of pool allocator
-	using PoolAllocator = allocators::PoolAllocator<Entry, Pool>;
+		iterator begin()
+		{
+			return list_.begin();
+		}
 
-	/// type of free entry list
-	using FreeEntryList = std::forward_list<Entry, PoolAllocator>;
+		/**
+		 * \brief Removes first entry from the list.
+		 *
+		 * \note List must not be empty.
+		 */
+
+		void pop_front();
+
+		/**
+		 * \brief Inserts new entry after all entries with greater or equal priority.
+		 *
+		 * \param [in] entry is a reference to Entry that will be inserted
+		 */
+
+		void sortedEmplace(const Entry& entry);
+
+	private:
+
+		/// number of bits in one word of \a bitmap_
+		constexpr static size_t bitsPerWord {sizeof(uint32_t) * 8};
+
+		/// number of possible priorities
+		constexpr static size_t priorities {UINT8_MAX + 1};
+
+		/**
+		 * \brief Finds lowest priority of non-empty bucket which is higher than given priority.
+		 *
+		 * \param [in] priority is the priority of searched bucket
+		 *
+		 * \return lowest priority of non-empty bucket which is higher than \a priority, -1 if there is no such bucket
+		 */
+
+		int findNextHigherPriority(uint8_t priority) const;
+
+		/// underlying list of entries
+		List list_;
+
+		/// iterators to last entries of non-empty buckets, indexed by priority
+		std::array<iterator, priorities> lastEntries_;
 
-	/// type of entry list
-	using EntryList = containers::SortedContainer<FreeEntryList, DescendingPriority>;
+		/// bitmap of non-empty buckets - bit "n" is set if bucket with priority "n" is not empty
+		std::array<uint32_t, priorities / bitsPerWord> bitmap_;
+	};
 
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
@@ -147,6 +213,15 @@ public:
 
 	MessageQueueBase(EntryStorage* entryStorage, void* valueStorage, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \return const reference to semaphore with value equal to the number of elements in the queue
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -218,7 +293,7 @@ private:
 	/// PoolAllocator used by \a entryList_ and \a freeList_
 	PoolAllocator poolAllocator_;
 
-	/// list of available entries, sorted in descending order of priority
+	/// list of available entries, sorted in descending order of priority, FIFO order within priority
 	EntryList entryList_;
 
 	/// list of "free" entries
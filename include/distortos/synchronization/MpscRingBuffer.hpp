@@ -0,0 +1,125 @@
+/**
+ * \file
+ * \brief MpscRingBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_MPSCRINGBUFFER_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_MPSCRINGBUFFER_HPP_
+
+#include "distortos/synchronization/QueueFunctor.hpp"
+
+#include <atomic>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief MpscRingBuffer class is a lock-free ring buffer for multiple producers and single consumer.
+ *
+ * Each slot has an associated sequence number, which tells whether the slot is free for the producer with given
+ * free-running index or ready for the consumer. Producers reserve slots with compare-and-swap on the write index
+ * (LDREX/STREX on ARMv7-M), so they may be interrupts of different priorities preempting each other. No interrupt
+ * masking is needed. Capacity of the ring buffer must be a power of two.
+ *
+ * \note Elements are consumed strictly in the order of reservation - if a producer is preempted after reserving a slot,
+ * but before filling it, the consumer sees the ring buffer as empty until that producer finishes, even if some
+ * following slots are already filled.
+ */
+
+class MpscRingBuffer
+{
+public:
+
+	/// type of sequence number associated with each slot
+	using Sequence = std::atomic<size_t>;
+
+	/**
+	 * \brief MpscRingBuffer's constructor
+	 *
+	 * \param [in] sequenceStorage is an array of Sequence elements, one for each slot
+	 * \param [in] storage is a memory block for elements, sufficiently large for \a maxElements, each \a elementSize
+	 * bytes long
+	 * \param [in] elementSize is the size of single element, bytes
+	 * \param [in] maxElements is the number of elements in \a sequenceStorage array and \a storage memory block, must be
+	 * a power of two
+	 */
+
+	MpscRingBuffer(Sequence* sequenceStorage, void* storage, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \return size of single element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return elementSize_;
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the ring buffer.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will get a
+	 * pointer to storage with element
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - ring buffer is empty;
+	 */
+
+	int pop(const QueueFunctor& functor);
+
+	/**
+	 * \brief Pushes the element to the ring buffer.
+	 *
+	 * \note This function may be called by any number of concurrent producers.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get a
+	 * pointer to storage for element
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - ring buffer is full;
+	 */
+
+	int push(const QueueFunctor& functor);
+
+private:
+
+	/// sequence numbers of slots
+	Sequence* const sequences_;
+
+	/// storage for elements
+	uint8_t* const storage_;
+
+	/// size of single element, bytes
+	const size_t elementSize_;
+
+	/// mask used to convert free-running index to position in storage, equal to capacity - 1
+	const size_t mask_;
+
+	/// free-running index of first element available for reading, used only by the consumer
+	size_t readIndex_;
+
+	/// free-running index of first slot that is not yet reserved by any producer
+	std::atomic<size_t> writeIndex_;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_MPSCRINGBUFFER_HPP_
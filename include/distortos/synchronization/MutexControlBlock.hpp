@@ -8,13 +8,17 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 
-#include "distortos/scheduler/ThreadControlBlockList.hpp"
+#include "distortos/synchronization/MutexControlBlockBase.hpp"
+
+#include "distortos/scheduler/MutexControlBlockList.hpp"
+
+#include <array>
 
 namespace distortos
 {
@@ -22,8 +26,8 @@ namespace distortos
 namespace synchronization
 {
 
-/// MutexControlBlock class is a control block for Mutex
-class MutexControlBlock
+/// MutexControlBlock class is a control block for Mutex, with support for priority protocols
+class MutexControlBlock : public MutexControlBlockBase
 {
 public:
 
@@ -57,12 +61,13 @@ public:
 	 * \brief Blocks current thread with timeout, transferring it to blockedList_.
 	 *
 	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] slack is the max duration by which unblocking of the thread after \a timePoint may be delayed
 	 *
 	 * \return 0 on success, error code otherwise:
 	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
 	 */
 
-	int blockUntil(TickClock::time_point timePoint);
+	int blockUntil(TickClock::time_point timePoint, TickClock::duration slack);
 
 	/**
 	 * \brief Gets "boosted priority" of the mutex.
@@ -78,15 +83,6 @@ public:
 
 	uint8_t getBoostedPriority() const;
 
-	/**
-	 * \return owner of the mutex, nullptr if mutex is currently unlocked
-	 */
-
-	scheduler::ThreadControlBlock* getOwner() const
-	{
-		return owner_;
-	}
-
 	/**
 	 * \return priority ceiling of mutex, valid only when protocol_ == Protocol::PriorityProtect
 	 */
@@ -123,6 +119,18 @@ public:
 
 	void unlockOrTransferLock();
 
+	/**
+	 * \brief Performs unlocking of the mutex and unblocks next thread on the list.
+	 *
+	 * Mutex is always unlocked. If blockedList_ is not empty, the next thread is unblocked, but it doesn't become the
+	 * owner of the mutex - it has to try to lock the mutex again when it is executed, so any other thread (including
+	 * the current one) may lock the mutex in the meantime ("barging").
+	 *
+	 * \attention mutex must be locked
+	 */
+
+	void unlockAndUnblockNext();
+
 private:
 
 	/// type of object used as storage for MutexControlBlockList elements - 3 pointers
@@ -141,6 +149,8 @@ private:
 	/**
 	 * \brief Performs transfer of lock from current owner to next thread on the list.
 	 *
+	 * Moves the mutex to the list of mutexes owned by new owner.
+	 *
 	 * \attention mutex must be locked and blockedList_ must not be empty
 	 */
 
@@ -154,9 +164,6 @@ private:
 
 	void unlock();
 
-	/// ThreadControlBlock objects blocked on mutex
-	scheduler::ThreadControlBlockList blockedList_;
-
 	/// storage for list link
 	Link link_;
 
@@ -166,9 +173,6 @@ private:
 	/// iterator to the element on the list, valid only when list_ != nullptr
 	scheduler::MutexControlBlockList::iterator iterator_;
 
-	/// owner of the mutex
-	scheduler::ThreadControlBlock* owner_;
-
 	/// mutex protocol
 	Protocol protocol_;
 
@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \brief MutexControlBlockBase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXCONTROLBLOCKBASE_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXCONTROLBLOCKBASE_HPP_
+
+#include "distortos/scheduler/ThreadControlBlockList.hpp"
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief MutexControlBlockBase class is a control block for mutex without priority protocol.
+ *
+ * It is used directly by BasicMutex with Protocol::None and as a base of MutexControlBlock.
+ */
+
+class MutexControlBlockBase
+{
+public:
+
+	/**
+	 * \brief MutexControlBlockBase constructor
+	 */
+
+	MutexControlBlockBase();
+
+	/**
+	 * \brief Blocks current thread, transferring it to blockedList_.
+	 */
+
+	void block();
+
+	/**
+	 * \brief Blocks current thread with timeout, transferring it to blockedList_.
+	 *
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] slack is the max duration by which unblocking of the thread after \a timePoint may be delayed
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
+	 */
+
+	int blockUntil(TickClock::time_point timePoint, TickClock::duration slack);
+
+	/**
+	 * \return owner of the mutex, nullptr if mutex is currently unlocked
+	 */
+
+	scheduler::ThreadControlBlock* getOwner() const
+	{
+		return owner_;
+	}
+
+	/**
+	 * \return true if current thread is the owner of the mutex, false otherwise
+	 */
+
+	bool isOwnedByCurrentThread() const;
+
+	/**
+	 * \brief Performs actual locking of previously unlocked mutex.
+	 *
+	 * \attention mutex must be unlocked
+	 */
+
+	void lock();
+
+	/**
+	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
+	 *
+	 * Mutex is unlocked if blockedList_ is empty, otherwise the ownership is transfered to the next thread.
+	 *
+	 * \attention mutex must be locked
+	 */
+
+	void unlockOrTransferLock();
+
+protected:
+
+	/**
+	 * \brief Performs transfer of lock from current owner to next thread on the list.
+	 *
+	 * \attention mutex must be locked and blockedList_ must not be empty
+	 */
+
+	void transferLock();
+
+	/// ThreadControlBlock objects blocked on mutex
+	scheduler::ThreadControlBlockList blockedList_;
+
+	/// owner of the mutex
+	scheduler::ThreadControlBlock* owner_;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXCONTROLBLOCKBASE_HPP_
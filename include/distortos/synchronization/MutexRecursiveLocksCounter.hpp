@@ -0,0 +1,119 @@
+/**
+ * \file
+ * \brief MutexRecursiveLocksCounter class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-05
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXRECURSIVELOCKSCOUNTER_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXRECURSIVELOCKSCOUNTER_HPP_
+
+#include <limits>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief MutexRecursiveLocksCounter class counts recursive locks of mutex.
+ *
+ * \param RecursiveLocksCount is the type used for counting recursive locks
+ * \param Recursive selects whether the mutex is recursive (true) or not (false)
+ */
+
+template<typename RecursiveLocksCount, bool Recursive>
+class MutexRecursiveLocksCounter
+{
+public:
+
+	/**
+	 * \brief MutexRecursiveLocksCounter's constructor
+	 */
+
+	constexpr MutexRecursiveLocksCounter() :
+			recursiveLocksCount_{}
+	{
+
+	}
+
+	/**
+	 * \brief Decrements number of recursive locks.
+	 *
+	 * \return true if number of recursive locks was decremented, false if it was already zero
+	 */
+
+	bool decrementRecursiveLocksCount()
+	{
+		if (recursiveLocksCount_ == 0)
+			return false;
+
+		--recursiveLocksCount_;
+		return true;
+	}
+
+	/**
+	 * \brief Increments number of recursive locks.
+	 *
+	 * \return true if number of recursive locks was incremented, false if it already has the max value
+	 */
+
+	bool incrementRecursiveLocksCount()
+	{
+		if (recursiveLocksCount_ == std::numeric_limits<RecursiveLocksCount>::max())
+			return false;
+
+		++recursiveLocksCount_;
+		return true;
+	}
+
+private:
+
+	/// number of recursive locks
+	RecursiveLocksCount recursiveLocksCount_;
+};
+
+/**
+ * \brief MutexRecursiveLocksCounter class counts recursive locks of mutex.
+ *
+ * Specialization for mutex which is not recursive - it has no storage and its functions are never used.
+ *
+ * \param RecursiveLocksCount is the type used for counting recursive locks
+ */
+
+template<typename RecursiveLocksCount>
+class MutexRecursiveLocksCounter<RecursiveLocksCount, false>
+{
+public:
+
+	/**
+	 * \return false
+	 */
+
+	constexpr static bool decrementRecursiveLocksCount()
+	{
+		return false;
+	}
+
+	/**
+	 * \return false
+	 */
+
+	constexpr static bool incrementRecursiveLocksCount()
+	{
+		return false;
+	}
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_MUTEXRECURSIVELOCKSCOUNTER_HPP_
@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief SemaphoreObserver struct header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-29
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
+
+namespace distortos
+{
+
+class Semaphore;
+class WaitForAnySet;
+
+namespace synchronization
+{
+
+/// SemaphoreObserver struct is a node of intrusive list of observers of one Semaphore, used by WaitForAnySet
+struct SemaphoreObserver
+{
+	/**
+	 * \brief SemaphoreObserver's constructor
+	 *
+	 * \param [in] semaphoreArgument is a reference to observed Semaphore
+	 */
+
+	constexpr explicit SemaphoreObserver(const Semaphore& semaphoreArgument) :
+			semaphore{semaphoreArgument},
+			next{},
+			previous{},
+			waitForAnySet{}
+	{
+
+	}
+
+	/// observed Semaphore
+	const Semaphore& semaphore;
+
+	/// next observer of the same Semaphore, nullptr if this is the last one
+	SemaphoreObserver* next;
+
+	/// previous observer of the same Semaphore, nullptr if this is the first one
+	SemaphoreObserver* previous;
+
+	/// WaitForAnySet which registered this observer, nullptr if observer is not registered
+	WaitForAnySet* waitForAnySet;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SEMAPHORETRYWAITFORFUNCTOR_HPP_
@@ -33,10 +33,13 @@ public:
 	 * \brief SemaphoreTryWaitForFunctor's constructor
 	 *
 	 * \param [in] duration is the bounded duration for Semaphore::tryWaitFor() call
+	 * \param [in] slack is the slack for Semaphore::tryWaitFor() call, default - 0
 	 */
 
-	constexpr explicit SemaphoreTryWaitForFunctor(const TickClock::duration duration) :
-			duration_{duration}
+	constexpr explicit SemaphoreTryWaitForFunctor(const TickClock::duration duration,
+			const TickClock::duration slack = {}) :
+			duration_{duration},
+			slack_{slack}
 	{
 
 	}
@@ -55,6 +58,9 @@ private:
 
 	/// bounded duration for Semaphore::tryWaitFor() call
 	const TickClock::duration duration_;
+
+	/// slack for Semaphore::tryWaitFor() call
+	const TickClock::duration slack_;
 };
 
 }	// namespace synchronization
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SEMAPHORETRYWAITUNTILFUNCTOR_HPP_
@@ -34,10 +34,13 @@ public:
 	 * \brief SemaphoreTryWaitUntilFunctor's constructor
 	 *
 	 * \param [in] timePoint is the bounded time point for Semaphore::tryWaitUntil() call
+	 * \param [in] slack is the slack for Semaphore::tryWaitUntil() call, default - 0
 	 */
 
-	constexpr explicit SemaphoreTryWaitUntilFunctor(const TickClock::time_point timePoint) :
-			timePoint_{timePoint}
+	constexpr explicit SemaphoreTryWaitUntilFunctor(const TickClock::time_point timePoint,
+			const TickClock::duration slack = {}) :
+			timePoint_{timePoint},
+			slack_{slack}
 	{
 
 	}
@@ -56,6 +59,9 @@ private:
 
 	/// bounded time point for Semaphore::tryWaitUntil() call
 	const TickClock::time_point timePoint_;
+
+	/// slack for Semaphore::tryWaitUntil() call
+	const TickClock::duration slack_;
 };
 
 }	// namespace synchronization
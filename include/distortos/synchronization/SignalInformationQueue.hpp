@@ -8,18 +8,16 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-31
+ * \date 2015-06-01
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SIGNALINFORMATIONQUEUE_HPP_
 #define INCLUDE_DISTORTOS_SYNCHRONIZATION_SIGNALINFORMATIONQUEUE_HPP_
 
-#include "distortos/allocators/PoolAllocator.hpp"
-#include "distortos/allocators/FeedablePool.hpp"
-
 #include "distortos/SignalInformation.hpp"
 
-#include <forward_list>
+#include <type_traits>
+#include <utility>
 
 namespace distortos
 {
@@ -29,17 +27,29 @@ class SignalSet;
 namespace synchronization
 {
 
-/// SignalInformationQueue class can be used for queuing of SignalInformation objects
+/**
+ * \brief SignalInformationQueue class can be used for queuing of SignalInformation objects
+ *
+ * Queued objects are kept on separate FIFO lists for each signal number, so queuing, accepting and getting the set of
+ * queued signals all execute in constant time.
+ */
+
 class SignalInformationQueue
 {
 public:
 
-	/// link and SignalInformation
-	using LinkAndSignalInformation = std::pair<void*, SignalInformation>;
+	/// SignalInformation with link to next node on the same list
+	struct QueueNode
+	{
+		/// pointer to next node on the same list
+		QueueNode* next;
+
+		/// queued SignalInformation
+		SignalInformation signalInformation;
+	};
 
-	/// type of uninitialized storage for SignalInformation with link
-	using Storage =
-			typename std::aligned_storage<sizeof(LinkAndSignalInformation), alignof(LinkAndSignalInformation)>::type;
+	/// type of uninitialized storage for QueueNode
+	using Storage = typename std::aligned_storage<sizeof(QueueNode), alignof(QueueNode)>::type;
 
 	/**
 	 * \brief SignalInformationQueue's constructor
@@ -85,23 +95,18 @@ public:
 
 private:
 
-	/// type of allocator used by \a List
-	using PoolAllocator = allocators::PoolAllocator<SignalInformation, allocators::FeedablePool>;
-
-	/// type of container with SignalInformation objects
-	using List = std::forward_list<SignalInformation, PoolAllocator>;
-
-	/// PoolAllocator::Pool used by \a poolAllocator_
-	PoolAllocator::Pool pool_;
+	/// number of supported signals
+	constexpr static size_t signalsCount {32};
 
-	/// PoolAllocator used by \a signalInformationList_ and \a freeSignalInformationList_
-	PoolAllocator poolAllocator_;
+	/// tails of circular lists of queued nodes, one for each signal number - head of each list is the node following
+	/// the tail, nullptr if no signal with given number is queued
+	QueueNode* queuedTails_[signalsCount];
 
-	/// list of queued SignalInformation objects
-	List signalInformationList_;
+	/// first node on the list of "free" nodes, nullptr if no "free" nodes are available
+	QueueNode* freeNodes_;
 
-	/// list of "free" SignalInformation objects
-	List freeSignalInformationList_;
+	/// bitmask of signals that are currently queued
+	uint32_t queuedSignalMask_;
 };
 
 }	// namespace synchronization
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-17
+ * \date 2015-06-01
  */
 
 #ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SIGNALSCATCHERCONTROLBLOCK_HPP_
@@ -51,10 +51,11 @@ public:
 
 	constexpr SignalsCatcherControlBlock(Storage* const storageBegin, Storage* const storageEnd) :
 			signalMask_{SignalSet::empty},
-			associationsBegin_{reinterpret_cast<decltype(associationsBegin_)>(storageBegin)},
+			originalStorageBegin_{storageBegin},
 			storageBegin_{storageBegin},
 			storageEnd_{storageEnd},
-			deliveryIsPending_{}
+			deliveryIsPending_{},
+			associationIndexes_{}
 	{
 
 	}
@@ -162,6 +163,18 @@ private:
 
 	SignalAction clearAssociation(uint8_t signalNumber, Association& association);
 
+	/**
+	 * \brief Finds Association for given signal number.
+	 *
+	 * Uses \a associationIndexes_, so the cost is constant.
+	 *
+	 * \param [in] signalNumber is the signal for which the association will be searched, [0; 31]
+	 *
+	 * \return pointer to found Association object, \a associationsEnd_ if there is no association for \a signalNumber
+	 */
+
+	Association* findNumberAssociation(uint8_t signalNumber) const;
+
 	/**
 	 * \brief Requests delivery of signals to associated thread.
 	 *
@@ -170,11 +183,33 @@ private:
 
 	void requestDeliveryOfSignals(const scheduler::ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Updates \a associationIndexes_ for all signal numbers from given association.
+	 *
+	 * Used when Association object is created or moved to a different position in the range.
+	 *
+	 * \param [in] association is a reference to Association object from <em>[associationsBegin_; associationsEnd_)</em>
+	 * range
+	 */
+
+	void updateAssociationIndexes(const Association& association);
+
+	/// number of supported signals
+	constexpr static size_t signalsCount {32};
+
 	/// SignalSet with signal mask for associated thread
 	SignalSet signalMask_;
 
-	/// pointer to first element of range of Association objects
-	Association* associationsBegin_;
+	/// union binds \a associationsBegin_ and \a originalStorageBegin_ - these point to the same address, the second one
+	/// is used only to initialize the object without reinterpret_cast (which is not allowed in constexpr constructor)
+	union
+	{
+		/// pointer to first element of range of Association objects
+		Association* associationsBegin_;
+
+		/// pointer to first element of range of Storage objects, as passed to constructor
+		Storage* originalStorageBegin_;
+	};
 
 	/// union binds \a associationsEnd_ and \a storageBegin_ - these point to the same address
 	union
@@ -191,6 +226,11 @@ private:
 
 	/// true if signal delivery is pending, false otherwise
 	bool deliveryIsPending_;
+
+	/// index of Association object for each signal number, incremented by 1 - 0 means that there's no association for
+	/// this signal number; each Association object has at least one signal number associated, so there are never more
+	/// than \a signalsCount objects in use, regardless of the size of storage
+	uint8_t associationIndexes_[signalsCount];
 };
 
 }	// namespace synchronization
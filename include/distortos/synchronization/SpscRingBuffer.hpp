@@ -0,0 +1,112 @@
+/**
+ * \file
+ * \brief SpscRingBuffer class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_SPSCRINGBUFFER_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_SPSCRINGBUFFER_HPP_
+
+#include "distortos/synchronization/QueueFunctor.hpp"
+
+#include <atomic>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief SpscRingBuffer class is a lock-free ring buffer for single producer and single consumer.
+ *
+ * Producer and consumer synchronize only via atomic accesses to read and write indexes, so no interrupt masking is
+ * needed. Indexes are "free-running" and capacity of the ring buffer must be a power of two, so that position in the
+ * storage can be obtained with a simple mask.
+ */
+
+class SpscRingBuffer
+{
+public:
+
+	/**
+	 * \brief SpscRingBuffer's constructor
+	 *
+	 * \param [in] storage is a memory block for elements, sufficiently large for \a maxElements, each \a elementSize
+	 * bytes long
+	 * \param [in] elementSize is the size of single element, bytes
+	 * \param [in] maxElements is the number of elements in storage memory block, must be a power of two
+	 */
+
+	SpscRingBuffer(void* storage, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \return size of single element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return elementSize_;
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the ring buffer.
+	 *
+	 * \note This function may be called only by the consumer.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will get a
+	 * pointer to storage with element
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - ring buffer is empty;
+	 */
+
+	int pop(const QueueFunctor& functor);
+
+	/**
+	 * \brief Pushes the element to the ring buffer.
+	 *
+	 * \note This function may be called only by the producer.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get a
+	 * pointer to storage for element
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - ring buffer is full;
+	 */
+
+	int push(const QueueFunctor& functor);
+
+private:
+
+	/// storage for elements
+	uint8_t* const storage_;
+
+	/// size of single element, bytes
+	const size_t elementSize_;
+
+	/// mask used to convert free-running index to position in storage, equal to capacity - 1
+	const size_t mask_;
+
+	/// free-running index of first element available for reading, modified only by the consumer
+	std::atomic<size_t> readIndex_;
+
+	/// free-running index of first free slot available for writing, modified only by the producer
+	std::atomic<size_t> writeIndex_;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_SPSCRINGBUFFER_HPP_
@@ -0,0 +1,112 @@
+/**
+ * \file
+ * \brief VersionedValue class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-06
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYNCHRONIZATION_VERSIONEDVALUE_HPP_
+#define INCLUDE_DISTORTOS_SYNCHRONIZATION_VERSIONEDVALUE_HPP_
+
+#include <atomic>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/**
+ * \brief VersionedValue class is a value with single writer, which can be read without interrupt masking from any
+ * context.
+ *
+ * Value is stored in two slots and a sequence number selects the one which is valid. Writer fills the slot which is not
+ * valid and then increments the sequence number, so the slot used by readers is never modified "in place". Reader gets
+ * the sequence number, copies the selected slot and checks whether the sequence number is still the same - if not, the
+ * copy may be torn and the read is retried.
+ *
+ * Reader which preempts the writer (e.g. interrupt with priority higher than the one used for interrupt masking) never
+ * retries, because writer modifies only the slot which is not valid yet - such reader gets the previous value. Reader
+ * which is preempted by the writer retries at most once per write that happened in the meantime.
+ *
+ * \attention Writes must be serialized (e.g. done only with interrupts masked), as there may be only one writer at a
+ * time.
+ *
+ * \param T is the type of value, should be trivially copyable
+ */
+
+template<typename T>
+class VersionedValue
+{
+public:
+
+	/**
+	 * \brief VersionedValue's constructor
+	 *
+	 * \param [in] value is the initial value, default - value-initialized
+	 */
+
+	constexpr explicit VersionedValue(const T& value = {}) :
+			values_{value, value},
+			sequence_{0}
+	{
+
+	}
+
+	/**
+	 * \brief Reads the value.
+	 *
+	 * \note This function may be called from any context, with or without interrupts masked.
+	 *
+	 * \return current value
+	 */
+
+	T load() const
+	{
+		while (1)
+		{
+			const auto sequence = sequence_.load(std::memory_order_acquire);
+			const T value = values_[sequence % 2];
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (sequence_.load(std::memory_order_relaxed) == sequence)
+				return value;
+		}
+	}
+
+	/**
+	 * \brief Writes the value.
+	 *
+	 * \attention This function must not be called concurrently with itself.
+	 *
+	 * \param [in] value is the new value
+	 */
+
+	void store(const T& value)
+	{
+		const auto sequence = sequence_.load(std::memory_order_relaxed) + 1;
+		values_[sequence % 2] = value;
+		sequence_.store(sequence, std::memory_order_release);
+	}
+
+private:
+
+	/// two slots for value, the one selected by \a sequence_ is valid
+	T values_[2];
+
+	/// sequence number, incremented after each write
+	std::atomic<uint32_t> sequence_;
+};
+
+}	// namespace synchronization
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SYNCHRONIZATION_VERSIONEDVALUE_HPP_
@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief getTlsfHeap() declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-28
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYSCALLS_GETTLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_SYSCALLS_GETTLSFHEAP_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_TLSF_HEAP == 1
+
+namespace distortos
+{
+
+namespace allocators
+{
+
+class TlsfHeap;
+
+}	// namespace allocators
+
+namespace syscalls
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets TLSF heap used by malloc() and related functions.
+ *
+ * \note Access to the heap must be done with interrupts masked.
+ *
+ * \return reference to TLSF heap used by malloc() and related functions
+ */
+
+allocators::TlsfHeap& getTlsfHeap();
+
+}	// namespace syscalls
+
+}	// namespace distortos
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#endif	// INCLUDE_DISTORTOS_SYSCALLS_GETTLSFHEAP_HPP_
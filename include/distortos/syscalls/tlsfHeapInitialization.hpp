@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief tlsfHeapInitialization() declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-28
+ */
+
+#ifndef INCLUDE_DISTORTOS_SYSCALLS_TLSFHEAPINITIALIZATION_HPP_
+#define INCLUDE_DISTORTOS_SYSCALLS_TLSFHEAPINITIALIZATION_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_TLSF_HEAP == 1
+
+namespace distortos
+{
+
+namespace syscalls
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Initializes TLSF heap used by malloc() and related functions.
+ *
+ * The heap manages whole area between __heap_start and __heap_end symbols from linker script.
+ *
+ * This function is called before constructors for global and static objects from __libc_init_array() via address in
+ * distortosPreinitArray[].
+ */
+
+void tlsfHeapInitialization();
+
+}	// namespace syscalls
+
+}	// namespace distortos
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#endif	// INCLUDE_DISTORTOS_SYSCALLS_TLSFHEAPINITIALIZATION_HPP_
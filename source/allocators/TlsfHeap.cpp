@@ -0,0 +1,499 @@
+/**
+ * \file
+ * \brief TlsfHeap class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-28
+ */
+
+#include "distortos/allocators/TlsfHeap.hpp"
+
+#include <new>
+
+namespace distortos
+{
+
+namespace allocators
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// header of block, followed by usable storage
+struct TlsfHeap::Block
+{
+	/// mask of "free" flag in \a sizeAndFlags
+	constexpr static size_t freeFlag {1};
+
+	/**
+	 * \brief Converts pointer to usable storage to pointer to block.
+	 *
+	 * \param [in] storage is a pointer to usable storage of block
+	 *
+	 * \return pointer to block
+	 */
+
+	static Block* fromStorage(const void* const storage)
+	{
+		return reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(storage) - headerSize());
+	}
+
+	/**
+	 * \return size of header of used block, bytes
+	 */
+
+	constexpr static size_t headerSize()
+	{
+		return sizeof(Block*) + sizeof(size_t);
+	}
+
+	/**
+	 * \return min size of usable storage of block - enough for links of free block, bytes
+	 */
+
+	constexpr static size_t minimumSize()
+	{
+		return sizeof(Block*) * 2;
+	}
+
+	/**
+	 * \return pointer to next physical block
+	 */
+
+	Block* getNextPhysical() const
+	{
+		return reinterpret_cast<Block*>(static_cast<uint8_t*>(getStorage()) + getSize());
+	}
+
+	/**
+	 * \return size of usable storage of block, bytes
+	 */
+
+	size_t getSize() const
+	{
+		return sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \return pointer to usable storage of block
+	 */
+
+	void* getStorage() const
+	{
+		return reinterpret_cast<uint8_t*>(const_cast<Block*>(this)) + headerSize();
+	}
+
+	/**
+	 * \return true if block is free, false otherwise
+	 */
+
+	bool isFree() const
+	{
+		return (sizeAndFlags & freeFlag) != 0;
+	}
+
+	/**
+	 * \brief Sets "free" flag.
+	 *
+	 * \param [in] isFree selects whether the block is free (true) or used (false)
+	 */
+
+	void setFree(const bool isFree)
+	{
+		sizeAndFlags = isFree == true ? sizeAndFlags | freeFlag : sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \brief Sets size of block, preserving flags.
+	 *
+	 * \param [in] size is the new size of usable storage of block, bytes
+	 */
+
+	void setSize(const size_t size)
+	{
+		sizeAndFlags = size | (sizeAndFlags & freeFlag);
+	}
+
+	/// pointer to previous physical block, nullptr for the first block in the heap
+	Block* previousPhysical;
+
+	/// size of usable storage of block, bytes, ORed with flags
+	size_t sizeAndFlags;
+
+	/// pointer to next block on the same free list, valid only for free blocks
+	Block* nextFree;
+
+	/// pointer to previous block on the same free list, valid only for free blocks
+	Block* previousFree;
+};
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Rounds value up to a multiple of alignment.
+ *
+ * \param [in] value is the value that will be rounded
+ * \param [in] alignment is the alignment, must be a power of two
+ *
+ * \return \a value rounded up to a multiple of \a alignment
+ */
+
+constexpr uintptr_t alignUp(const uintptr_t value, const size_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * \param [in] value is the value that will be scanned, must not be zero
+ *
+ * \return index of the most significant set bit of \a value
+ */
+
+int findLastSet(const size_t value)
+{
+	return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+}
+
+/**
+ * \param [in] value is the value that will be scanned, must not be zero
+ *
+ * \return index of the least significant set bit of \a value
+ */
+
+int findFirstSet(const uint32_t value)
+{
+	return __builtin_ctz(value);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TlsfHeap::TlsfHeap(void* const storage, size_t size) :
+		freeLists_{},
+		secondLevelBitmaps_{},
+		firstLevelBitmap_{},
+		totalSize_{},
+		freeSize_{},
+		minimumFreeSize_{},
+		freeBlocks_{},
+		usedBlocks_{}
+{
+	const auto begin = alignUp(reinterpret_cast<uintptr_t>(storage), alignment);
+	const auto adjustment = begin - reinterpret_cast<uintptr_t>(storage);
+	if (size < adjustment + 2 * Block::headerSize() + Block::minimumSize())
+		return;
+
+	size = (size - adjustment) & ~(alignment - 1);
+	if (size > (size_t{1} << firstLevelMax))
+		size = size_t{1} << firstLevelMax;
+
+	totalSize_ = size;
+
+	// one block covering whole area, followed by zero-sized "used" block which terminates the heap
+	const auto block = new (reinterpret_cast<void*>(begin)) Block;
+	block->previousPhysical = nullptr;
+	block->sizeAndFlags = size - 2 * Block::headerSize();
+	const auto sentinel = new (block->getNextPhysical()) Block;
+	sentinel->previousPhysical = block;
+	sentinel->sizeAndFlags = 0;
+
+	insertFreeBlock(block);
+	minimumFreeSize_ = freeSize_;
+}
+
+void* TlsfHeap::allocate(const size_t size)
+{
+	if (size >= (size_t{1} << firstLevelMax))
+		return nullptr;
+
+	const auto adjustedSize = size > Block::minimumSize() ? alignUp(size, alignment) : Block::minimumSize();
+	const auto block = findAndRemoveFreeBlock(adjustedSize);
+	if (block == nullptr)
+		return nullptr;
+
+	return markUsed(block, adjustedSize);
+}
+
+void* TlsfHeap::allocateAligned(const size_t blockAlignment, const size_t size)
+{
+	if (blockAlignment <= alignment)
+		return allocate(size);
+
+	// gap in front of aligned storage must be large enough to become a separate free block
+	constexpr auto minimumGap = Block::headerSize() + Block::minimumSize();
+	if (size >= (size_t{1} << firstLevelMax) - blockAlignment - minimumGap)
+		return nullptr;
+
+	const auto adjustedSize = size > Block::minimumSize() ? alignUp(size, alignment) : Block::minimumSize();
+	auto block = findAndRemoveFreeBlock(adjustedSize + blockAlignment + minimumGap);
+	if (block == nullptr)
+		return nullptr;
+
+	const auto storage = reinterpret_cast<uintptr_t>(block->getStorage());
+	auto alignedStorage = alignUp(storage, blockAlignment);
+	if (alignedStorage != storage && alignedStorage - storage < minimumGap)
+		alignedStorage = alignUp(storage + minimumGap, blockAlignment);
+
+	if (alignedStorage != storage)
+	{
+		const auto gap = alignedStorage - storage;
+		const auto alignedBlock = new (reinterpret_cast<void*>(alignedStorage - Block::headerSize())) Block;
+		alignedBlock->previousPhysical = block;
+		alignedBlock->sizeAndFlags = block->getSize() - gap;
+		alignedBlock->getNextPhysical()->previousPhysical = alignedBlock;
+		block->setSize(gap - Block::headerSize());
+		// previous physical block of the gap is not free, as all free blocks are merged with their neighbours
+		insertFreeBlock(block);
+		block = alignedBlock;
+	}
+
+	return markUsed(block, adjustedSize);
+}
+
+void TlsfHeap::deallocate(void* const storage)
+{
+	if (storage == nullptr)
+		return;
+
+	auto block = Block::fromStorage(storage);
+	--usedBlocks_;
+
+	const auto previous = block->previousPhysical;
+	if (previous != nullptr && previous->isFree() == true)
+	{
+		removeFreeBlock(previous);
+		previous->setSize(previous->getSize() + Block::headerSize() + block->getSize());
+		previous->getNextPhysical()->previousPhysical = previous;
+		block = previous;
+	}
+
+	mergeWithNext(block);
+	insertFreeBlock(block);
+}
+
+size_t TlsfHeap::getBlockSize(const void* const storage)
+{
+	return Block::fromStorage(storage)->getSize();
+}
+
+TlsfHeap::Statistics TlsfHeap::getStatistics() const
+{
+	size_t largestFreeBlock {};
+	if (firstLevelBitmap_ != 0)
+	{
+		// the largest free block is on the highest non-empty list, but sizes on that list are not sorted
+		const auto firstLevelIndex = findLastSet(firstLevelBitmap_);
+		const auto secondLevelIndex = findLastSet(secondLevelBitmaps_[firstLevelIndex]);
+		for (auto block = freeLists_[firstLevelIndex][secondLevelIndex]; block != nullptr; block = block->nextFree)
+			if (block->getSize() > largestFreeBlock)
+				largestFreeBlock = block->getSize();
+	}
+
+	const auto fragmentation = freeSize_ != 0 ? 100 - largestFreeBlock * 100 / freeSize_ : 0;
+	return {totalSize_, freeSize_, minimumFreeSize_, largestFreeBlock, freeBlocks_, usedBlocks_,
+			static_cast<uint8_t>(fragmentation)};
+}
+
+bool TlsfHeap::resize(void* const storage, const size_t size)
+{
+	if (size >= (size_t{1} << firstLevelMax))
+		return false;
+
+	const auto adjustedSize = size > Block::minimumSize() ? alignUp(size, alignment) : Block::minimumSize();
+	const auto block = Block::fromStorage(storage);
+
+	if (adjustedSize > block->getSize())
+	{
+		const auto next = block->getNextPhysical();
+		if (next->isFree() == false || block->getSize() + Block::headerSize() + next->getSize() < adjustedSize)
+			return false;
+
+		removeFreeBlock(next);
+		block->setSize(block->getSize() + Block::headerSize() + next->getSize());
+		block->getNextPhysical()->previousPhysical = block;
+	}
+
+	const auto tail = split(block, adjustedSize);
+	if (tail != nullptr)
+	{
+		mergeWithNext(tail);
+		insertFreeBlock(tail);
+	}
+
+	if (freeSize_ < minimumFreeSize_)
+		minimumFreeSize_ = freeSize_;
+
+	return true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TlsfHeap::Block* TlsfHeap::findAndRemoveFreeBlock(size_t size)
+{
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+
+	// round size up to the next list boundary, so that any block on the found list is large enough
+	if (size >= (size_t{1} << firstLevelShift))
+	{
+		const auto lastSet = findLastSet(size);
+		size += (size_t{1} << (lastSet - secondLevelCountLog2)) - 1;
+		const auto roundedLastSet = findLastSet(size);
+		firstLevelIndex = roundedLastSet - firstLevelShift + 1;
+		secondLevelIndex = (size >> (roundedLastSet - secondLevelCountLog2)) ^ secondLevelCount;
+	}
+	else
+	{
+		firstLevelIndex = 0;
+		secondLevelIndex = size / ((size_t{1} << firstLevelShift) / secondLevelCount);
+	}
+
+	if (firstLevelIndex >= firstLevelCount)
+		return nullptr;
+
+	auto secondLevelBitmap = secondLevelBitmaps_[firstLevelIndex] & (~uint32_t{} << secondLevelIndex);
+	if (secondLevelBitmap == 0)
+	{
+		const auto firstLevelBitmap = firstLevelBitmap_ & (~uint32_t{} << (firstLevelIndex + 1));
+		if (firstLevelBitmap == 0)
+			return nullptr;
+
+		firstLevelIndex = findFirstSet(firstLevelBitmap);
+		secondLevelBitmap = secondLevelBitmaps_[firstLevelIndex];
+	}
+
+	secondLevelIndex = findFirstSet(secondLevelBitmap);
+	const auto block = freeLists_[firstLevelIndex][secondLevelIndex];
+	removeFreeBlock(block);
+	return block;
+}
+
+void TlsfHeap::insertFreeBlock(Block* const block)
+{
+	const auto size = block->getSize();
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+	if (size >= (size_t{1} << firstLevelShift))
+	{
+		const auto lastSet = findLastSet(size);
+		firstLevelIndex = lastSet - firstLevelShift + 1;
+		secondLevelIndex = (size >> (lastSet - secondLevelCountLog2)) ^ secondLevelCount;
+	}
+	else
+	{
+		firstLevelIndex = 0;
+		secondLevelIndex = size / ((size_t{1} << firstLevelShift) / secondLevelCount);
+	}
+
+	auto& head = freeLists_[firstLevelIndex][secondLevelIndex];
+	block->nextFree = head;
+	block->previousFree = nullptr;
+	if (head != nullptr)
+		head->previousFree = block;
+	head = block;
+
+	secondLevelBitmaps_[firstLevelIndex] |= uint32_t{1} << secondLevelIndex;
+	firstLevelBitmap_ |= uint32_t{1} << firstLevelIndex;
+
+	block->setFree(true);
+	++freeBlocks_;
+	freeSize_ += size;
+}
+
+void* TlsfHeap::markUsed(Block* const block, const size_t size)
+{
+	const auto tail = split(block, size);
+	if (tail != nullptr)
+	{
+		mergeWithNext(tail);
+		insertFreeBlock(tail);
+	}
+
+	++usedBlocks_;
+	if (freeSize_ < minimumFreeSize_)
+		minimumFreeSize_ = freeSize_;
+
+	return block->getStorage();
+}
+
+void TlsfHeap::mergeWithNext(Block* const block)
+{
+	const auto next = block->getNextPhysical();
+	if (next->isFree() == false)
+		return;
+
+	removeFreeBlock(next);
+	block->setSize(block->getSize() + Block::headerSize() + next->getSize());
+	block->getNextPhysical()->previousPhysical = block;
+}
+
+void TlsfHeap::removeFreeBlock(Block* const block)
+{
+	const auto size = block->getSize();
+	size_t firstLevelIndex;
+	size_t secondLevelIndex;
+	if (size >= (size_t{1} << firstLevelShift))
+	{
+		const auto lastSet = findLastSet(size);
+		firstLevelIndex = lastSet - firstLevelShift + 1;
+		secondLevelIndex = (size >> (lastSet - secondLevelCountLog2)) ^ secondLevelCount;
+	}
+	else
+	{
+		firstLevelIndex = 0;
+		secondLevelIndex = size / ((size_t{1} << firstLevelShift) / secondLevelCount);
+	}
+
+	if (block->nextFree != nullptr)
+		block->nextFree->previousFree = block->previousFree;
+	if (block->previousFree != nullptr)
+		block->previousFree->nextFree = block->nextFree;
+	else	// block was the head of the list
+	{
+		freeLists_[firstLevelIndex][secondLevelIndex] = block->nextFree;
+		if (block->nextFree == nullptr)	// list is now empty?
+		{
+			secondLevelBitmaps_[firstLevelIndex] &= ~(uint32_t{1} << secondLevelIndex);
+			if (secondLevelBitmaps_[firstLevelIndex] == 0)
+				firstLevelBitmap_ &= ~(uint32_t{1} << firstLevelIndex);
+		}
+	}
+
+	block->setFree(false);
+	--freeBlocks_;
+	freeSize_ -= size;
+}
+
+TlsfHeap::Block* TlsfHeap::split(Block* const block, const size_t size)
+{
+	const auto remaining = block->getSize() - size;
+	if (remaining < Block::headerSize() + Block::minimumSize())
+		return nullptr;
+
+	const auto tail = new (static_cast<uint8_t*>(block->getStorage()) + size) Block;
+	tail->previousPhysical = block;
+	tail->sizeAndFlags = remaining - Block::headerSize();
+	tail->getNextPhysical()->previousPhysical = tail;
+	block->setSize(size);
+	return tail;
+}
+
+}	// namespace allocators
+
+}	// namespace distortos
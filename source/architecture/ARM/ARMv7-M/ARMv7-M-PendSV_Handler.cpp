@@ -8,12 +8,22 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-24
+ * \date 2015-06-07
  */
 
 #include "distortos/scheduler/getScheduler.hpp"
 #include "distortos/scheduler/Scheduler.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include "distortos/scheduler/executeDeferredRequests.hpp"
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include "distortos/memorySections.h"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -34,7 +44,7 @@ namespace
  * \return new thread's stack pointer
  */
 
-void* schedulerSwitchContextWrapper(void* const stackPointer)
+DISTORTOS_RAMFUNC void* schedulerSwitchContextWrapper(void* const stackPointer)
 {
 	return scheduler::getScheduler().switchContext(stackPointer);
 }
@@ -48,13 +58,21 @@ void* schedulerSwitchContextWrapper(void* const stackPointer)
 /**
  * \brief PendSV_Handler() for ARMv7-M (Cortex-M3 / Cortex-M4)
  *
- * Performs the context switch.
+ * Executes deferred requests (if enabled) and performs the context switch. Deferred requests are executed before the
+ * context of current thread is saved, so they may use any function of the system (including the ones which modify
+ * the stack of current thread, like ThreadBase::generateSignal()).
  */
 
-extern "C" __attribute__ ((naked)) void PendSV_Handler()
+extern "C" DISTORTOS_RAMFUNC __attribute__ ((naked)) void PendSV_Handler()
 {
 	asm volatile
 	(
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+			"	push		{r0, lr}						\n"	// r0 is pushed only to keep the stack aligned to 8 bytes
+			"	bl			%[executeDeferredRequests]		\n"	// execute requests from "zero-latency" interrupts
+			"	pop			{r0, lr}						\n"
+			"												\n"
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
 			"	mrs			r0, PSP							\n"
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 			"	tst			lr, #(1 << 4)					\n"	// was floating-point used by the thread?
@@ -82,6 +100,9 @@ extern "C" __attribute__ ((naked)) void PendSV_Handler()
 			"	bx			lr								\n"	// return to new thread
 
 			::	[schedulerSwitchContext] "i" (schedulerSwitchContextWrapper)
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+				, [executeDeferredRequests] "i" (scheduler::executeDeferredRequests)
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
 	);
 
 	__builtin_unreachable();
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-02
  */
 
 #include "distortos/scheduler/getScheduler.hpp"
@@ -16,6 +16,8 @@
 
 #include "distortos/architecture/requestContextSwitch.hpp"
 
+#include "distortos/memorySections.h"
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -26,7 +28,7 @@
  * Tick interrupt of scheduler.
  */
 
-extern "C" void SysTick_Handler()
+extern "C" DISTORTOS_RAMFUNC void SysTick_Handler()
 {
 	const auto contextSwitchRequired = distortos::scheduler::getScheduler().tickInterruptHandler();
 	if (contextSwitchRequired == true)
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief enableCycleCounter() and getCycleCount() implementation for ARMv7-M (Cortex-M3 / Cortex-M4)
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// true if CYCCNT register of DWT is used, false if cycle count is derived from SysTick
+bool dwtCycleCounterUsed;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets cycle count derived from tick count and current value of SysTick.
+ *
+ * Used when DWT has no cycle counter or when it doesn't work (e.g. in QEMU).
+ *
+ * \return current value of cycle counter emulated with SysTick
+ */
+
+uint32_t getSysTickCycleCount()
+{
+	InterruptMaskingLock interruptMaskingLock;
+
+	auto value = SysTick->VAL;
+	auto tickCount = scheduler::getScheduler().getTickCount();
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)	// SysTick wrapped, but its interrupt was not handled yet?
+	{
+		value = SysTick->VAL;
+		++tickCount;
+	}
+
+	const auto reload = SysTick->LOAD;
+	return static_cast<uint32_t>(tickCount) * (reload + 1) + reload - value;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool enableCycleCounter()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	if ((DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) != 0)	// cycle counter not implemented?
+		return dwtCycleCounterUsed = false;
+
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	const auto start = DWT->CYCCNT;
+	asm volatile ("nop\n nop\n nop\n nop");
+	return dwtCycleCounterUsed = DWT->CYCCNT != start;
+}
+
+uint32_t getCycleCount()
+{
+	return dwtCycleCounterUsed == true ? DWT->CYCCNT : getSysTickCycleCount();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
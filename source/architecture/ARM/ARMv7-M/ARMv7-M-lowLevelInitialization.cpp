@@ -8,13 +8,21 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-21
+ * \date 2015-06-04
  */
 
 #include "distortos/architecture/lowLevelInitialization.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 namespace distortos
 {
 
@@ -30,6 +38,10 @@ void lowLevelInitialization()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= (3 << 10 * 2) | (3 << 11 * 2);	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+	enableCycleCounter();
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
 }
 
 }	// namespace architecture
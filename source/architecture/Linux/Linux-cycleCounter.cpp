@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief enableCycleCounter() and getCycleCount() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-03
+ */
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include <ctime>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool enableCycleCounter()
+{
+	return false;	// cycle count is emulated with monotonic clock of the host
+}
+
+uint32_t getCycleCount()
+{
+	timespec timeSpec;
+	clock_gettime(CLOCK_MONOTONIC, &timeSpec);
+	// one "cycle" is one nanosecond
+	return static_cast<uint32_t>(timeSpec.tv_sec) * 1000000000 + static_cast<uint32_t>(timeSpec.tv_nsec);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief enableInterruptMasking() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#include "distortos/architecture/enableInterruptMasking.hpp"
+
+#include "interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+InterruptMask enableInterruptMasking()
+{
+	return setInterruptMasking(true);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
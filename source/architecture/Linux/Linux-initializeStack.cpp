@@ -0,0 +1,107 @@
+/**
+ * \file
+ * \brief initializeStack() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#include "distortos/architecture/initializeStack.hpp"
+
+#include "interrupts.hpp"
+
+#include <cstdint>
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of thread's function
+using Function = void(ThreadBase&);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Joins two halves of pointer passed via makecontext() as int arguments.
+ *
+ * \param [in] low is the lower half of pointer
+ * \param [in] high is the upper half of pointer
+ *
+ * \return joined pointer
+ */
+
+uintptr_t joinPointer(const int low, const int high)
+{
+	return static_cast<uintptr_t>(static_cast<uint32_t>(low)) |
+			static_cast<uintptr_t>(static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32);
+}
+
+/**
+ * \brief Entry point of each thread.
+ *
+ * Thread is started by context switch, which is done with enabled "interrupt" masking - masking is disabled before
+ * thread's function is executed, just like during exception return on ARMv7-M.
+ *
+ * \param [in] functionLow is the lower half of pointer to thread's function
+ * \param [in] functionHigh is the upper half of pointer to thread's function
+ * \param [in] threadBaseLow is the lower half of pointer to ThreadBase object passed to function
+ * \param [in] threadBaseHigh is the upper half of pointer to ThreadBase object passed to function
+ */
+
+void threadEntry(const int functionLow, const int functionHigh, const int threadBaseLow, const int threadBaseHigh)
+{
+	const auto function = reinterpret_cast<Function*>(joinPointer(functionLow, functionHigh));
+	const auto threadBase = reinterpret_cast<ThreadBase*>(joinPointer(threadBaseLow, threadBaseHigh));
+
+	setInterruptMasking(false);
+	function(*threadBase);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* initializeStack(void* const buffer, const size_t size, void (& function)(ThreadBase&), ThreadBase& threadBase)
+{
+	// ucontext_t object is placed at the end of the buffer, the rest of the buffer is used as thread's stack
+	const auto end = reinterpret_cast<uintptr_t>(buffer) + size;
+	const auto context = reinterpret_cast<ucontext_t*>((end - sizeof(ucontext_t)) & ~(alignof(ucontext_t) - 1));
+
+	getcontext(context);
+	context->uc_stack.ss_sp = buffer;
+	context->uc_stack.ss_size = reinterpret_cast<uintptr_t>(context) - reinterpret_cast<uintptr_t>(buffer);
+	context->uc_link = nullptr;
+	sigemptyset(&context->uc_sigmask);
+
+	const auto functionPointer = reinterpret_cast<uintptr_t>(&function);
+	const auto threadBasePointer = reinterpret_cast<uintptr_t>(&threadBase);
+	makecontext(context, reinterpret_cast<void(*)()>(threadEntry), 4, static_cast<int>(functionPointer),
+			static_cast<int>(static_cast<uint64_t>(functionPointer) >> 32), static_cast<int>(threadBasePointer),
+			static_cast<int>(static_cast<uint64_t>(threadBasePointer) >> 32));
+
+	return context;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,217 @@
+/**
+ * \file
+ * \brief Emulation of interrupts on Linux host
+ *
+ * Tick interrupt is emulated with a signal generated by POSIX timer, masking of "interrupts" is done with a flag that is
+ * checked in the signal handler, so no system call is needed to enter or leave critical section. Context of each thread
+ * is saved with swapcontext() in an ucontext_t object placed on thread's stack - pointer to this object is used as
+ * thread's stack pointer by the scheduler.
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#include "interrupts.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include "distortos/scheduler/executeDeferredRequests.hpp"
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include <atomic>
+
+#include <cerrno>
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// true if "interrupts" are masked, false otherwise
+volatile bool interruptMasking;
+
+/// true if code is executed from "interrupt", false otherwise
+volatile bool inInterrupt;
+
+/// true if tick "interrupt" is pending, false otherwise
+volatile bool tickPending;
+
+/// true if context switch is pending, false otherwise
+volatile bool contextSwitchPending;
+
+/// function that will be executed in current thread when "interrupt" finishes, nullptr if none
+void (* volatile pendingFunction)();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Prevents reordering of accesses to objects shared with signal handler by the compiler.
+ */
+
+void signalFence()
+{
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+/**
+ * \brief Performs the context switch.
+ *
+ * Context of current thread is saved in local ucontext_t object, address of which is passed to the scheduler as current
+ * thread's stack pointer. errno is saved and restored, so each thread has its own value.
+ *
+ * \attention This function must be called with enabled "interrupt" masking.
+ */
+
+void switchContext()
+{
+	ucontext_t context;
+	const auto newContext = static_cast<ucontext_t*>(scheduler::getScheduler().switchContext(&context));
+	if (newContext == &context)	// no change of current thread?
+		return;
+
+	const auto savedErrno = errno;
+	swapcontext(&context, newContext);
+	errno = savedErrno;
+}
+
+/**
+ * \brief Handles all pending "interrupts" - tick, deferred requests, context switch and function execution.
+ *
+ * \attention This function must be called outside of "interrupt" with disabled "interrupt" masking.
+ */
+
+void handlePendingInterrupts()
+{
+	do
+	{
+		interruptMasking = true;
+		signalFence();
+
+		if (tickPending == true)
+		{
+			tickPending = false;
+			inInterrupt = true;
+			signalFence();
+			if (scheduler::getScheduler().tickInterruptHandler() == true)
+				contextSwitchPending = true;
+			signalFence();
+			inInterrupt = false;
+		}
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+		// deferred requests are executed in "interrupt", just like on ARMv7-M where PendSV executes them
+		if (contextSwitchPending == true)
+		{
+			inInterrupt = true;
+			signalFence();
+			scheduler::executeDeferredRequests();
+			signalFence();
+			inInterrupt = false;
+		}
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+		const auto function = pendingFunction;
+		pendingFunction = nullptr;
+
+		if (contextSwitchPending == true)
+		{
+			contextSwitchPending = false;
+			switchContext();
+		}
+
+		signalFence();
+		interruptMasking = false;
+		signalFence();
+
+		if (function != nullptr)
+			function();
+
+		// signal that arrived while "interrupts" were masked is checked after masking is disabled
+	} while (tickPending == true || contextSwitchPending == true);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool isInInterrupt()
+{
+	return inInterrupt;
+}
+
+void pendContextSwitch()
+{
+	contextSwitchPending = true;
+	signalFence();
+
+	if (interruptMasking == false && inInterrupt == false)
+		handlePendingInterrupts();
+}
+
+void pendFunctionExecution(void (& function)())
+{
+	pendingFunction = &function;
+}
+
+InterruptMask setInterruptMasking(const InterruptMask interruptMask)
+{
+	const InterruptMask previousInterruptMask = interruptMasking;
+	signalFence();
+	interruptMasking = interruptMask;
+	signalFence();
+
+	if (interruptMask == false && inInterrupt == false && (tickPending == true || contextSwitchPending == true))
+		handlePendingInterrupts();
+
+	return previousInterruptMask;
+}
+
+void tickSignalHandler(int)
+{
+	tickPending = true;
+	signalFence();
+
+	if (interruptMasking == true || inInterrupt == true)
+		return;
+
+	// the rest of the handler is equivalent to code of interrupted thread, so the signal is unblocked to allow
+	// preemption of this code (e.g. functions requested with requestFunctionExecution() or threads started or resumed
+	// by context switch done in this handler)
+	sigset_t signalSet;
+	sigemptyset(&signalSet);
+	sigaddset(&signalSet, tickSignal);
+	sigprocmask(SIG_UNBLOCK, &signalSet, nullptr);
+
+	handlePendingInterrupts();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
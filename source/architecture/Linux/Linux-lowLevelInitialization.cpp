@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief lowLevelInitialization() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#include "distortos/architecture/lowLevelInitialization.hpp"
+
+#include "interrupts.hpp"
+
+#include <cstdlib>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void lowLevelInitialization()
+{
+	struct sigaction signalAction {};
+	signalAction.sa_handler = tickSignalHandler;
+	sigemptyset(&signalAction.sa_mask);
+	signalAction.sa_flags = SA_RESTART;
+	if (sigaction(tickSignal, &signalAction, nullptr) != 0)
+		abort();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief requestFunctionExecution() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#include "distortos/architecture/requestFunctionExecution.hpp"
+
+#include "interrupts.hpp"
+
+#include "distortos/scheduler/Scheduler.hpp"
+#include "distortos/scheduler/getScheduler.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void requestFunctionExecution(const scheduler::ThreadControlBlock& threadControlBlock, void (& function)())
+{
+	const auto& currentThreadControlBlock = scheduler::getScheduler().getCurrentThreadControlBlock();
+	if (&threadControlBlock == &currentThreadControlBlock)	// request to current thread?
+	{
+		if (isInInterrupt() == false)	// current thread is sending the request to itself?
+			function();					// execute function right away
+		else							// interrupt is sending the request to current thread?
+			pendFunctionExecution(function);
+	}
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
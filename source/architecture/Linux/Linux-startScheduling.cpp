@@ -0,0 +1,53 @@
+/**
+ * \file
+ * \brief startScheduling() implementation for Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#include "distortos/architecture/startScheduling.hpp"
+
+#include "interrupts.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstdlib>
+
+#include <time.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void startScheduling()
+{
+	// configure POSIX timer as the tick timer
+	sigevent signalEvent {};
+	signalEvent.sigev_notify = SIGEV_SIGNAL;
+	signalEvent.sigev_signo = tickSignal;
+	timer_t timer;
+	if (timer_create(CLOCK_MONOTONIC, &signalEvent, &timer) != 0)
+		abort();
+
+	constexpr long period {1000000000 / CONFIG_TICK_RATE_HZ};
+	static_assert(period > 0, "Invalid CONFIG_TICK_RATE_HZ value!");
+	const itimerspec timerSpecification {{0, period}, {0, period}};
+	if (timer_settime(timer, 0, &timerSpecification, nullptr) != 0)
+		abort();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \brief Declarations of functions used to emulate interrupts on Linux host
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-01
+ */
+
+#ifndef SOURCE_ARCHITECTURE_LINUX_INTERRUPTS_HPP_
+#define SOURCE_ARCHITECTURE_LINUX_INTERRUPTS_HPP_
+
+#include "distortos/architecture/parameters.hpp"
+
+#include <csignal>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// signal generated by POSIX timer, used as tick interrupt
+constexpr int tickSignal {SIGALRM};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return true if current code is executed from "interrupt" (tick signal handler), false otherwise
+ */
+
+bool isInInterrupt();
+
+/**
+ * \brief Requests context switch.
+ *
+ * Context switch is done right away if "interrupts" are not masked and current code is not executed from "interrupt",
+ * otherwise it is done when "interrupt" finishes or when masking is disabled - just like PendSV on ARMv7-M.
+ */
+
+void pendContextSwitch();
+
+/**
+ * \brief Requests execution of function in current thread when "interrupt" finishes.
+ *
+ * If context switch is also pending, the function is executed when current thread is resumed.
+ *
+ * \attention This function must be called from "interrupt".
+ *
+ * \param [in] function is a reference to function that will be executed
+ */
+
+void pendFunctionExecution(void (& function)());
+
+/**
+ * \brief Sets new state of "interrupt" masking.
+ *
+ * If masking is disabled outside of "interrupt", then all pending "interrupts" are handled before returning.
+ *
+ * \param [in] interruptMask is the new state of "interrupt" masking
+ *
+ * \return previous state of "interrupt" masking
+ */
+
+InterruptMask setInterruptMasking(InterruptMask interruptMask);
+
+/**
+ * \brief Handler of \a tickSignal.
+ *
+ * If "interrupts" are masked, then the tick is left pending, otherwise it is handled right away.
+ */
+
+void tickSignalHandler(int);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_LINUX_INTERRUPTS_HPP_
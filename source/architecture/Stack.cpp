@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-01
  */
 
 #include "distortos/architecture/Stack.hpp"
@@ -17,6 +17,7 @@
 #include "distortos/architecture/parameters.hpp"
 
 #include <cstring>
+#include <cstdint>
 
 namespace distortos
 {
@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \brief Implementation of interrupt masking profiler
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-04
+ */
+
+#include "distortos/architecture/interruptMaskingProfiler.hpp"
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include "distortos/architecture/cycleCounter.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// the longest recorded sections
+InterruptMaskingProfile profile;
+
+/// call site of current section, nullptr if no section is started
+const void* currentCallSite;
+
+/// value of cycle counter at the beginning of current section
+uint32_t currentStart;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void finishInterruptMaskingSection()
+{
+	if (currentCallSite == nullptr)
+		return;
+
+	const auto duration = getCycleCount() - currentStart;
+	const auto callSite = currentCallSite;
+	currentCallSite = nullptr;
+
+	// entry with the same call site or the last (shortest) entry
+	auto iterator = std::find_if(profile.begin(), profile.end() - 1,
+			[callSite](const InterruptMaskingSection& section)
+			{
+				return section.callSite == callSite;
+			});
+	if (duration <= iterator->duration)
+		return;
+
+	*iterator = {duration, callSite};
+	// move updated entry towards the beginning, so that the profile remains sorted
+	for (; iterator != profile.begin() && (iterator - 1)->duration < iterator->duration; --iterator)
+		std::swap(*iterator, *(iterator - 1));
+}
+
+InterruptMaskingProfile getInterruptMaskingProfile()
+{
+	return profile;
+}
+
+void resetInterruptMaskingProfile()
+{
+	profile = {};
+}
+
+__attribute__ ((noinline))
+void startInterruptMaskingSection()
+{
+	currentCallSite = __builtin_return_address(0);
+	currentStart = getCycleCount();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-09
  */
 
 #include "distortos/scheduler/MainThread.hpp"
@@ -52,7 +52,7 @@ architecture::Stack stackWrapper(const std::pair<void*, size_t> stackBuffer)
 MainThread::MainThread(const uint8_t priority, ThreadGroupControlBlock& threadGroupControlBlock,
 		SignalsReceiver* const signalsReceiver) :
 		ThreadBase{stackWrapper(architecture::getMainStack()), priority, SchedulingPolicy::RoundRobin,
-				&threadGroupControlBlock, signalsReceiver}
+				&threadGroupControlBlock, signalsReceiver, nullptr}
 {
 
 }
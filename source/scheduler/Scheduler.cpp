@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-15
  */
 
 #include "distortos/scheduler/Scheduler.hpp"
@@ -16,6 +16,8 @@
 #include "distortos/SoftwareTimer.hpp"
 #include "distortos/scheduler/MainThread.hpp"
 
+#include "distortos/memorySections.h"
+
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 #include "distortos/architecture/InterruptUnmaskingLock.hpp"
 #include "distortos/architecture/requestContextSwitch.hpp"
@@ -106,7 +108,7 @@ int Scheduler::block(ThreadControlBlockList& container, const ThreadControlBlock
 }
 
 int Scheduler::blockUntil(ThreadControlBlockList& container, const TickClock::time_point timePoint,
-		const ThreadControlBlock::UnblockFunctor* const unblockFunctor)
+		const ThreadControlBlock::UnblockFunctor* const unblockFunctor, const TickClock::duration slack)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
@@ -119,21 +121,39 @@ int Scheduler::blockUntil(ThreadControlBlockList& container, const TickClock::ti
 				if (iterator->get().getList() != &runnableList_)
 					unblockInternal(iterator, ThreadControlBlock::UnblockReason::Timeout);
 			});
-	softwareTimer.start(timePoint);
+	softwareTimer.start(timePoint, TickClock::duration{}, slack);
 
 	return block(container, unblockFunctor);
 }
 
-uint64_t Scheduler::getContextSwitchCount() const
+int Scheduler::disablePreemption()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
-	return contextSwitchCount_;
+
+	auto& threadControlBlock = getCurrentThreadControlBlock();
+	const auto preemptionDisableCount = threadControlBlock.getPreemptionDisableCount();
+	if (preemptionDisableCount == UINT8_MAX)
+		return EAGAIN;
+
+	threadControlBlock.setPreemptionDisableCount(preemptionDisableCount + 1);
+	return 0;
 }
 
-uint64_t Scheduler::getTickCount() const
+int Scheduler::enablePreemption()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
-	return tickCount_;
+
+	auto& threadControlBlock = getCurrentThreadControlBlock();
+	const auto preemptionDisableCount = threadControlBlock.getPreemptionDisableCount();
+	if (preemptionDisableCount == 0)
+		return EPERM;
+
+	threadControlBlock.setPreemptionDisableCount(preemptionDisableCount - 1);
+	// execute context switch which was deferred while preemption was disabled
+	if (preemptionDisableCount == 1)
+		maybeRequestContextSwitch();
+
+	return 0;
 }
 
 int Scheduler::initialize(MainThread& mainThread)
@@ -192,21 +212,24 @@ int Scheduler::suspend(const ThreadControlBlockListIterator iterator)
 	return block(suspendedList_, iterator);
 }
 
-void* Scheduler::switchContext(void* const stackPointer)
+DISTORTOS_RAMFUNC void* Scheduler::switchContext(void* const stackPointer)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
-	++contextSwitchCount_;
+	contextSwitchCount_.store(contextSwitchCount_.load() + 1);
 	getCurrentThreadControlBlock().getStack().setStackPointer(stackPointer);
-	currentThreadControlBlock_ = runnableList_.begin();
+	// context switch requested before preemption of current thread was disabled may still be pending
+	if (isContextSwitchRequired() == true)
+		currentThreadControlBlock_ = runnableList_.begin();
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
 }
 
-bool Scheduler::tickInterruptHandler()
+DISTORTOS_RAMFUNC bool Scheduler::tickInterruptHandler()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	++tickCount_;
+	const auto tickCount = tickCount_.load() + 1;
+	tickCount_.store(tickCount);
 
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
@@ -221,7 +244,7 @@ bool Scheduler::tickInterruptHandler()
 		runnableList_.sortedSplice(runnableList_, currentThreadControlBlock_);
 	}
 
-	softwareTimerControlBlockSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
+	softwareTimerControlBlockSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount}});
 
 	return isContextSwitchRequired();
 }
@@ -264,8 +287,8 @@ int Scheduler::blockInternal(ThreadControlBlockList& container, const ThreadCont
 	if (iterator->get().getList() != &runnableList_)
 		return EINVAL;
 
-	container.sortedSplice(runnableList_, iterator);
 	iterator->get().blockHook(unblockFunctor);
+	container.sortedSplice(runnableList_, iterator);
 
 	return 0;
 }
@@ -275,6 +298,10 @@ bool Scheduler::isContextSwitchRequired() const
 	if (getCurrentThreadControlBlock().getList() != &runnableList_)
 		return true;
 
+	// switch is deferred until preemption of current thread is enabled
+	if (getCurrentThreadControlBlock().getPreemptionDisableCount() != 0)
+		return false;
+
 	if (runnableList_.begin() != currentThreadControlBlock_)	// is there a higher-priority thread available?
 		return true;
 
@@ -2,13 +2,13 @@
  * \file
  * \brief SoftwareTimerControlBlock class implementation
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-20
+ * \date 2015-06-18
  */
 
 #include "distortos/scheduler/SoftwareTimerControlBlock.hpp"
@@ -28,23 +28,40 @@ namespace scheduler
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-SoftwareTimerControlBlock::SoftwareTimerControlBlock() :
+SoftwareTimerControlBlock::SoftwareTimerControlBlock(const ExecutionContext executionContext) :
 		timePoint_{},
+		period_{},
+		slack_{},
+		overrunCount_{},
 		list_{},
-		iterator_{}
+		iterator_{},
+		executionContext_{executionContext}
 {
 
 }
 
-void SoftwareTimerControlBlock::start(const TickClock::duration duration)
+void SoftwareTimerControlBlock::reload(const TickClock::time_point timePoint)
+{
+	overrunCount_ = (timePoint - timePoint_) / period_;
+	timePoint_ += period_ * (overrunCount_ + 1);
+}
+
+void SoftwareTimerControlBlock::start(const TickClock::duration duration, const TickClock::duration period,
+		const TickClock::duration slack)
 {
 	const auto now = TickClock::now();
-	start(now + duration + decltype(duration){1});
+	start(now + duration + decltype(duration){1}, period, slack);
 }
 
-void SoftwareTimerControlBlock::start(const TickClock::time_point timePoint)
+void SoftwareTimerControlBlock::start(const TickClock::time_point timePoint, const TickClock::duration period,
+		const TickClock::duration slack)
 {
+	stop();
+
 	timePoint_ = timePoint;
+	period_ = period;
+	slack_ = slack;
+	overrunCount_ = {};
 
 	iterator_ = getScheduler().getSoftwareTimerSupervisor().add(*this);
 }
@@ -55,9 +72,16 @@ void SoftwareTimerControlBlock::stop()
 
 	if (list_ != nullptr)
 	{
-		list_->erase(iterator_);
+		getScheduler().getSoftwareTimerSupervisor().remove(*list_, iterator_);
 		list_ = nullptr;
 	}
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	if (executionContext_ == ExecutionContext::ServiceThread)
+		getScheduler().getSoftwareTimerSupervisor().waitForExecution(*this);
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -2,19 +2,29 @@
  * \file
  * \brief SoftwareTimerControlBlockSupervisor class implementation
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-09-18
+ * \date 2015-06-18
  */
 
 #include "distortos/scheduler/SoftwareTimerControlBlockSupervisor.hpp"
 
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace distortos
 {
 
@@ -28,7 +38,17 @@ namespace scheduler
 SoftwareTimerControlBlockSupervisor::SoftwareTimerControlBlockSupervisor() :
 		allocatorPool_{},
 		allocator_{allocatorPool_},
-		activeList_{allocator_}
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+		expiredList_{allocator_},
+		expiredSemaphore_{0, 1},
+		executionWaitList_{getScheduler().getThreadControlBlockListAllocator(),
+				ThreadControlBlock::State::BlockedOnSoftwareTimer},
+		executedSoftwareTimerControlBlock_{},
+		serviceThreadControlBlock_{},
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+		activeList_{allocator_},
+		maxSlack_{},
+		changeCount_{}
 {
 
 }
@@ -40,19 +60,143 @@ SoftwareTimerControlBlockSupervisor::add(SoftwareTimerControlBlock& softwareTime
 
 	allocatorPool_.feed(softwareTimerControlBlock.getLink());
 	softwareTimerControlBlock.setList(&activeList_);
+	maxSlack_ = std::max(maxSlack_, softwareTimerControlBlock.getSlack());
+	++changeCount_;
 	return activeList_.sortedEmplace(softwareTimerControlBlock);
 }
 
+void SoftwareTimerControlBlockSupervisor::remove(SoftwareTimerControlBlockList& list,
+		const SoftwareTimerControlBlockListIterator iterator)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	list.erase(iterator);
+	++changeCount_;
+}
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+void SoftwareTimerControlBlockSupervisor::serviceExpired()
+{
+	expiredSemaphore_.wait();
+
+	while (1)
+	{
+		const SoftwareTimerControlBlock* softwareTimerControlBlock;
+
+		{
+			architecture::InterruptMaskingLock interruptMaskingLock;
+
+			if (expiredList_.empty() == true)
+				return;
+
+			const auto iterator = expiredList_.begin();
+			auto& expiredSoftwareTimerControlBlock = iterator->get();
+			softwareTimerControlBlock = &expiredSoftwareTimerControlBlock;
+
+			if (expiredSoftwareTimerControlBlock.getPeriod() != TickClock::duration{})	// periodic timer?
+			{
+				// expirations which passed while waiting for execution are skipped and counted as overruns
+				expiredSoftwareTimerControlBlock.reload(TickClock::now());
+				activeList_.sortedSplice(expiredList_, iterator);
+				expiredSoftwareTimerControlBlock.setList(&activeList_);
+				maxSlack_ = std::max(maxSlack_, expiredSoftwareTimerControlBlock.getSlack());
+			}
+			else
+			{
+				expiredSoftwareTimerControlBlock.setList(nullptr);
+				expiredList_.erase(iterator);
+			}
+
+			// stop() and destructor of the timer wait until its function returns
+			executedSoftwareTimerControlBlock_ = softwareTimerControlBlock;
+			serviceThreadControlBlock_ = &getScheduler().getCurrentThreadControlBlock();
+		}
+
+		// function is executed with interrupts unmasked, so it may take any time and may block
+		softwareTimerControlBlock->execute();
+
+		{
+			architecture::InterruptMaskingLock interruptMaskingLock;
+
+			executedSoftwareTimerControlBlock_ = {};
+			while (executionWaitList_.empty() == false)
+				getScheduler().unblock(executionWaitList_.begin());
+		}
+	}
+}
+
+void SoftwareTimerControlBlockSupervisor::waitForExecution(const SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	auto& scheduler = getScheduler();
+	while (executedSoftwareTimerControlBlock_ == &softwareTimerControlBlock &&
+			&scheduler.getCurrentThreadControlBlock() != serviceThreadControlBlock_)
+		scheduler.block(executionWaitList_);
+}
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
 void SoftwareTimerControlBlockSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
-	// execute all software timers that reached their time point
-	for (auto iterator = activeList_.begin();
-			iterator != activeList_.end() && iterator->get().getTimePoint() <= timePoint;
-			iterator = activeList_.begin())
+	if (activeList_.empty() == true)
 	{
-		iterator->get().execute();
-		iterator->get().setList(nullptr);
-		activeList_.erase(iterator);
+		maxSlack_ = {};
+		return;
+	}
+
+	// software timers are handled only when the earliest deadline is reached - all other software timers which reached
+	// their expiration time points (but not their deadlines yet) are coalesced and handled at the same time
+	if (activeList_.begin()->get().getDeadline() > timePoint)
+		return;
+
+	// software timer with later deadline cannot be expired, as its slack is not larger than maxSlack_
+	const auto lastDeadline = timePoint + maxSlack_;
+	auto iterator = activeList_.begin();
+	while (iterator != activeList_.end() && iterator->get().getDeadline() <= lastDeadline)
+	{
+		auto& softwareTimerControlBlock = iterator->get();
+		if (softwareTimerControlBlock.getTimePoint() > timePoint)	// not expired yet?
+		{
+			++iterator;
+			continue;
+		}
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+		if (softwareTimerControlBlock.getExecutionContext() ==
+				SoftwareTimerControlBlock::ExecutionContext::ServiceThread)
+		{
+			// hand over to software timer service thread - the timer remains running until its function is executed
+			const auto expiredIterator = iterator++;
+			expiredList_.sortedSplice(activeList_, expiredIterator);
+			softwareTimerControlBlock.setList(&expiredList_);
+			expiredSemaphore_.post();
+			continue;
+		}
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+		// timer is reloaded or removed before execution, so its function may freely restart or stop it
+		const auto nextIterator = std::next(iterator);
+		if (softwareTimerControlBlock.getPeriod() != TickClock::duration{})	// periodic timer?
+		{
+			softwareTimerControlBlock.reload(timePoint);
+			activeList_.sortedSplice(activeList_, iterator);
+		}
+		else
+		{
+			softwareTimerControlBlock.setList(nullptr);
+			activeList_.erase(iterator);
+		}
+
+		const auto changeCount = changeCount_;
+		softwareTimerControlBlock.execute();
+
+		// if function has added or removed some software timer, the search is restarted - handled timers are not
+		// expired anymore
+		iterator = changeCount == changeCount_ ? nextIterator : activeList_.begin();
 	}
 }
 
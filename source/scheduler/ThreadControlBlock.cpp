@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-15
+ * \date 2015-06-18
  */
 
 #include "distortos/scheduler/ThreadControlBlock.hpp"
@@ -38,7 +38,7 @@ namespace scheduler
 
 ThreadControlBlock::ThreadControlBlock(architecture::Stack&& stack, const uint8_t priority,
 		const SchedulingPolicy schedulingPolicy, ThreadGroupControlBlock* const threadGroupControlBlock,
-		SignalsReceiver* const signalsReceiver, ThreadBase& owner) :
+		SignalsReceiver* const signalsReceiver, _reent* const reent, ThreadBase& owner) :
 		stack_{std::move(stack)},
 		owner_(owner),
 		ownedProtocolMutexControlBlocksList_
@@ -56,13 +56,24 @@ ThreadControlBlock::ThreadControlBlock(architecture::Stack&& stack, const uint8_
 		{
 				signalsReceiver != nullptr ? &signalsReceiver->signalsReceiverControlBlock_ : nullptr
 		},
+#if CONFIG_NEWLIB == 1
+		reent_{reent != nullptr ? reent : _global_impure_ptr},
+#endif	// CONFIG_NEWLIB == 1
 		priority_{priority},
 		boostedPriority_{},
+		preemptionDisableCount_{},
+		preemptionThreshold_{},
+		preemptionThresholdActive_{},
 		roundRobinQuantum_{},
 		schedulingPolicy_{schedulingPolicy},
 		state_{State::New}
 {
-	_REENT_INIT_PTR(&reent_);
+#if CONFIG_NEWLIB == 1
+	if (reent != nullptr)
+		_REENT_INIT_PTR(reent);
+#else	// CONFIG_NEWLIB != 1
+	static_cast<void>(reent);	// reentrancy structure is not used without newlib
+#endif	// CONFIG_NEWLIB != 1
 }
 
 ThreadControlBlock::~ThreadControlBlock()
@@ -72,7 +83,10 @@ ThreadControlBlock::~ThreadControlBlock()
 	if (threadGroupList_ != nullptr)
 		threadGroupList_->erase(threadGroupIterator_);
 
-	_reclaim_reent(&reent_);
+#if CONFIG_NEWLIB == 1
+	if (reent_ != _global_impure_ptr)	// shared global _reent structure must not be reclaimed
+		_reclaim_reent(reent_);
+#endif	// CONFIG_NEWLIB == 1
 }
 
 int ThreadControlBlock::addHook()
@@ -91,6 +105,19 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+void ThreadControlBlock::setPreemptionThreshold(const uint8_t preemptionThreshold)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousSchedulingPriority = getSchedulingPriority();
+	preemptionThreshold_ = preemptionThreshold;
+
+	if (previousSchedulingPriority == getSchedulingPriority() || list_ == nullptr)
+		return;
+
+	reposition(getSchedulingPriority() < previousSchedulingPriority);
+}
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -101,16 +128,22 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 	// special case of new priority UINT8_MAX does need to be handled, as it will never be "lowering" of priority anyway
 	const auto loweringBefore = alwaysBehind == false && priority_ > priority;
 
-	const auto previousEffectivePriority = getEffectivePriority();
+	const auto previousSchedulingPriority = getSchedulingPriority();
 	priority_ = priority;
 
-	if (previousEffectivePriority == getEffectivePriority() || list_ == nullptr)
+	if (previousSchedulingPriority == getSchedulingPriority() || list_ == nullptr)
 		return;
 
 	reposition(loweringBefore);
 
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	// with "barging" unlocking the mutex may be unowned while this thread is still blocked on it - in that case the
+	// boosted priority will be recalculated by the thread which locks the mutex
+	if (priorityInheritanceMutexControlBlock_ == nullptr)
+		return;
+
+	const auto owner = priorityInheritanceMutexControlBlock_->getOwner();
+	if (owner != nullptr)
+		owner->updateBoostedPriority();
 }
 
 void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
@@ -143,22 +176,27 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 	if (boostedPriority_ == newBoostedPriority)
 		return;
 
-	const auto oldEffectivePriority = getEffectivePriority();
+	const auto oldSchedulingPriority = getSchedulingPriority();
 	boostedPriority_ = newBoostedPriority;
-	const auto newEffectivePriority = getEffectivePriority();
+	const auto newSchedulingPriority = getSchedulingPriority();
 
-	if (oldEffectivePriority == newEffectivePriority || list_ == nullptr)
+	if (oldSchedulingPriority == newSchedulingPriority || list_ == nullptr)
 		return;
 
-	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
+	const auto loweringBefore = newSchedulingPriority < oldSchedulingPriority;
 
 	reposition(loweringBefore);
 
 	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
 	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
-	// memory usage of threads.
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+	// memory usage of threads. With "barging" unlocking the mutex may be unowned while this thread is still blocked on
+	// it - in that case the boosted priority will be recalculated by the thread which locks the mutex.
+	if (priorityInheritanceMutexControlBlock_ == nullptr)
+		return;
+
+	const auto owner = priorityInheritanceMutexControlBlock_->getOwner();
+	if (owner != nullptr)
+		owner->updateBoostedPriority();
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -167,15 +205,23 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 
 void ThreadControlBlock::reposition(const bool loweringBefore)
 {
-	const auto oldPriority = priority_;
+	const auto oldPreemptionThreshold = preemptionThreshold_;
+	const auto oldPreemptionThresholdActive = preemptionThresholdActive_;
 
+	// temporarily raise scheduling priority, so that the thread is placed before other threads with its priority
 	if (loweringBefore == true)
-		priority_ = getEffectivePriority() + 1;
+	{
+		preemptionThreshold_ = getSchedulingPriority() + 1;
+		preemptionThresholdActive_ = true;
+	}
 
 	list_->sortedSplice(*list_, iterator_);
 
 	if (loweringBefore == true)
-		priority_ = oldPriority;
+	{
+		preemptionThreshold_ = oldPreemptionThreshold;
+		preemptionThresholdActive_ = oldPreemptionThresholdActive;
+	}
 
 	getScheduler().maybeRequestContextSwitch();
 }
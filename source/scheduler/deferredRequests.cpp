@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \brief deferredRequests namespace and executeDeferredRequests() implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#include "distortos/deferredRequests.hpp"
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include "distortos/scheduler/executeDeferredRequests.hpp"
+
+#include "distortos/synchronization/MemcpyPopQueueFunctor.hpp"
+#include "distortos/synchronization/MemcpyPushQueueFunctor.hpp"
+#include "distortos/synchronization/MpscRingBuffer.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThreadBase.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace
+{
+
+static_assert((CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE & (CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE - 1)) == 0,
+		"CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE must be a power of two!");
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single deferred request
+struct DeferredRequest
+{
+	/// pointer to function that will be executed
+	deferredRequests::Function* function;
+
+	/// first argument for \a function
+	void* object;
+
+	/// second argument for \a function
+	uintptr_t argument;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for sequence numbers of slots of \a deferredRequestsRingBuffer
+std::array<synchronization::MpscRingBuffer::Sequence, CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE> sequenceStorage;
+
+/// storage for elements of \a deferredRequestsRingBuffer
+std::array<DeferredRequest, CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE> deferredRequestsStorage;
+
+/// lock-free ring buffer with deferred requests - producers are callers of deferredRequests::call(), the consumer is
+/// executeDeferredRequests()
+synchronization::MpscRingBuffer deferredRequestsRingBuffer {sequenceStorage.data(), deferredRequestsStorage.data(),
+		sizeof(DeferredRequest), CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Generates signal for thread.
+ *
+ * \param [in] object is a pointer to ThreadBase for which the signal will be generated
+ * \param [in] argument is the signal number
+ */
+
+void generateSignalFunction(void* const object, const uintptr_t argument)
+{
+	static_cast<const ThreadBase*>(object)->generateSignal(static_cast<uint8_t>(argument));
+}
+
+/**
+ * \brief Posts semaphore.
+ *
+ * \param [in] object is a pointer to Semaphore that will be posted
+ */
+
+void postFunction(void* const object, uintptr_t)
+{
+	static_cast<Semaphore*>(object)->post();
+}
+
+}	// namespace
+
+namespace deferredRequests
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int call(Function& function, void* const object, const uintptr_t argument)
+{
+	const DeferredRequest deferredRequest {&function, object, argument};
+	const synchronization::MemcpyPushQueueFunctor memcpyPushQueueFunctor {&deferredRequest, sizeof(deferredRequest)};
+	const auto ret = deferredRequestsRingBuffer.push(memcpyPushQueueFunctor);
+	if (ret != 0)
+		return ret;
+
+	architecture::requestContextSwitch();
+	return 0;
+}
+
+int generateSignal(const ThreadBase& thread, const uint8_t signalNumber)
+{
+	return call(generateSignalFunction, const_cast<ThreadBase*>(&thread), signalNumber);
+}
+
+int post(Semaphore& semaphore)
+{
+	return call(postFunction, &semaphore, {});
+}
+
+}	// namespace deferredRequests
+
+namespace scheduler
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void executeDeferredRequests()
+{
+	DeferredRequest deferredRequest;
+	const synchronization::MemcpyPopQueueFunctor memcpyPopQueueFunctor {&deferredRequest, sizeof(deferredRequest)};
+	while (deferredRequestsRingBuffer.pop(memcpyPopQueueFunctor) == 0)
+		(*deferredRequest.function)(deferredRequest.object, deferredRequest.argument);
+}
+
+}	// namespace scheduler
+
+}	// namespace distortos
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
@@ -8,12 +8,13 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-04-28
+ * \date 2015-06-01
  */
 
 #include "distortos/scheduler/lowLevelSchedulerInitialization.hpp"
 
 #include "distortos/syscalls/mallocLockingInitialization.hpp"
+#include "distortos/syscalls/tlsfHeapInitialization.hpp"
 
 #include "distortos/architecture/lowLevelInitialization.hpp"
 #include "distortos/architecture/startScheduling.hpp"
@@ -42,7 +43,12 @@ using FunctionPointer = void(*)();
 const FunctionPointer distortosPreinitArray[] __attribute__ ((section(".preinit_array"), used))
 {
 		lowLevelSchedulerInitialization,
+#if CONFIG_NEWLIB == 1
 		syscalls::mallocLockingInitialization,
+#endif	// CONFIG_NEWLIB == 1
+#if CONFIG_TLSF_HEAP == 1
+		syscalls::tlsfHeapInitialization,
+#endif	// CONFIG_TLSF_HEAP == 1
 		architecture::lowLevelInitialization,
 		architecture::startScheduling,
 };
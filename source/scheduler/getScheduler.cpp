@@ -8,13 +8,15 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-10-30
+ * \date 2015-06-02
  */
 
 #include "distortos/scheduler/getScheduler.hpp"
 
 #include "distortos/scheduler/Scheduler.hpp"
 
+#include "distortos/memorySections.h"
+
 #include <type_traits>
 
 namespace distortos
@@ -31,7 +33,7 @@ namespace
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /// storage for main instance of system's Scheduler
-std::aligned_storage<sizeof(Scheduler), alignof(Scheduler)>::type schedulerInstanceStorage;
+DISTORTOS_CCM_BSS std::aligned_storage<sizeof(Scheduler), alignof(Scheduler)>::type schedulerInstanceStorage;
 
 }	// namespace
 
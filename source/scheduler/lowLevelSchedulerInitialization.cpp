@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #include "distortos/scheduler/lowLevelSchedulerInitialization.hpp"
@@ -19,8 +19,11 @@
 #include "distortos/scheduler/Scheduler.hpp"
 #include "distortos/scheduler/idleThreadFunction.hpp"
 #include "distortos/scheduler/MainThread.hpp"
+#include "distortos/scheduler/softwareTimerServiceThreadFunction.hpp"
 #include "distortos/scheduler/ThreadGroupControlBlock.hpp"
 
+#include "distortos/memorySections.h"
+
 namespace distortos
 {
 
@@ -37,17 +40,30 @@ namespace
 /// size of idle thread's stack, bytes
 constexpr size_t idleThreadStackSize {128};
 
-/// type of idle thread
-using IdleThread = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadFunction));
+/// type of idle thread, shares global newlib's _reent structure with main thread
+using IdleThread = decltype(makeStaticThread<idleThreadStackSize, false, 0, 0, true>(0, idleThreadFunction));
 
 /// storage for idle thread instance
-std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadStorage;
+DISTORTOS_CCM_BSS std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadStorage;
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+/// type of software timer service thread, has thread-specific newlib's _reent structure, as functions of software
+/// timers may freely use newlib
+using SoftwareTimerServiceThread = decltype(makeStaticThread<CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE>(
+		CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_PRIORITY, softwareTimerServiceThreadFunction));
+
+/// storage for software timer service thread instance
+DISTORTOS_CCM_BSS std::aligned_storage<sizeof(SoftwareTimerServiceThread), alignof(SoftwareTimerServiceThread)>::type
+		softwareTimerServiceThreadStorage;
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
 
 /// storage for main thread instance
-std::aligned_storage<sizeof(MainThread), alignof(MainThread)>::type mainThreadStorage;
+DISTORTOS_CCM_BSS std::aligned_storage<sizeof(MainThread), alignof(MainThread)>::type mainThreadStorage;
 
 /// storage for main thread group instance
-std::aligned_storage<sizeof(ThreadGroupControlBlock), alignof(ThreadGroupControlBlock)>::type
+DISTORTOS_CCM_BSS std::aligned_storage<sizeof(ThreadGroupControlBlock), alignof(ThreadGroupControlBlock)>::type
 		mainThreadGroupControlBlockStorage;
 
 #if CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS == 1
@@ -89,6 +105,14 @@ void lowLevelSchedulerInitialization()
 
 	auto& idleThread = *new (&idleThreadStorage) IdleThread {0, idleThreadFunction};
 	idleThread.start();
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	auto& softwareTimerServiceThread = *new (&softwareTimerServiceThreadStorage) SoftwareTimerServiceThread
+			{CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_PRIORITY, softwareTimerServiceThreadFunction};
+	softwareTimerServiceThread.start();
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
 }
 
 }	// namespace scheduler
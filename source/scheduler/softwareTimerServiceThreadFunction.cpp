@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief softwareTimerServiceThreadFunction() definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-10
+ */
+
+#include "distortos/scheduler/softwareTimerServiceThreadFunction.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+namespace distortos
+{
+
+namespace scheduler
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void softwareTimerServiceThreadFunction()
+{
+	auto& softwareTimerSupervisor = getScheduler().getSoftwareTimerSupervisor();
+
+	while (1)
+		softwareTimerSupervisor.serviceExpired();
+}
+
+}	// namespace scheduler
+
+}	// namespace distortos
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-04
+ * \date 2015-06-04
  */
 
 #include "distortos/statistics.hpp"
@@ -16,6 +16,18 @@
 #include "distortos/scheduler/getScheduler.hpp"
 #include "distortos/scheduler/Scheduler.hpp"
 
+#if CONFIG_TLSF_HEAP == 1
+
+#include "distortos/syscalls/getTlsfHeap.hpp"
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#if CONFIG_TLSF_HEAP == 1 || CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#endif	// CONFIG_TLSF_HEAP == 1 || CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 namespace distortos
 {
 
@@ -31,6 +43,32 @@ uint64_t getContextSwitchCount()
 	return scheduler::getScheduler().getContextSwitchCount();
 }
 
+#if CONFIG_TLSF_HEAP == 1
+
+allocators::TlsfHeap::Statistics getHeapStatistics()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return syscalls::getTlsfHeap().getStatistics();
+}
+
+#endif	// CONFIG_TLSF_HEAP == 1
+
+#if CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
+architecture::InterruptMaskingProfile getInterruptMaskingProfile()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return architecture::getInterruptMaskingProfile();
+}
+
+void resetInterruptMaskingProfile()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	architecture::resetInterruptMaskingProfile();
+}
+
+#endif	// CONFIG_INTERRUPT_MASKING_PROFILER == 1
+
 }	// namespace statistics
 
 }	// namespace distortos
@@ -0,0 +1,168 @@
+/**
+ * \file
+ * \brief BasicMutex class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/BasicMutex.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether priority of current thread is higher than priority ceiling of mutex.
+ *
+ * \param [in] controlBlock is a reference to control block of mutex with PriorityProtect protocol
+ *
+ * \return true if priority of current thread is higher than priority ceiling of mutex, false otherwise
+ */
+
+bool isPriorityCeilingViolated(const synchronization::MutexControlBlock& controlBlock)
+{
+	return scheduler::getScheduler().getCurrentThreadControlBlock().getPriority() >
+			controlBlock.getPriorityCeiling();
+}
+
+/**
+ * \brief Overload of isPriorityCeilingViolated() for control block without priority ceiling.
+ *
+ * \return false
+ */
+
+constexpr bool isPriorityCeilingViolated(const synchronization::MutexControlBlockBase&)
+{
+	return false;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::lock()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = tryLockInternal();
+	if (ret != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
+		return ret;
+
+	controlBlock_.block();
+	return 0;
+}
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::tryLock()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	const auto ret = tryLockInternal();
+	return ret != EDEADLK ? ret : EBUSY;
+}
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::tryLockFor(const TickClock::duration duration,
+		const TickClock::duration slack)
+{
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1}, slack);
+}
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::tryLockUntil(const TickClock::time_point timePoint,
+		const TickClock::duration slack)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = tryLockInternal();
+	if (ret != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
+		return ret;
+
+	return controlBlock_.blockUntil(timePoint, slack);
+}
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::unlock()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (MutexType != Type::Normal)
+	{
+		if (controlBlock_.isOwnedByCurrentThread() == false)
+			return EPERM;
+
+		if (this->decrementRecursiveLocksCount() == true)
+			return 0;
+	}
+
+	controlBlock_.unlockOrTransferLock();
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+int BasicMutex<MutexType, MutexProtocol>::tryLockInternal()
+{
+	if (MutexProtocol == Protocol::PriorityProtect && isPriorityCeilingViolated(controlBlock_) == true)
+		return EINVAL;
+
+	if (controlBlock_.getOwner() == nullptr)
+	{
+		controlBlock_.lock();
+		return 0;
+	}
+
+	if (MutexType == Type::Normal)
+		return EBUSY;
+
+	if (controlBlock_.isOwnedByCurrentThread() == true)
+	{
+		if (MutexType == Type::ErrorChecking)
+			return EDEADLK;
+
+		return this->incrementRecursiveLocksCount() == true ? 0 : EAGAIN;
+	}
+
+	return EBUSY;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| explicit instantiations
++---------------------------------------------------------------------------------------------------------------------*/
+
+template class BasicMutex<Mutex::Type::Normal, Mutex::Protocol::None>;
+template class BasicMutex<Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance>;
+template class BasicMutex<Mutex::Type::Normal, Mutex::Protocol::PriorityProtect>;
+template class BasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::None>;
+template class BasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityInheritance>;
+template class BasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityProtect>;
+template class BasicMutex<Mutex::Type::Recursive, Mutex::Protocol::None>;
+template class BasicMutex<Mutex::Type::Recursive, Mutex::Protocol::PriorityInheritance>;
+template class BasicMutex<Mutex::Type::Recursive, Mutex::Protocol::PriorityProtect>;
+
+}	// namespace distortos
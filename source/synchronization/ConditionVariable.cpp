@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-20
+ * \date 2015-06-18
  */
 
 #include "distortos/ConditionVariable.hpp"
@@ -64,12 +64,12 @@ int ConditionVariable::wait(Mutex& mutex)
 	return mutex.lock();
 }
 
-int ConditionVariable::waitFor(Mutex& mutex, TickClock::duration duration)
+int ConditionVariable::waitFor(Mutex& mutex, TickClock::duration duration, const TickClock::duration slack)
 {
-	return waitUntil(mutex, TickClock::now() + duration + TickClock::duration{1});
+	return waitUntil(mutex, TickClock::now() + duration + TickClock::duration{1}, slack);
 }
 
-int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timePoint)
+int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timePoint, const TickClock::duration slack)
 {
 	int blockUntilRet {};
 
@@ -80,7 +80,7 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
-		blockUntilRet = scheduler::getScheduler().blockUntil(blockedList_, timePoint);
+		blockUntilRet = scheduler::getScheduler().blockUntil(blockedList_, timePoint, nullptr, slack);
 	}
 
 	const auto ret = mutex.lock();
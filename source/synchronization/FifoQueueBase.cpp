@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #include "distortos/synchronization/FifoQueueBase.hpp"
@@ -25,23 +25,54 @@ namespace synchronization
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-FifoQueueBase::FifoQueueBase(void* const storageBegin, const void* const storageEnd, const size_t elementSize,
-		const size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+FifoQueueBase::FifoQueueBase(void* const storageBegin, const size_t elementSize, const size_t maxElements) :
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		storageBegin_{storageBegin},
-		storageEnd_{storageEnd},
+		storageEnd_{static_cast<uint8_t*>(storageBegin) + elementSize * maxElements},
 		readPosition_{storageBegin},
 		writePosition_{storageBegin},
-		elementSize_{elementSize}
+		elementSize_{elementSize},
+		droppedCount_{}
 {
 
 }
 
+int FifoQueueBase::pushOverwriting(const QueueFunctor* const dropFunctor, const QueueFunctor& functor)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (pushSemaphore_.tryWait() != 0)	// queue is full?
+	{
+		++droppedCount_;
+
+		// all elements already claimed by unblocked threads? the oldest one cannot be dropped, so drop the new one
+		if (popSemaphore_.tryWait() != 0)
+			return 0;
+
+		if (dropFunctor != nullptr)
+			(*dropFunctor)(readPosition_);
+
+		advance(readPosition_);
+	}
+
+	functor(writePosition_);
+	advance(writePosition_);
+
+	return popSemaphore_.post();
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void FifoQueueBase::advance(void*& storage) const
+{
+	storage = static_cast<uint8_t*>(storage) + elementSize_;
+	if (storage >= storageEnd_)
+		storage = storageBegin_;
+}
+
 int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
 		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
 {
@@ -52,10 +83,7 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 		return ret;
 
 	functor(storage);
-
-	storage = static_cast<uint8_t*>(storage) + elementSize_;
-	if (storage >= storageEnd_)
-		storage = storageBegin_;
+	advance(storage);
 
 	return postSemaphore.post();
 }
@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \brief LatestValueBase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/synchronization/LatestValueBase.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+LatestValueBase::LatestValueBase() :
+		blockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnLatestValue},
+		version_{0}
+{
+
+}
+
+int LatestValueBase::waitForUpdate(const uint32_t version)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (version_.load(std::memory_order_relaxed) != version)	// value already updated?
+		return 0;
+
+	return scheduler::getScheduler().block(blockedList_);
+}
+
+int LatestValueBase::waitForUpdateUntil(const uint32_t version, const TickClock::time_point timePoint,
+		const TickClock::duration slack)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (version_.load(std::memory_order_relaxed) != version)	// value already updated?
+		return 0;
+
+	return scheduler::getScheduler().blockUntil(blockedList_, timePoint, nullptr, slack);
+}
+
+void LatestValueBase::write(const WriteFunctor& functor)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto version = version_.load(std::memory_order_relaxed) + 1;
+	functor(version);
+	version_.store(version, std::memory_order_release);
+
+	while (blockedList_.empty() == false)
+		scheduler::getScheduler().unblock(blockedList_.begin());
+}
+
+}	// namespace synchronization
+
+}	// namespace distortos
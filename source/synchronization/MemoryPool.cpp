@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \brief MemoryPool class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/MemoryPool.hpp"
+
+#include "distortos/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/synchronization/SemaphoreTryWaitForFunctor.hpp"
+#include "distortos/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <limits>
+#include <new>
+
+#include <cerrno>
+#include <cstdlib>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryPool::MemoryPool(void* const storage, const size_t blockSize, const size_t blockCount) :
+		semaphore_{static_cast<Semaphore::Value>(blockCount), static_cast<Semaphore::Value>(blockCount)},
+		freeList_{},
+		storageBegin_{static_cast<uint8_t*>(storage)},
+		blockSize_{blockSize},
+		blockCount_{blockCount},
+		usedBlocks_{},
+		highWaterMark_{}
+{
+	if (blockCount > std::numeric_limits<Semaphore::Value>::max())
+		abort();
+
+	// blocks are linked in reverse order, so that the first allocation returns the first block
+	for (size_t i = blockCount; i > 0; --i)
+	{
+		const auto freeBlock = new (storageBegin_ + (i - 1) * blockSize_) FreeBlock;
+		freeBlock->next = freeList_;
+		freeList_ = freeBlock;
+	}
+}
+
+int MemoryPool::allocate(void*& block)
+{
+	const synchronization::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return allocateInternal(semaphoreWaitFunctor, block);
+}
+
+int MemoryPool::free(void* const block)
+{
+	const auto offset = static_cast<uint8_t*>(block) - storageBegin_;
+	if (offset < 0 || static_cast<size_t>(offset) >= blockSize_ * blockCount_ || offset % blockSize_ != 0)
+		return EINVAL;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (usedBlocks_ == 0)
+		return EINVAL;
+
+	const auto freeBlock = new (block) FreeBlock;
+	freeBlock->next = freeList_;
+	freeList_ = freeBlock;
+	--usedBlocks_;
+
+	// if some thread is waiting, it is unblocked and the semaphore's value is not incremented, so the block which was
+	// just freed is reserved for that thread
+	return semaphore_.post();
+}
+
+int MemoryPool::tryAllocate(void*& block)
+{
+	const synchronization::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return allocateInternal(semaphoreTryWaitFunctor, block);
+}
+
+int MemoryPool::tryAllocateFor(const TickClock::duration duration, void*& block, const TickClock::duration slack)
+{
+	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
+	return allocateInternal(semaphoreTryWaitForFunctor, block);
+}
+
+int MemoryPool::tryAllocateUntil(const TickClock::time_point timePoint, void*& block, const TickClock::duration slack)
+{
+	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
+	return allocateInternal(semaphoreTryWaitUntilFunctor, block);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int MemoryPool::allocateInternal(const synchronization::SemaphoreFunctor& waitSemaphoreFunctor, void*& block)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(semaphore_);
+	if (ret != 0)
+		return ret;
+
+	// successful wait for the semaphore guarantees that the list of free blocks is not empty
+	const auto freeBlock = freeList_;
+	freeList_ = freeBlock->next;
+	block = freeBlock;
+
+	++usedBlocks_;
+	if (usedBlocks_ > highWaterMark_)
+		highWaterMark_ = usedBlocks_;
+
+	return 0;
+}
+
+}	// namespace distortos
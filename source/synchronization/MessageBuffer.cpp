@@ -0,0 +1,380 @@
+/**
+ * \file
+ * \brief MessageBuffer class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/MessageBuffer.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of record's header, bytes - records are aligned to this value
+constexpr size_t headerSize {sizeof(size_t)};
+
+/// flag set in header of padding record, which contains no message and is skipped by receiver
+constexpr size_t paddingFlag {~(SIZE_MAX >> 1)};
+
+/// flag set in header of reserved record, which was not committed yet and stops receiver
+constexpr size_t reservedFlag {paddingFlag >> 1};
+
+/// mask of length in record's header
+constexpr size_t lengthMask {~(paddingFlag | reservedFlag)};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets number of bytes which must be skipped at the beginning of storage to align it to alignof(size_t).
+ *
+ * \param [in] storage is a memory block for contents of the buffer
+ * \param [in] size is the size of \a storage, bytes
+ *
+ * \return number of bytes which must be skipped at the beginning of \a storage, never greater than \a size
+ */
+
+size_t getAlignmentOffset(void* const storage, const size_t size)
+{
+	const auto address = reinterpret_cast<uintptr_t>(storage);
+	return std::min((alignof(size_t) - address % alignof(size_t)) % alignof(size_t), size);
+}
+
+/**
+ * \brief Gets size of record required for message.
+ *
+ * \param [in] messageSize is the size of message, bytes
+ *
+ * \return size of record (including header), bytes
+ */
+
+constexpr size_t getRecordSize(const size_t messageSize)
+{
+	return headerSize + (messageSize + headerSize - 1) / headerSize * headerSize;
+}
+
+/**
+ * \brief Blocks current thread on given list.
+ *
+ * \param [in] blockedList is a reference to list on which current thread will be blocked
+ * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to block without
+ * timeout
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if \a timePoint
+ * is not nullptr
+ *
+ * \return zero if current thread was unblocked, error code otherwise:
+ * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+ */
+
+int block(scheduler::ThreadControlBlockList& blockedList, const TickClock::time_point* const timePoint,
+		const TickClock::duration slack)
+{
+	auto& scheduler = scheduler::getScheduler();
+	return timePoint == nullptr ? scheduler.block(blockedList) :
+			scheduler.blockUntil(blockedList, *timePoint, nullptr, slack);
+}
+
+/**
+ * \brief Unblocks all threads blocked on given list.
+ *
+ * Each unblocked thread checks its own requirement again and blocks again if it is still not satisfied.
+ *
+ * \param [in] blockedList is a reference to list with blocked threads
+ */
+
+void unblockAll(scheduler::ThreadControlBlockList& blockedList)
+{
+	while (blockedList.empty() == false)
+		scheduler::getScheduler().unblock(blockedList.begin());
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MessageBuffer::MessageBuffer(void* const storage, const size_t size) :
+		receiveBlockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnMessageBuffer},
+		sendBlockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnMessageBuffer},
+		storage_{static_cast<uint8_t*>(storage) + getAlignmentOffset(storage, size)},
+		capacity_{(size - getAlignmentOffset(storage, size)) / headerSize * headerSize},
+		readPosition_{},
+		writePosition_{},
+		used_{},
+		sendRequiredSize_{}
+{
+
+}
+
+int MessageBuffer::commit(void* const reservation, const size_t size)
+{
+	if (reservation == nullptr)
+		return EINVAL;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto header = static_cast<size_t*>(reservation) - 1;
+	const auto headerPosition = reinterpret_cast<uint8_t*>(header);
+	if (headerPosition < storage_ || headerPosition >= storage_ + capacity_ || (*header & reservedFlag) == 0)
+		return EINVAL;
+
+	const auto reservedSize = *header & lengthMask;
+	if (size > reservedSize)
+		return EINVAL;
+
+	const auto reservedRecordSize = getRecordSize(reservedSize);
+
+	if (size == 0)	// discard whole reservation?
+		*header = paddingFlag | (reservedRecordSize - headerSize);
+	else
+	{
+		// unused end of reservation is turned into padding record
+		const auto recordSize = getRecordSize(size);
+		if (recordSize != reservedRecordSize)
+			*reinterpret_cast<size_t*>(headerPosition + recordSize) =
+					paddingFlag | (reservedRecordSize - recordSize - headerSize);
+
+		*header = size;
+		unblockAll(receiveBlockedList_);
+	}
+
+	releasePadding();
+	return 0;
+}
+
+std::pair<int, size_t> MessageBuffer::receive(void* const buffer, const size_t size)
+{
+	return receiveInternal(false, nullptr, {}, buffer, size);
+}
+
+std::pair<int, void*> MessageBuffer::reserve(const size_t size)
+{
+	return reserveInternal(false, nullptr, {}, size);
+}
+
+int MessageBuffer::send(const void* const data, const size_t size)
+{
+	return sendInternal(false, nullptr, {}, data, size);
+}
+
+std::pair<int, size_t> MessageBuffer::tryReceive(void* const buffer, const size_t size)
+{
+	return receiveInternal(true, nullptr, {}, buffer, size);
+}
+
+std::pair<int, size_t> MessageBuffer::tryReceiveFor(const TickClock::duration duration, void* const buffer,
+		const size_t size, const TickClock::duration slack)
+{
+	return tryReceiveUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size, slack);
+}
+
+std::pair<int, size_t> MessageBuffer::tryReceiveUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size, const TickClock::duration slack)
+{
+	return receiveInternal(false, &timePoint, slack, buffer, size);
+}
+
+std::pair<int, void*> MessageBuffer::tryReserve(const size_t size)
+{
+	return reserveInternal(true, nullptr, {}, size);
+}
+
+std::pair<int, void*> MessageBuffer::tryReserveFor(const TickClock::duration duration, const size_t size,
+		const TickClock::duration slack)
+{
+	return tryReserveUntil(TickClock::now() + duration + TickClock::duration{1}, size, slack);
+}
+
+std::pair<int, void*> MessageBuffer::tryReserveUntil(const TickClock::time_point timePoint, const size_t size,
+		const TickClock::duration slack)
+{
+	return reserveInternal(false, &timePoint, slack, size);
+}
+
+int MessageBuffer::trySend(const void* const data, const size_t size)
+{
+	return sendInternal(true, nullptr, {}, data, size);
+}
+
+int MessageBuffer::trySendFor(const TickClock::duration duration, const void* const data, const size_t size,
+		const TickClock::duration slack)
+{
+	return trySendUntil(TickClock::now() + duration + TickClock::duration{1}, data, size, slack);
+}
+
+int MessageBuffer::trySendUntil(const TickClock::time_point timePoint, const void* const data, const size_t size,
+		const TickClock::duration slack)
+{
+	return sendInternal(false, &timePoint, slack, data, size);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t* MessageBuffer::allocate(const size_t recordSize)
+{
+	if (writePosition_ > readPosition_ || used_ == 0)
+	{
+		if (capacity_ - writePosition_ < recordSize)	// record doesn't fit at the end of storage?
+		{
+			if (readPosition_ < recordSize)	// record doesn't fit at the beginning of storage either?
+				return nullptr;
+
+			// fill the end of storage with padding record and wrap
+			const auto paddingSize = capacity_ - writePosition_;
+			*reinterpret_cast<size_t*>(storage_ + writePosition_) = paddingFlag | (paddingSize - headerSize);
+			used_ += paddingSize;
+			writePosition_ = {};
+		}
+	}
+	else if (readPosition_ - writePosition_ < recordSize)
+		return nullptr;
+
+	const auto header = reinterpret_cast<size_t*>(storage_ + writePosition_);
+	used_ += recordSize;
+	writePosition_ = (writePosition_ + recordSize) % capacity_;
+	return header;
+}
+
+size_t MessageBuffer::getContiguousFreeSpace() const
+{
+	if (used_ == 0)
+		return capacity_;
+
+	if (writePosition_ > readPosition_)
+		return std::max(capacity_ - writePosition_, readPosition_);
+
+	return readPosition_ - writePosition_;
+}
+
+std::pair<int, size_t> MessageBuffer::receiveInternal(const bool nonBlocking,
+		const TickClock::time_point* const timePoint, const TickClock::duration slack, void* const buffer,
+		const size_t size)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// timed functions are implemented with "until" variants, so the loop doesn't extend the timeout
+	while (used_ == 0 || (*reinterpret_cast<const size_t*>(storage_ + readPosition_) & reservedFlag) != 0)
+	{
+		if (nonBlocking == true)
+			return {EAGAIN, {}};
+
+		const auto ret = block(receiveBlockedList_, timePoint, slack);
+		if (ret != 0)
+			return {ret, {}};
+	}
+
+	const auto header = reinterpret_cast<size_t*>(storage_ + readPosition_);
+	const auto messageSize = *header;
+	if (size < messageSize)
+		return {EMSGSIZE, messageSize};
+
+	memcpy(buffer, header + 1, messageSize);
+
+	// received record is turned into padding record, which is released together with following padding records
+	*header = paddingFlag | (getRecordSize(messageSize) - headerSize);
+	releasePadding();
+	return {{}, messageSize};
+}
+
+void MessageBuffer::releasePadding()
+{
+	while (used_ != 0)
+	{
+		const auto header = *reinterpret_cast<const size_t*>(storage_ + readPosition_);
+		if ((header & paddingFlag) == 0)
+			break;
+
+		const auto recordSize = headerSize + (header & lengthMask);
+		used_ -= recordSize;
+		readPosition_ = (readPosition_ + recordSize) % capacity_;
+	}
+
+	if (used_ == 0)	// buffer is empty - start from the beginning of storage to maximize contiguous free space
+	{
+		readPosition_ = {};
+		writePosition_ = {};
+	}
+
+	if (sendRequiredSize_ != 0 && getContiguousFreeSpace() >= sendRequiredSize_)
+	{
+		sendRequiredSize_ = {};
+		unblockAll(sendBlockedList_);
+	}
+}
+
+std::pair<int, void*> MessageBuffer::reserveInternal(const bool nonBlocking,
+		const TickClock::time_point* const timePoint, const TickClock::duration slack, const size_t size)
+{
+	if (size == 0)
+		return {EINVAL, nullptr};
+
+	if (capacity_ < headerSize || size > capacity_ - headerSize || size > lengthMask)
+		return {EMSGSIZE, nullptr};
+
+	const auto recordSize = getRecordSize(size);
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	size_t* header;
+	// timed functions are implemented with "until" variants, so the loop doesn't extend the timeout
+	while ((header = allocate(recordSize)) == nullptr)
+	{
+		if (nonBlocking == true)
+			return {EAGAIN, nullptr};
+
+		// all blocked senders are woken when the smallest record fits, the others block again
+		sendRequiredSize_ = sendRequiredSize_ == 0 ? recordSize : std::min(sendRequiredSize_, recordSize);
+		const auto ret = block(sendBlockedList_, timePoint, slack);
+		if (sendBlockedList_.empty() == true)
+			sendRequiredSize_ = {};
+		if (ret != 0)
+			return {ret, nullptr};
+	}
+
+	*header = reservedFlag | size;
+	return {{}, header + 1};
+}
+
+int MessageBuffer::sendInternal(const bool nonBlocking, const TickClock::time_point* const timePoint,
+		const TickClock::duration slack, const void* const data, const size_t size)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = reserveInternal(nonBlocking, timePoint, slack, size);
+	if (ret.first != 0)
+		return ret.first;
+
+	memcpy(ret.second, data, size);
+	return commit(ret.second, size);
+}
+
+}	// namespace distortos
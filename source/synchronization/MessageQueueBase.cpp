@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #include "distortos/synchronization/MessageQueueBase.hpp"
@@ -133,6 +133,60 @@ private:
 
 }	// namespace
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MessageQueueBase::EntryList::pop_front()
+{
+	const auto first = list_.begin();
+	const auto priority = first->priority;
+	if (lastEntries_[priority] == first)	// last entry in the bucket?
+		bitmap_[priority / bitsPerWord] &= ~(1u << priority % bitsPerWord);
+	list_.pop_front();
+}
+
+void MessageQueueBase::EntryList::sortedEmplace(const Entry& entry)
+{
+	const auto priority = entry.priority;
+	auto& word = bitmap_[priority / bitsPerWord];
+	const auto bit = 1u << priority % bitsPerWord;
+
+	auto position = list_.before_begin();
+	if ((word & bit) != 0)	// bucket not empty - insert at its end
+		position = lastEntries_[priority];
+	else	// bucket empty - insert after the end of nearest bucket with higher priority (if any)
+	{
+		const auto higherPriority = findNextHigherPriority(priority);
+		if (higherPriority >= 0)
+			position = lastEntries_[higherPriority];
+		word |= bit;
+	}
+
+	lastEntries_[priority] = list_.emplace_after(position, entry);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int MessageQueueBase::EntryList::findNextHigherPriority(const uint8_t priority) const
+{
+	auto index = priority / bitsPerWord;
+	const auto shift = priority % bitsPerWord + 1;
+	// mask bits of lower and equal priorities in the first checked word
+	auto word = shift < bitsPerWord ? bitmap_[index] & ~((1u << shift) - 1) : 0;
+
+	while (word == 0)
+	{
+		if (++index >= bitmap_.size())
+			return -1;
+		word = bitmap_[index];
+	}
+
+	return index * bitsPerWord + __builtin_ctz(word);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -166,8 +220,8 @@ int MessageQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const u
 +---------------------------------------------------------------------------------------------------------------------*/
 
 MessageQueueBase::MessageQueueBase(const size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		pool_{},
 		poolAllocator_{pool_},
 		entryList_{poolAllocator_},
@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief MpscRingBuffer class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "distortos/synchronization/MpscRingBuffer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MpscRingBuffer::MpscRingBuffer(Sequence* const sequenceStorage, void* const storage, const size_t elementSize,
+		const size_t maxElements) :
+		sequences_{sequenceStorage},
+		storage_{static_cast<uint8_t*>(storage)},
+		elementSize_{elementSize},
+		mask_{maxElements - 1},
+		readIndex_{},
+		writeIndex_{0}
+{
+	// slot is free for producer with index "i" when its sequence is equal to "i"
+	for (size_t i = 0; i < maxElements; ++i)
+		sequences_[i].store(i, std::memory_order_relaxed);
+}
+
+int MpscRingBuffer::pop(const QueueFunctor& functor)
+{
+	const auto position = readIndex_ & mask_;
+	// slot is ready for consumer with index "i" when its sequence is equal to "i + 1"
+	if (sequences_[position].load(std::memory_order_acquire) != readIndex_ + 1)
+		return EAGAIN;
+
+	functor(storage_ + position * elementSize_);
+
+	// release the slot for the producer in the next "lap"
+	sequences_[position].store(readIndex_ + mask_ + 1, std::memory_order_release);
+	++readIndex_;
+	return 0;
+}
+
+int MpscRingBuffer::push(const QueueFunctor& functor)
+{
+	auto writeIndex = writeIndex_.load(std::memory_order_relaxed);
+
+	while (1)
+	{
+		const auto sequence = sequences_[writeIndex & mask_].load(std::memory_order_acquire);
+		const auto difference = static_cast<ptrdiff_t>(sequence - writeIndex);
+
+		if (difference < 0)	// slot still occupied from previous "lap" - ring buffer is full
+			return EAGAIN;
+
+		if (difference == 0)	// slot is free - try to reserve it, on failure writeIndex is reloaded
+		{
+			if (writeIndex_.compare_exchange_weak(writeIndex, writeIndex + 1, std::memory_order_relaxed) == true)
+				break;
+		}
+		else	// other producer reserved this slot in the meantime
+			writeIndex = writeIndex_.load(std::memory_order_relaxed);
+	}
+
+	const auto position = writeIndex & mask_;
+	functor(storage_ + position * elementSize_);
+
+	// publish the element to the consumer
+	sequences_[position].store(writeIndex + 1, std::memory_order_release);
+	return 0;
+}
+
+}	// namespace synchronization
+
+}	// namespace distortos
@@ -2,13 +2,13 @@
  * \file
  * \brief Mutex class implementation
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-11-03
+ * \date 2015-06-18
  */
 
 #include "distortos/Mutex.hpp"
@@ -27,10 +27,11 @@ namespace distortos
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-Mutex::Mutex(const Type type, const Protocol protocol, const uint8_t priorityCeiling) :
+Mutex::Mutex(const Type type, const Protocol protocol, const uint8_t priorityCeiling, const UnlockMode unlockMode) :
 		controlBlock_{protocol, priorityCeiling},
 		recursiveLocksCount_{},
-		type_{type}
+		type_{type},
+		unlockMode_{unlockMode}
 {
 
 }
@@ -39,12 +40,18 @@ int Mutex::lock()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryLockInternal();
-	if (ret != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
-		return ret;
+	while (1)
+	{
+		const auto ret = tryLockInternal();
+		if (ret != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
+			return ret;
 
-	controlBlock_.block();
-	return 0;
+		controlBlock_.block();
+
+		// ownership was transferred by unlocking thread? with "barging" thread has to try again
+		if (controlBlock_.isOwnedByCurrentThread() == true)
+			return 0;
+	}
 }
 
 int Mutex::tryLock()
@@ -54,20 +61,27 @@ int Mutex::tryLock()
 	return ret != EDEADLK ? ret : EBUSY;
 }
 
-int Mutex::tryLockFor(const TickClock::duration duration)
+int Mutex::tryLockFor(const TickClock::duration duration, const TickClock::duration slack)
 {
-	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1});
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1}, slack);
 }
 
-int Mutex::tryLockUntil(const TickClock::time_point timePoint)
+int Mutex::tryLockUntil(const TickClock::time_point timePoint, const TickClock::duration slack)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryLockInternal();
-	if (ret != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
-		return ret;
+	while (1)
+	{
+		const auto tryLockInternalRet = tryLockInternal();
+		if (tryLockInternalRet != EBUSY)	// lock successful, recursive lock not possible or deadlock detected?
+			return tryLockInternalRet;
 
-	return controlBlock_.blockUntil(timePoint);
+		const auto ret = controlBlock_.blockUntil(timePoint, slack);
+
+		// timeout or ownership was transferred by unlocking thread? with "barging" thread has to try again
+		if (ret != 0 || controlBlock_.isOwnedByCurrentThread() == true)
+			return ret;
+	}
 }
 
 int Mutex::unlock()
@@ -86,7 +100,10 @@ int Mutex::unlock()
 		}
 	}
 
-	controlBlock_.unlockOrTransferLock();
+	if (unlockMode_ == UnlockMode::Barging)
+		controlBlock_.unlockAndUnblockNext();
+	else
+		controlBlock_.unlockOrTransferLock();
 
 	return 0;
 }
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-02-01
+ * \date 2015-06-18
  */
 
 #include "distortos/synchronization/MutexControlBlock.hpp"
@@ -83,11 +83,9 @@ private:
 +---------------------------------------------------------------------------------------------------------------------*/
 
 MutexControlBlock::MutexControlBlock(const Protocol protocol, const uint8_t priorityCeiling) :
-		blockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
-				scheduler::ThreadControlBlock::State::BlockedOnMutex},
+		MutexControlBlockBase{},
 		list_{},
 		iterator_{},
-		owner_{},
 		protocol_{protocol},
 		priorityCeiling_{priorityCeiling}
 {
@@ -99,17 +97,17 @@ void MutexControlBlock::block()
 	if (protocol_ == Protocol::PriorityInheritance)
 		priorityInheritanceBeforeBlock();
 
-	scheduler::getScheduler().block(blockedList_);
+	MutexControlBlockBase::block();
 }
 
-int MutexControlBlock::blockUntil(const TickClock::time_point timePoint)
+int MutexControlBlock::blockUntil(const TickClock::time_point timePoint, const TickClock::duration slack)
 {
 	if (protocol_ == Protocol::PriorityInheritance)
 		priorityInheritanceBeforeBlock();
 
 	const PriorityInheritanceMutexControlBlockUnblockFunctor unblockFunctor {*this};
 	return scheduler::getScheduler().blockUntil(blockedList_, timePoint,
-			protocol_ == Protocol::PriorityInheritance ? &unblockFunctor : nullptr);
+			protocol_ == Protocol::PriorityInheritance ? &unblockFunctor : nullptr, slack);
 }
 
 uint8_t MutexControlBlock::getBoostedPriority() const
@@ -129,21 +127,41 @@ uint8_t MutexControlBlock::getBoostedPriority() const
 
 void MutexControlBlock::lock()
 {
-	auto& scheduler = scheduler::getScheduler();
-	owner_ = &scheduler.getCurrentThreadControlBlock();
+	MutexControlBlockBase::lock();
 
 	if (protocol_ == Protocol::None)
 		return;
 
-	scheduler.getMutexControlBlockListAllocatorPool().feed(link_);
+	scheduler::getScheduler().getMutexControlBlockListAllocatorPool().feed(link_);
 	list_ = &owner_->getOwnedProtocolMutexControlBlocksList();
 	list_->emplace_front(*this);
 	iterator_ = list_->begin();
 
-	if (protocol_ == Protocol::PriorityProtect)
+	// with "barging" unlocking the mutex may be locked while other threads are still blocked on it
+	if (protocol_ == Protocol::PriorityProtect || blockedList_.empty() == false)
 		owner_->updateBoostedPriority();
 }
 
+void MutexControlBlock::unlockAndUnblockNext()
+{
+	auto& oldOwner = *owner_;
+
+	unlock();
+
+	if (blockedList_.empty() == false)
+	{
+		if (protocol_ == Protocol::PriorityInheritance)
+			blockedList_.begin()->get().setPriorityInheritanceMutexControlBlock(nullptr);
+
+		scheduler::getScheduler().unblock(blockedList_.begin());
+	}
+
+	if (protocol_ == Protocol::None)
+		return;
+
+	oldOwner.updateBoostedPriority();
+}
+
 void MutexControlBlock::unlockOrTransferLock()
 {
 	auto& oldOwner = *owner_;
@@ -180,8 +198,7 @@ void MutexControlBlock::priorityInheritanceBeforeBlock() const
 
 void MutexControlBlock::transferLock()
 {
-	owner_ = &blockedList_.begin()->get();	// pass ownership to the unblocked thread
-	scheduler::getScheduler().unblock(blockedList_.begin());
+	MutexControlBlockBase::transferLock();
 
 	if (list_ == nullptr)
 		return;
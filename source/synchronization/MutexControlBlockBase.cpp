@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief MutexControlBlockBase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/synchronization/MutexControlBlockBase.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MutexControlBlockBase::MutexControlBlockBase() :
+		blockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnMutex},
+		owner_{}
+{
+
+}
+
+void MutexControlBlockBase::block()
+{
+	scheduler::getScheduler().block(blockedList_);
+}
+
+int MutexControlBlockBase::blockUntil(const TickClock::time_point timePoint, const TickClock::duration slack)
+{
+	return scheduler::getScheduler().blockUntil(blockedList_, timePoint, nullptr, slack);
+}
+
+bool MutexControlBlockBase::isOwnedByCurrentThread() const
+{
+	return owner_ == &scheduler::getScheduler().getCurrentThreadControlBlock();
+}
+
+void MutexControlBlockBase::lock()
+{
+	owner_ = &scheduler::getScheduler().getCurrentThreadControlBlock();
+}
+
+void MutexControlBlockBase::unlockOrTransferLock()
+{
+	if (blockedList_.empty() == false)
+		transferLock();
+	else
+		owner_ = nullptr;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| protected functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MutexControlBlockBase::transferLock()
+{
+	owner_ = &blockedList_.begin()->get();	// pass ownership to the unblocked thread
+	scheduler::getScheduler().unblock(blockedList_.begin());
+}
+
+}	// namespace synchronization
+
+}	// namespace distortos
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #include "distortos/RawFifoQueue.hpp"
@@ -31,7 +31,7 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 RawFifoQueue::RawFifoQueue(void* const storage, const size_t elementSize, const size_t maxElements) :
-		fifoQueueBase_{storage, static_cast<uint8_t*>(storage) + elementSize * maxElements, elementSize, maxElements}
+		fifoQueueBase_{storage, elementSize, maxElements}
 {
 
 }
@@ -48,21 +48,32 @@ int RawFifoQueue::push(const void* const data, const size_t size)
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+int RawFifoQueue::pushOverwriting(const void* const data, const size_t size)
+{
+	if (size != fifoQueueBase_.getElementSize())
+		return EMSGSIZE;
+
+	const synchronization::MemcpyPushQueueFunctor memcpyPushQueueFunctor {data, size};
+	return fifoQueueBase_.pushOverwriting(nullptr, memcpyPushQueueFunctor);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const synchronization::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
 	return popInternal(semaphoreTryWaitFunctor, buffer, size);
 }
 
-int RawFifoQueue::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size)
+int RawFifoQueue::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size,
+		const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 	return popInternal(semaphoreTryWaitForFunctor, buffer, size);
 }
 
-int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
+int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size,
+		const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 	return popInternal(semaphoreTryWaitUntilFunctor, buffer, size);
 }
 
@@ -72,15 +83,17 @@ int RawFifoQueue::tryPush(const void* const data, const size_t size)
 	return pushInternal(semaphoreTryWaitFunctor, data, size);
 }
 
-int RawFifoQueue::tryPushFor(const TickClock::duration duration, const void* const data, const size_t size)
+int RawFifoQueue::tryPushFor(const TickClock::duration duration, const void* const data, const size_t size,
+		const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 	return pushInternal(semaphoreTryWaitForFunctor, data, size);
 }
 
-int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size)
+int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size,
+		const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
 }
 
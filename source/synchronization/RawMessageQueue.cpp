@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-19
+ * \date 2015-06-18
  */
 
 #include "distortos/RawMessageQueue.hpp"
@@ -49,16 +49,16 @@ int RawMessageQueue::tryPop(uint8_t& priority, void* const buffer, const size_t
 }
 
 int RawMessageQueue::tryPopFor(const TickClock::duration duration, uint8_t& priority, void* const buffer,
-		const size_t size)
+		const size_t size, const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 	return popInternal(semaphoreTryWaitForFunctor, priority, buffer, size);
 }
 
 int RawMessageQueue::tryPopUntil(const TickClock::time_point timePoint, uint8_t& priority, void* const buffer,
-		const size_t size)
+		const size_t size, const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 	return popInternal(semaphoreTryWaitUntilFunctor, priority, buffer, size);
 }
 
@@ -69,16 +69,16 @@ int RawMessageQueue::tryPush(const uint8_t priority, const void* const data, con
 }
 
 int RawMessageQueue::tryPushFor(const TickClock::duration duration, const uint8_t priority, const void* const data,
-		const size_t size)
+		const size_t size, const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	const synchronization::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration, slack};
 	return pushInternal(semaphoreTryWaitForFunctor, priority, data, size);
 }
 
 int RawMessageQueue::tryPushUntil(const TickClock::time_point timePoint, const uint8_t priority, const void* const data,
-		const size_t size)
+		const size_t size, const TickClock::duration slack)
 {
-	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	const synchronization::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint, slack};
 	return pushInternal(semaphoreTryWaitUntilFunctor, priority, data, size);
 }
 
@@ -8,11 +8,13 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-02-02
+ * \date 2015-06-12
  */
 
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/WaitForAnySet.hpp"
+
 #include "distortos/scheduler/getScheduler.hpp"
 #include "distortos/scheduler/Scheduler.hpp"
 
@@ -30,6 +32,7 @@ namespace distortos
 Semaphore::Semaphore(const Value value, const Value maxValue) :
 		blockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
 				scheduler::ThreadControlBlock::State::BlockedOnSemaphore},
+		observers_{},
 		value_{value <= maxValue ? value : maxValue},
 		maxValue_{maxValue}
 {
@@ -56,6 +59,10 @@ int Semaphore::post()
 
 	++value_;
 
+	// each notification unblocks thread waiting in WaitForAnySet, which removes all observers of that set
+	while (observers_ != nullptr)
+		observers_->waitForAnySet->notify(*observers_);
+
 	return 0;
 }
 
@@ -65,12 +72,12 @@ int Semaphore::tryWait()
 	return tryWaitInternal();
 }
 
-int Semaphore::tryWaitFor(const TickClock::duration duration)
+int Semaphore::tryWaitFor(const TickClock::duration duration, const TickClock::duration slack)
 {
-	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1}, slack);
 }
 
-int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
+int Semaphore::tryWaitUntil(const TickClock::time_point timePoint, const TickClock::duration slack)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
@@ -78,7 +85,7 @@ int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 	if (ret != EAGAIN)	// lock successful?
 		return ret;
 
-	return scheduler::getScheduler().blockUntil(blockedList_, timePoint);
+	return scheduler::getScheduler().blockUntil(blockedList_, timePoint, nullptr, slack);
 }
 
 int Semaphore::wait()
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #include "distortos/synchronization/SemaphoreTryWaitForFunctor.hpp"
@@ -27,7 +27,7 @@ namespace synchronization
 
 int SemaphoreTryWaitForFunctor::operator()(Semaphore& semaphore) const
 {
-	return semaphore.tryWaitFor(duration_);
+	return semaphore.tryWaitFor(duration_, slack_);
 }
 
 }	// namespace synchronization
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-12
+ * \date 2015-06-18
  */
 
 #include "distortos/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
@@ -27,7 +27,7 @@ namespace synchronization
 
 int SemaphoreTryWaitUntilFunctor::operator()(Semaphore& semaphore) const
 {
-	return semaphore.tryWaitUntil(timePoint_);
+	return semaphore.tryWaitUntil(timePoint_, slack_);
 }
 
 }	// namespace synchronization
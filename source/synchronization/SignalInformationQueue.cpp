@@ -8,13 +8,15 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-31
+ * \date 2015-05-30
  */
 
 #include "distortos/synchronization/SignalInformationQueue.hpp"
 
 #include "distortos/SignalSet.hpp"
 
+#include <new>
+
 #include <cerrno>
 
 namespace distortos
@@ -28,69 +30,66 @@ namespace synchronization
 +---------------------------------------------------------------------------------------------------------------------*/
 
 SignalInformationQueue::SignalInformationQueue(Storage* const storage, const size_t maxElements) :
-		pool_{},
-		poolAllocator_{pool_},
-		signalInformationList_{poolAllocator_},
-		freeSignalInformationList_{poolAllocator_}
+		queuedTails_{},
+		freeNodes_{},
+		queuedSignalMask_{}
 {
 	for (size_t i {}; i < maxElements; ++i)
-	{
-		pool_.feed(storage[i]);
-		freeSignalInformationList_.emplace_front(uint8_t{}, SignalInformation::Code{}, sigval{});
-	}
+		freeNodes_ = new (&storage[i]) QueueNode{freeNodes_,
+				SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 }
 
 std::pair<int, SignalInformation> SignalInformationQueue::acceptQueuedSignal(const uint8_t signalNumber)
 {
-	auto it = signalInformationList_.before_begin();
-	auto next = signalInformationList_.begin();
-	const auto last = signalInformationList_.end();
+	if (signalNumber >= signalsCount || queuedTails_[signalNumber] == nullptr)
+		return {EAGAIN, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 
-	while (next != last)
+	auto& tail = queuedTails_[signalNumber];
+	const auto head = tail->next;
+	if (head == tail)	// last queued signal with this number?
 	{
-		if (next->getSignalNumber() == signalNumber)
-		{
-			const auto signalInformation = *next;
-			signalInformationList_.erase_after(it);
-			freeSignalInformationList_.emplace_front(uint8_t{}, SignalInformation::Code{}, sigval{});
-			return {0, signalInformation};
-		}
-
-		it = next;
-		++next;
+		tail = nullptr;
+		queuedSignalMask_ &= ~(uint32_t{1} << signalNumber);
 	}
+	else
+		tail->next = head->next;
 
-	return {EAGAIN, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
+	const auto signalInformation = head->signalInformation;
+	head->next = freeNodes_;
+	freeNodes_ = head;
+	return {0, signalInformation};
 }
 
 SignalSet SignalInformationQueue::getQueuedSignalSet() const
 {
-	SignalSet queuedSignalSet {SignalSet::empty};
-	for (const auto& signalInformation : signalInformationList_)
-		queuedSignalSet.add(signalInformation.getSignalNumber());
-	return queuedSignalSet;
+	return SignalSet{queuedSignalMask_};
 }
 
 int SignalInformationQueue::queueSignal(const uint8_t signalNumber, const sigval value)
 {
-	if (signalNumber >= SignalSet::Bitset{}.size())
+	if (signalNumber >= signalsCount)
 		return EINVAL;
 
-	if (freeSignalInformationList_.empty() == true)
+	if (freeNodes_ == nullptr)
 		return EAGAIN;
 
-	auto it = signalInformationList_.before_begin();
-	auto next = signalInformationList_.begin();
-	const auto last = signalInformationList_.end();
+	const auto node = freeNodes_;
+	freeNodes_ = node->next;
+	node->signalInformation = SignalInformation{signalNumber, SignalInformation::Code::Queued, value};
 
-	while (next != last)	// find the iterator to the last element on the list ("before end")
+	auto& tail = queuedTails_[signalNumber];
+	if (tail == nullptr)	// first queued signal with this number?
+	{
+		node->next = node;
+		queuedSignalMask_ |= uint32_t{1} << signalNumber;
+	}
+	else
 	{
-		it = next;
-		++next;
+		node->next = tail->next;
+		tail->next = node;
 	}
 
-	freeSignalInformationList_.pop_front();
-	signalInformationList_.emplace_after(it, signalNumber, SignalInformation::Code::Queued, value);
+	tail = node;
 	return 0;
 }
 
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-17
+ * \date 2015-06-01
  */
 
 #include "distortos/synchronization/SignalsCatcherControlBlock.hpp"
@@ -59,34 +59,13 @@ std::pair<int, SignalInformation> acceptPendingUnblockedSignal(SignalsReceiverCo
 		return {EAGAIN, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 
 	const auto pendingUnblockedValue = pendingUnblockedBitset.to_ulong();
-	static_assert(sizeof(pendingUnblockedValue) == pendingUnblockedBitset.size() / 8,
-			"Size of pendingUnblockedValue doesn't match size of pendingUnblockedBitset!");
+	static_assert(sizeof(pendingUnblockedValue) >= pendingUnblockedBitset.size() / 8,
+			"Size of pendingUnblockedValue is too small to hold all bits of pendingUnblockedBitset!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(pendingUnblockedValue) - 1;
 	return signalsReceiverControlBlock.acceptPendingSignal(signalNumber);
 }
 
-/**
- * \brief Tries to find SignalsCatcherControlBlock::Association for given signal number in given range.
- *
- * \param [in] begin is a pointer to first element of range of SignalsCatcherControlBlock::Association objects
- * \param [in] end is a pointer to "one past the last" element of range of SignalsCatcherControlBlock::Association
- * objects
- * \param [in] signalNumber is the signal for which the association will be searched
- *
- * \return pointer to found SignalsCatcherControlBlock::Association object, \e end if no match was found
- */
-
-SignalsCatcherControlBlock::Association* findAssociation(SignalsCatcherControlBlock::Association* const begin,
-		SignalsCatcherControlBlock::Association* const end, const uint8_t signalNumber)
-{
-	return std::find_if(begin, end,
-			[signalNumber](const SignalsCatcherControlBlock::Association& association)
-			{
-				return association.first.getBitset()[signalNumber];
-			});
-}
-
 /**
  * \brief Tries to find SignalsCatcherControlBlock::Association for given SignalAction in given range.
  *
@@ -166,7 +145,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::getAssociation(const ui
 	if (signalNumber >= SignalSet::Bitset{}.size())
 		return {EINVAL, {}};
 
-	const auto association = findAssociation(associationsBegin_, associationsEnd_, signalNumber);
+	const auto association = findNumberAssociation(signalNumber);
 	if (association == associationsEnd_)	// there is no association for this signal number?
 		return {{}, {}};
 
@@ -199,17 +178,21 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 		return {{}, previousSignalAction};
 	}
 
-	const auto numberAssociation = findAssociation(associationsBegin_, associationsEnd_, signalNumber);
-	const auto actionAssociation = findAssociation(associationsBegin_, associationsEnd_, signalAction);
+	const auto numberAssociation = findNumberAssociation(signalNumber);
+	auto actionAssociation = findAssociation(associationsBegin_, associationsEnd_, signalAction);
 
 	if (actionAssociation != associationsEnd_)	// there is an association for this SignalAction?
 	{
 		if (numberAssociation == actionAssociation)	// no change?
 			return {{}, signalAction};
 
-		actionAssociation->first.add(signalNumber);
 		const auto previousSignalAction = numberAssociation != associationsEnd_ ?
 				clearAssociation(signalNumber, *numberAssociation) : SignalAction{};
+		// association for SignalAction was the last one and it was moved to the place of removed association?
+		if (actionAssociation == associationsEnd_)
+			actionAssociation = numberAssociation;
+		actionAssociation->first.add(signalNumber);
+		associationIndexes_[signalNumber] = actionAssociation - associationsBegin_ + 1;
 		return {{}, previousSignalAction};
 	}
 
@@ -222,7 +205,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 	// - no Association object was found for signal number or Association object found for signal number has more
 	// than one signal number associated.
 	if (std::distance(storageBegin_, storageEnd_) == 0 && (numberAssociation == associationsEnd_ ||
-			numberAssociation->first.getBitset() == signalSet.getBitset()))
+			numberAssociation->first.getBitset() != signalSet.getBitset()))
 		return {EAGAIN, {}};
 
 	const auto previousSignalAction = numberAssociation != associationsEnd_ ?
@@ -230,6 +213,7 @@ std::pair<int, SignalAction> SignalsCatcherControlBlock::setAssociation(const ui
 	if (storageBegin_ == storageEnd_)
 		abort();	/// \todo replace with assertion
 	new (associationsEnd_) Association{signalSet, signalAction};
+	associationIndexes_[signalNumber] = associationsEnd_ - associationsBegin_ + 1;
 	++associationsEnd_;
 	return {{}, previousSignalAction};
 }
@@ -257,7 +241,7 @@ void SignalsCatcherControlBlock::setSignalMask(const SignalSet signalMask,
 
 SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNumber)
 {
-	const auto association = findAssociation(associationsBegin_, associationsEnd_, signalNumber);
+	const auto association = findNumberAssociation(signalNumber);
 	if (association == associationsEnd_)	// there is no association for this signal number?
 		return {};
 
@@ -269,6 +253,7 @@ SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNu
 	const auto previousSignalAction = association.second;
 
 	association.first.remove(signalNumber);	// signal number is valid (checked by caller)
+	associationIndexes_[signalNumber] = {};
 
 	// can this association be removed (it has no more signal numbers associated)?
 	if (association.first.getBitset().none() == true)
@@ -277,11 +262,20 @@ SignalAction SignalsCatcherControlBlock::clearAssociation(const uint8_t signalNu
 		association = lastAssociation;	// replace removed association with the last association in the range
 		lastAssociation.~Association();
 		--associationsEnd_;
+		if (&association != associationsEnd_)	// last association was moved?
+			updateAssociationIndexes(association);
 	}
 
 	return previousSignalAction;
 }
 
+SignalsCatcherControlBlock::Association* SignalsCatcherControlBlock::findNumberAssociation(const uint8_t signalNumber)
+		const
+{
+	const auto index = associationIndexes_[signalNumber];
+	return index != 0 ? associationsBegin_ + index - 1 : associationsEnd_;
+}
+
 void SignalsCatcherControlBlock::requestDeliveryOfSignals(const scheduler::ThreadControlBlock& threadControlBlock)
 {
 	if (deliveryIsPending_ == true)
@@ -291,6 +285,19 @@ void SignalsCatcherControlBlock::requestDeliveryOfSignals(const scheduler::Threa
 	architecture::requestFunctionExecution(threadControlBlock, deliverSignals);
 }
 
+void SignalsCatcherControlBlock::updateAssociationIndexes(const Association& association)
+{
+	const uint8_t index = &association - associationsBegin_ + 1;
+	auto bitset = association.first.getBitset().to_ulong();
+	while (bitset != 0)
+	{
+		// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+		const auto signalNumber = __builtin_ffsl(bitset) - 1;
+		associationIndexes_[signalNumber] = index;
+		bitset &= bitset - 1;
+	}
+}
+
 }	// namespace synchronization
 
 }	// namespace distortos
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief SpscRingBuffer class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "distortos/synchronization/SpscRingBuffer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace synchronization
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SpscRingBuffer::SpscRingBuffer(void* const storage, const size_t elementSize, const size_t maxElements) :
+		storage_{static_cast<uint8_t*>(storage)},
+		elementSize_{elementSize},
+		mask_{maxElements - 1},
+		readIndex_{0},
+		writeIndex_{0}
+{
+
+}
+
+int SpscRingBuffer::pop(const QueueFunctor& functor)
+{
+	const auto readIndex = readIndex_.load(std::memory_order_relaxed);
+	if (readIndex == writeIndex_.load(std::memory_order_acquire))	// ring buffer empty?
+		return EAGAIN;
+
+	functor(storage_ + (readIndex & mask_) * elementSize_);
+
+	readIndex_.store(readIndex + 1, std::memory_order_release);
+	return 0;
+}
+
+int SpscRingBuffer::push(const QueueFunctor& functor)
+{
+	const auto writeIndex = writeIndex_.load(std::memory_order_relaxed);
+	if (writeIndex - readIndex_.load(std::memory_order_acquire) > mask_)	// ring buffer full?
+		return EAGAIN;
+
+	functor(storage_ + (writeIndex & mask_) * elementSize_);
+
+	writeIndex_.store(writeIndex + 1, std::memory_order_release);
+	return 0;
+}
+
+}	// namespace synchronization
+
+}	// namespace distortos
@@ -0,0 +1,235 @@
+/**
+ * \file
+ * \brief StreamBuffer class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/StreamBuffer.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Blocks current thread until its requirement may be satisfied.
+ *
+ * \a requiredSize is merged into \a smallestRequiredSize before blocking. When the last thread leaves \a blockedList
+ * (e.g. after timeout), \a smallestRequiredSize is cleared. If some other thread is still blocked, value left by
+ * thread which timed-out may be smaller than needed - this causes only a spurious wakeup, after which the value is
+ * recalculated.
+ *
+ * \param [in] blockedList is a reference to list on which current thread will be blocked
+ * \param [in,out] smallestRequiredSize is a reference to smallest requirement of threads blocked on \a blockedList, 0
+ * if no thread is blocked
+ * \param [in] requiredSize is the requirement of current thread
+ * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode (true)
+ * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode is
+ * selected, nullptr to block without timeout
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if \a timePoint
+ * is not nullptr
+ *
+ * \return zero if current thread was unblocked because its requirement may be satisfied, error code otherwise:
+ * - EAGAIN - non-blocking mode was selected;
+ * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+ */
+
+int wait(scheduler::ThreadControlBlockList& blockedList, size_t& smallestRequiredSize, const size_t requiredSize,
+		const bool nonBlocking, const TickClock::time_point* const timePoint, const TickClock::duration slack)
+{
+	if (nonBlocking == true)
+		return EAGAIN;
+
+	smallestRequiredSize = smallestRequiredSize == 0 ? requiredSize : std::min(smallestRequiredSize, requiredSize);
+	auto& scheduler = scheduler::getScheduler();
+	const auto ret = timePoint == nullptr ? scheduler.block(blockedList) :
+			scheduler.blockUntil(blockedList, *timePoint, nullptr, slack);
+	if (blockedList.empty() == true)
+		smallestRequiredSize = {};
+	return ret;
+}
+
+/**
+ * \brief Unblocks all threads blocked on given list if the smallest requirement of these threads is satisfied.
+ *
+ * Each unblocked thread checks its own requirement again and blocks again if it is still not satisfied.
+ *
+ * \param [in] blockedList is a reference to list with blocked threads
+ * \param [in,out] smallestRequiredSize is a reference to smallest requirement of threads blocked on \a blockedList, 0
+ * if no thread is blocked, cleared if threads are unblocked
+ * \param [in] availableSize is the size available for blocked threads
+ */
+
+void notify(scheduler::ThreadControlBlockList& blockedList, size_t& smallestRequiredSize, const size_t availableSize)
+{
+	if (smallestRequiredSize == 0 || availableSize < smallestRequiredSize)
+		return;
+
+	smallestRequiredSize = {};
+	while (blockedList.empty() == false)
+		scheduler::getScheduler().unblock(blockedList.begin());
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+StreamBuffer::StreamBuffer(void* const storage, const size_t size, const size_t triggerLevel) :
+		receiveBlockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnStreamBuffer},
+		sendBlockedList_{scheduler::getScheduler().getThreadControlBlockListAllocator(),
+				scheduler::ThreadControlBlock::State::BlockedOnStreamBuffer},
+		storage_{static_cast<uint8_t*>(storage)},
+		capacity_{size},
+		triggerLevel_{std::max(std::min(triggerLevel, size), size_t{1})},
+		readPosition_{},
+		used_{},
+		receiveRequiredSize_{},
+		sendRequiredSize_{}
+{
+
+}
+
+std::pair<int, size_t> StreamBuffer::receive(void* const buffer, const size_t size)
+{
+	return receiveInternal(false, nullptr, {}, buffer, size);
+}
+
+int StreamBuffer::send(const void* const data, const size_t size)
+{
+	return sendInternal(false, nullptr, {}, data, size);
+}
+
+std::pair<int, size_t> StreamBuffer::tryReceive(void* const buffer, const size_t size)
+{
+	return receiveInternal(true, nullptr, {}, buffer, size);
+}
+
+std::pair<int, size_t> StreamBuffer::tryReceiveFor(const TickClock::duration duration, void* const buffer,
+		const size_t size, const TickClock::duration slack)
+{
+	return tryReceiveUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size, slack);
+}
+
+std::pair<int, size_t> StreamBuffer::tryReceiveUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size, const TickClock::duration slack)
+{
+	return receiveInternal(false, &timePoint, slack, buffer, size);
+}
+
+int StreamBuffer::trySend(const void* const data, const size_t size)
+{
+	return sendInternal(true, nullptr, {}, data, size);
+}
+
+int StreamBuffer::trySendFor(const TickClock::duration duration, const void* const data, const size_t size,
+		const TickClock::duration slack)
+{
+	return trySendUntil(TickClock::now() + duration + TickClock::duration{1}, data, size, slack);
+}
+
+int StreamBuffer::trySendUntil(const TickClock::time_point timePoint, const void* const data, const size_t size,
+		const TickClock::duration slack)
+{
+	return sendInternal(false, &timePoint, slack, data, size);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> StreamBuffer::receiveInternal(const bool nonBlocking,
+		const TickClock::time_point* const timePoint, const TickClock::duration slack, void* const buffer,
+		const size_t size)
+{
+	if (size == 0)
+		return {EINVAL, {}};
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// timed functions are implemented with "until" variants, so the loop doesn't extend the timeout
+	const auto requiredSize = std::min(triggerLevel_, size);
+	while (used_ < requiredSize)
+	{
+		const auto ret = wait(receiveBlockedList_, receiveRequiredSize_, requiredSize, nonBlocking, timePoint,
+				slack);
+		if (ret != 0)
+		{
+			if (used_ == 0 || (ret != EAGAIN && ret != ETIMEDOUT))
+				return {ret, {}};
+
+			break;	// receive what is available
+		}
+	}
+
+	const auto receivedSize = std::min(used_, size);
+	const auto firstChunkSize = std::min(receivedSize, capacity_ - readPosition_);
+	const auto uint8Buffer = static_cast<uint8_t*>(buffer);
+	memcpy(uint8Buffer, storage_ + readPosition_, firstChunkSize);
+	memcpy(uint8Buffer + firstChunkSize, storage_, receivedSize - firstChunkSize);
+
+	used_ -= receivedSize;
+	readPosition_ = used_ != 0 ? (readPosition_ + receivedSize) % capacity_ : 0;
+
+	notify(sendBlockedList_, sendRequiredSize_, capacity_ - used_);
+
+	return {{}, receivedSize};
+}
+
+int StreamBuffer::sendInternal(const bool nonBlocking, const TickClock::time_point* const timePoint,
+		const TickClock::duration slack, const void* const data, const size_t size)
+{
+	if (size > capacity_)
+		return EMSGSIZE;
+
+	if (size == 0)
+		return 0;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// timed functions are implemented with "until" variants, so the loop doesn't extend the timeout
+	while (capacity_ - used_ < size)
+	{
+		const auto ret = wait(sendBlockedList_, sendRequiredSize_, size, nonBlocking, timePoint, slack);
+		if (ret != 0)
+			return ret;
+	}
+
+	const auto writePosition = (readPosition_ + used_) % capacity_;
+	const auto firstChunkSize = std::min(size, capacity_ - writePosition);
+	const auto uint8Data = static_cast<const uint8_t*>(data);
+	memcpy(storage_ + writePosition, uint8Data, firstChunkSize);
+	memcpy(storage_, uint8Data + firstChunkSize, size - firstChunkSize);
+
+	used_ += size;
+
+	notify(receiveBlockedList_, receiveRequiredSize_, used_);
+
+	return 0;
+}
+
+}	// namespace distortos
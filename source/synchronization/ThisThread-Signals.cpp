@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-17
+ * \date 2015-06-18
  */
 
 #include "distortos/ThisThread-Signals.hpp"
@@ -77,6 +77,8 @@ public:
  * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode (true)
  * \param [in] timePoint is a pointer to time point at which the wait for signals will be terminated, used only if
  * blocking mode is selected, nullptr to block without timeout
+ * \param [in] slack is the max duration by which termination of the wait may be delayed, used only if \a timePoint is
+ * not nullptr
  *
  * \return pair with return code (0 on success, error code otherwise) and SignalInformation object for accepted signal;
  * error codes:
@@ -85,7 +87,7 @@ public:
  */
 
 std::pair<int, SignalInformation> waitImplementation(const SignalSet& signalSet, const bool nonBlocking,
-		const TickClock::time_point* const timePoint)
+		const TickClock::time_point* const timePoint, const TickClock::duration slack)
 {
 	auto& scheduler = scheduler::getScheduler();
 	const auto signalsReceiverControlBlock = scheduler.getCurrentThreadControlBlock().getSignalsReceiverControlBlock();
@@ -110,7 +112,7 @@ std::pair<int, SignalInformation> waitImplementation(const SignalSet& signalSet,
 		signalsReceiverControlBlock->setWaitingSignalSet(&signalSet);
 		const SignalsWaitUnblockFunctor signalsWaitUnblockFunctor;
 		const auto ret = timePoint == nullptr ? scheduler.block(waitingList, &signalsWaitUnblockFunctor) :
-				scheduler.blockUntil(waitingList, *timePoint, &signalsWaitUnblockFunctor);
+				scheduler.blockUntil(waitingList, *timePoint, &signalsWaitUnblockFunctor, slack);
 		if (ret != 0)
 			return {ret, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 
@@ -120,8 +122,8 @@ std::pair<int, SignalInformation> waitImplementation(const SignalSet& signalSet,
 	}
 
 	const auto intersectionValue = intersection.to_ulong();
-	static_assert(sizeof(intersectionValue) == intersection.size() / 8,
-			"Size of intersectionValue doesn't match size of intersection!");
+	static_assert(sizeof(intersectionValue) >= intersection.size() / 8,
+			"Size of intersectionValue is too small to hold all bits of intersection!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(intersectionValue) - 1;
 	return signalsReceiverControlBlock->acceptPendingSignal(signalNumber);
@@ -192,22 +194,24 @@ int setSignalMask(const SignalSet signalMask)
 
 std::pair<int, SignalInformation> tryWait(const SignalSet& signalSet)
 {
-	return waitImplementation(signalSet, true, nullptr);	// non-blocking mode
+	return waitImplementation(signalSet, true, nullptr, {});	// non-blocking mode
 }
 
-std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet, const TickClock::duration duration)
+std::pair<int, SignalInformation> tryWaitFor(const SignalSet& signalSet, const TickClock::duration duration,
+		const TickClock::duration slack)
 {
-	return tryWaitUntil(signalSet, TickClock::now() + duration + TickClock::duration{1});
+	return tryWaitUntil(signalSet, TickClock::now() + duration + TickClock::duration{1}, slack);
 }
 
-std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet, const TickClock::time_point timePoint)
+std::pair<int, SignalInformation> tryWaitUntil(const SignalSet& signalSet, const TickClock::time_point timePoint,
+		const TickClock::duration slack)
 {
-	return waitImplementation(signalSet, false, &timePoint);	// blocking mode, with timeout
+	return waitImplementation(signalSet, false, &timePoint, slack);	// blocking mode, with timeout
 }
 
 std::pair<int, SignalInformation> wait(const SignalSet& signalSet)
 {
-	return waitImplementation(signalSet, false, nullptr);	// blocking mode, no timeout
+	return waitImplementation(signalSet, false, nullptr, {});	// blocking mode, no timeout
 }
 
 }	// namespace Signals
@@ -0,0 +1,164 @@
+/**
+ * \file
+ * \brief WaitForAnySet class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "distortos/WaitForAnySet.hpp"
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/scheduler/getScheduler.hpp"
+#include "distortos/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// UnblockFunctor is a functor executed when unblocking a thread that is waiting using WaitForAnySet
+class WaitForAnySet::UnblockFunctor : public scheduler::ThreadControlBlock::UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief UnblockFunctor's constructor
+	 *
+	 * \param [in] waitForAnySet is a reference to WaitForAnySet used by unblocked thread
+	 */
+
+	constexpr explicit UnblockFunctor(WaitForAnySet& waitForAnySet) :
+			waitForAnySet_(waitForAnySet)
+	{
+
+	}
+
+	/**
+	 * \brief UnblockFunctor's function call operator
+	 *
+	 * Removes all observers of the set from their semaphores - this is done regardless of the reason of unblocking, so
+	 * no semaphore is left with dangling observer after timeout.
+	 */
+
+	void operator()(scheduler::ThreadControlBlock&) const override
+	{
+		waitForAnySet_.detach();
+	}
+
+private:
+
+	/// reference to WaitForAnySet used by unblocked thread
+	WaitForAnySet& waitForAnySet_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int WaitForAnySet::tryWait(size_t& index)
+{
+	return waitImplementation(true, nullptr, {}, index);	// non-blocking mode
+}
+
+int WaitForAnySet::tryWaitFor(const TickClock::duration duration, size_t& index, const TickClock::duration slack)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1}, index, slack);
+}
+
+int WaitForAnySet::tryWaitUntil(const TickClock::time_point timePoint, size_t& index, const TickClock::duration slack)
+{
+	return waitImplementation(false, &timePoint, slack, index);
+}
+
+int WaitForAnySet::wait(size_t& index)
+{
+	return waitImplementation(false, nullptr, {}, index);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void WaitForAnySet::detach()
+{
+	for (size_t i = 0; i < count_; ++i)
+	{
+		auto& observer = observers_[i];
+		if (observer.next != nullptr)
+			observer.next->previous = observer.previous;
+		if (observer.previous != nullptr)
+			observer.previous->next = observer.next;
+		else
+			observer.semaphore.observers_ = observer.next;
+		observer.next = {};
+		observer.previous = {};
+		observer.waitForAnySet = {};
+	}
+
+	waitingList_ = {};
+}
+
+void WaitForAnySet::notify(const synchronization::SemaphoreObserver& observer)
+{
+	readyIndex_ = &observer - observers_;
+	scheduler::getScheduler().unblock(waitingList_->begin());
+}
+
+int WaitForAnySet::waitImplementation(const bool nonBlocking, const TickClock::time_point* const timePoint,
+		const TickClock::duration slack, size_t& index)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (waitingList_ != nullptr)
+		return EBUSY;
+
+	for (size_t i = 0; i < count_; ++i)
+		if (observers_[i].semaphore.getValue() != 0)
+		{
+			index = i;
+			return 0;
+		}
+
+	if (nonBlocking == true)
+		return EAGAIN;
+
+	auto& scheduler = scheduler::getScheduler();
+	scheduler::ThreadControlBlockList waitingList {scheduler.getThreadControlBlockListAllocator(),
+			scheduler::ThreadControlBlock::State::WaitingForAny};
+	waitingList_ = &waitingList;
+
+	for (size_t i = 0; i < count_; ++i)
+	{
+		auto& observer = observers_[i];
+		observer.next = observer.semaphore.observers_;
+		observer.previous = {};
+		observer.waitForAnySet = this;
+		if (observer.next != nullptr)
+			observer.next->previous = &observer;
+		observer.semaphore.observers_ = &observer;
+	}
+
+	const UnblockFunctor unblockFunctor {*this};
+	const auto ret = timePoint == nullptr ? scheduler.block(waitingList, &unblockFunctor) :
+			scheduler.blockUntil(waitingList, *timePoint, &unblockFunctor, slack);
+	if (ret != 0)
+		return ret;
+
+	index = readyIndex_;
+	return 0;
+}
+
+}	// namespace distortos
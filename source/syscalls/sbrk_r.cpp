@@ -8,9 +8,11 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-09-18
+ * \date 2015-05-28
  */
 
+#include "distortos/distortosConfiguration.h"
+
 #include <cerrno>
 #include <cstdint>
 
@@ -27,11 +29,24 @@ extern "C"
  * This version of _sbrk_r() requires the heap area to be defined explicitly in linker script with symbols __heap_start
  * and __heap_end.
  *
+ * If CONFIG_TLSF_HEAP == 1, whole heap area is owned by TLSF heap used by malloc() and related functions, so this
+ * function always fails.
+ *
  * \param [in] size is the requested data space size
  *
  * \return pointer to new data space
  */
 
+#if CONFIG_TLSF_HEAP == 1
+
+void* _sbrk_r(_reent*, intptr_t)
+{
+	errno = ENOMEM;
+	return reinterpret_cast<void*>(-1);
+}
+
+#else	// CONFIG_TLSF_HEAP != 1
+
 void* _sbrk_r(_reent*, const intptr_t size)
 {
 	extern char __heap_start[];						// imported from linker script
@@ -50,4 +65,6 @@ void* _sbrk_r(_reent*, const intptr_t size)
 	return previousHeapEnd;
 }
 
+#endif	// CONFIG_TLSF_HEAP != 1
+
 }	// extern "C"
@@ -0,0 +1,339 @@
+/**
+ * \file
+ * \brief Implementation of malloc() and related functions with TLSF heap
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-28
+ */
+
+#include "distortos/syscalls/tlsfHeapInitialization.hpp"
+
+#if CONFIG_TLSF_HEAP == 1
+
+#include "distortos/syscalls/getTlsfHeap.hpp"
+
+#include "distortos/allocators/TlsfHeap.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <new>
+
+#include <cerrno>
+#include <cstring>
+
+extern "C" char __heap_start[];	// imported from linker script
+extern "C" char __heap_end[];	// imported from linker script
+
+namespace distortos
+{
+
+namespace syscalls
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for TLSF heap used by malloc() and related functions
+std::aligned_storage<sizeof(allocators::TlsfHeap), alignof(allocators::TlsfHeap)>::type tlsfHeapStorage;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates block from TLSF heap.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] blockAlignment is the requested alignment of block, must be a power of two
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to allocated block, nullptr if allocation failed (ENOMEM is set in \a reent in that case)
+ */
+
+void* allocate(_reent* const reent, const size_t blockAlignment, const size_t size)
+{
+	void* storage;
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+		storage = getTlsfHeap().allocateAligned(blockAlignment, size);
+	}
+
+	if (storage == nullptr)
+		reent->_errno = ENOMEM;
+
+	return storage;
+}
+
+/**
+ * \brief Deallocates block from TLSF heap.
+ *
+ * \param [in] storage is a pointer to block that will be deallocated, nullptr is ignored
+ */
+
+void deallocate(void* const storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	getTlsfHeap().deallocate(storage);
+}
+
+/**
+ * \brief Changes size of block allocated from TLSF heap.
+ *
+ * Block is resized in place if possible, otherwise new block is allocated, contents are copied (with interrupts
+ * enabled) and old block is deallocated.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] storage is a pointer to block that will be resized, nullptr is equivalent to allocate()
+ * \param [in] size is the requested size of block, bytes, 0 is equivalent to deallocate()
+ *
+ * \return pointer to resized block, nullptr if allocation failed (ENOMEM is set in \a reent and original block is
+ * unchanged in that case)
+ */
+
+void* reallocate(_reent* const reent, void* const storage, const size_t size)
+{
+	if (storage == nullptr)
+		return allocate(reent, allocators::TlsfHeap::alignment, size);
+
+	if (size == 0)
+	{
+		deallocate(storage);
+		return nullptr;
+	}
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+		if (getTlsfHeap().resize(storage, size) == true)
+			return storage;
+	}
+
+	const auto newStorage = allocate(reent, allocators::TlsfHeap::alignment, size);
+	if (newStorage == nullptr)
+		return nullptr;
+
+	const auto oldSize = allocators::TlsfHeap::getBlockSize(storage);
+	memcpy(newStorage, storage, oldSize < size ? oldSize : size);
+	deallocate(storage);
+	return newStorage;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+allocators::TlsfHeap& getTlsfHeap()
+{
+	return *reinterpret_cast<allocators::TlsfHeap*>(&tlsfHeapStorage);
+}
+
+void tlsfHeapInitialization()
+{
+	new (&tlsfHeapStorage) allocators::TlsfHeap {__heap_start, static_cast<size_t>(__heap_end - __heap_start)};
+}
+
+}	// namespace syscalls
+
+}	// namespace distortos
+
+using namespace distortos;
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Reentrant version of calloc().
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] elements is the number of elements
+ * \param [in] elementSize is the size of single element, bytes
+ *
+ * \return pointer to allocated and zero-initialized block, nullptr if allocation failed
+ */
+
+void* _calloc_r(_reent* const reent, const size_t elements, const size_t elementSize)
+{
+	const auto size = elements * elementSize;
+	if (elementSize != 0 && size / elementSize != elements)	// overflow?
+	{
+		reent->_errno = ENOMEM;
+		return nullptr;
+	}
+
+	const auto storage = syscalls::allocate(reent, allocators::TlsfHeap::alignment, size);
+	if (storage != nullptr)
+		memset(storage, 0, size);
+	return storage;
+}
+
+/**
+ * \brief Reentrant version of free().
+ *
+ * \param [in] storage is a pointer to block that will be freed, nullptr is ignored
+ */
+
+void _free_r(_reent*, void* const storage)
+{
+	syscalls::deallocate(storage);
+}
+
+/**
+ * \brief Reentrant version of malloc().
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to allocated block, nullptr if allocation failed
+ */
+
+void* _malloc_r(_reent* const reent, const size_t size)
+{
+	return syscalls::allocate(reent, allocators::TlsfHeap::alignment, size);
+}
+
+/**
+ * \brief Reentrant version of malloc_usable_size().
+ *
+ * \param [in] storage is a pointer to allocated block
+ *
+ * \return usable size of allocated block, bytes, 0 if \a storage is nullptr
+ */
+
+size_t _malloc_usable_size_r(_reent*, void* const storage)
+{
+	return storage != nullptr ? allocators::TlsfHeap::getBlockSize(storage) : 0;
+}
+
+/**
+ * \brief Reentrant version of memalign().
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] blockAlignment is the requested alignment of block, must be a power of two
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to allocated block, nullptr if allocation failed
+ */
+
+void* _memalign_r(_reent* const reent, const size_t blockAlignment, const size_t size)
+{
+	if (blockAlignment == 0 || (blockAlignment & (blockAlignment - 1)) != 0)
+	{
+		reent->_errno = EINVAL;
+		return nullptr;
+	}
+
+	return syscalls::allocate(reent, blockAlignment, size);
+}
+
+/**
+ * \brief Reentrant version of realloc().
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] storage is a pointer to block that will be resized
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to resized block, nullptr if allocation failed
+ */
+
+void* _realloc_r(_reent* const reent, void* const storage, const size_t size)
+{
+	return syscalls::reallocate(reent, storage, size);
+}
+
+/**
+ * \brief Allocates zero-initialized array.
+ *
+ * \param [in] elements is the number of elements
+ * \param [in] elementSize is the size of single element, bytes
+ *
+ * \return pointer to allocated and zero-initialized block, nullptr if allocation failed
+ */
+
+void* calloc(const size_t elements, const size_t elementSize)
+{
+	return _calloc_r(_impure_ptr, elements, elementSize);
+}
+
+/**
+ * \brief Frees block of memory.
+ *
+ * \param [in] storage is a pointer to block that will be freed, nullptr is ignored
+ */
+
+void free(void* const storage)
+{
+	_free_r(_impure_ptr, storage);
+}
+
+/**
+ * \brief Allocates block of memory.
+ *
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to allocated block, nullptr if allocation failed
+ */
+
+void* malloc(const size_t size)
+{
+	return _malloc_r(_impure_ptr, size);
+}
+
+/**
+ * \brief Gets usable size of allocated block.
+ *
+ * \param [in] storage is a pointer to allocated block
+ *
+ * \return usable size of allocated block, bytes, 0 if \a storage is nullptr
+ */
+
+size_t malloc_usable_size(void* const storage)
+{
+	return _malloc_usable_size_r(_impure_ptr, storage);
+}
+
+/**
+ * \brief Allocates aligned block of memory.
+ *
+ * \param [in] blockAlignment is the requested alignment of block, must be a power of two
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to allocated block, nullptr if allocation failed
+ */
+
+void* memalign(const size_t blockAlignment, const size_t size)
+{
+	return _memalign_r(_impure_ptr, blockAlignment, size);
+}
+
+/**
+ * \brief Changes size of block of memory.
+ *
+ * \param [in] storage is a pointer to block that will be resized
+ * \param [in] size is the requested size of block, bytes
+ *
+ * \return pointer to resized block, nullptr if allocation failed
+ */
+
+void* realloc(void* const storage, const size_t size)
+{
+	return _realloc_r(_impure_ptr, storage, size);
+}
+
+}	// extern "C"
+
+#endif	// CONFIG_TLSF_HEAP == 1
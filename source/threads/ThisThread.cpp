@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-03-03
+ * \date 2015-06-14
  */
 
 #include "distortos/ThisThread.hpp"
@@ -26,6 +26,16 @@ namespace ThisThread
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+int disablePreemption()
+{
+	return scheduler::getScheduler().disablePreemption();
+}
+
+int enablePreemption()
+{
+	return scheduler::getScheduler().enablePreemption();
+}
+
 ThreadBase& get()
 {
 	return scheduler::getScheduler().getCurrentThreadControlBlock().getOwner();
@@ -46,17 +56,17 @@ void setPriority(const uint8_t priority, const bool alwaysBehind)
 	scheduler::getScheduler().getCurrentThreadControlBlock().setPriority(priority, alwaysBehind);
 }
 
-void sleepFor(const TickClock::duration duration)
+void sleepFor(const TickClock::duration duration, const TickClock::duration slack)
 {
-	sleepUntil(TickClock::now() + duration + TickClock::duration{1});
+	sleepUntil(TickClock::now() + duration + TickClock::duration{1}, slack);
 }
 
-void sleepUntil(const TickClock::time_point timePoint)
+void sleepUntil(const TickClock::time_point timePoint, const TickClock::duration slack)
 {
 	auto& scheduler = scheduler::getScheduler();
 	scheduler::ThreadControlBlockList sleepingList {scheduler.getThreadControlBlockListAllocator(),
 			scheduler::ThreadControlBlock::State::Sleeping};
-	scheduler.blockUntil(sleepingList, timePoint);
+	scheduler.blockUntil(sleepingList, timePoint, nullptr, slack);
 }
 
 void yield()
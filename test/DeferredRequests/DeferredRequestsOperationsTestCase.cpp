@@ -0,0 +1,167 @@
+/**
+ * \file
+ * \brief DeferredRequestsOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#include "DeferredRequestsOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/deferredRequests.hpp"
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/SignalAction.hpp"
+#include "distortos/SignalInformation.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThisThread-Signals.hpp"
+
+#include <cerrno>
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// long duration used in tests
+constexpr auto longDuration = TickClock::duration{10};
+
+/// signal number used in tests
+constexpr uint8_t testSignalNumber {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of signal received by signalHandler()
+volatile uint8_t handledSignalNumber;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Signal handler which saves the number of received signal.
+ *
+ * \param [in] signalInformation is a reference to received SignalInformation object
+ */
+
+void signalHandler(const SignalInformation& signalInformation)
+{
+	handledSignalNumber = signalInformation.getSignalNumber();
+}
+
+/**
+ * \brief Tests requests queued from thread - they must be executed right away.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testFromThread()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint32_t, 1> fifoQueue;
+	constexpr uint32_t magicValue {0x2e5b1f07};
+
+	if (deferredRequests::post(semaphore) != 0 || semaphore.getValue() != 1)
+		return false;
+
+	uint32_t value {};
+	if (deferredRequests::tryPush(fifoQueue, magicValue) != 0 || fifoQueue.tryPop(value) != 0 || value != magicValue)
+		return false;
+
+	if (ThisThread::Signals::setSignalAction(testSignalNumber, {signalHandler, SignalSet{SignalSet::empty}}).first != 0)
+		return false;
+
+	handledSignalNumber = {};
+	const auto ret = deferredRequests::generateSignal(ThisThread::get(), testSignalNumber);
+	ThisThread::Signals::setSignalAction(testSignalNumber, {});
+	return ret == 0 && handledSignalNumber == testSignalNumber;
+}
+
+/**
+ * \brief Tests requests queued from interrupt context.
+ *
+ * Software timer queues a push to FifoQueue and as many semaphore posts as possible. Main thread
+ * waits for the element in FifoQueue - it must be received in the same moment. All queued requests must be executed
+ * and the first request that didn't fit in the queue must fail with EAGAIN.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testFromInterrupt()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint32_t, 1> fifoQueue;
+	constexpr uint32_t magicValue {0x719c4d3a};
+	size_t posts {};
+	int overflowRet {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&semaphore, &fifoQueue, &posts, &overflowRet]()
+			{
+				if (deferredRequests::tryPush(fifoQueue, magicValue) != 0)
+					return;
+
+				while ((overflowRet = deferredRequests::post(semaphore)) == 0)
+					++posts;
+			});
+
+	waitForNextTick();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+
+	uint32_t value {};
+	const auto ret = fifoQueue.tryPopUntil(wakeUpTimePoint + longDuration, value);
+	if (ret != 0 || wakeUpTimePoint != TickClock::now() || value != magicValue)
+		return false;
+
+	return posts == CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE - 1 && overflowRet == EAGAIN && semaphore.getValue() == posts;
+}
+
+}	// namespace
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool DeferredRequestsOperationsTestCase::run_() const
+{
+#if CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE != 0
+
+	return testFromThread() == true && testFromInterrupt() == true;
+
+#else	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE == 0
+
+	return true;
+
+#endif	// CONFIG_DEFERRED_REQUESTS_QUEUE_SIZE == 0
+}
+
+}	// namespace test
+
+}	// namespace distortos
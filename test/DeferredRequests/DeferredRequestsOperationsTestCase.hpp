@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief DeferredRequestsOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#ifndef TEST_DEFERREDREQUESTS_DEFERREDREQUESTSOPERATIONSTESTCASE_HPP_
+#define TEST_DEFERREDREQUESTS_DEFERREDREQUESTSOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests functions from deferredRequests namespace.
+ *
+ * Requests queued from thread must be executed right away. Requests queued from interrupt context (software timer) must
+ * be executed after the interrupt, in the same moment, in the order in which they were queued. Queueing more requests
+ * than the queue can hold must fail with EAGAIN.
+ */
+
+class DeferredRequestsOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_DEFERREDREQUESTS_DEFERREDREQUESTSOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief deferredRequestsTestCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-07
+ */
+
+#include "deferredRequestsTestCases.hpp"
+
+#include "DeferredRequestsOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// DeferredRequestsOperationsTestCase instance
+const DeferredRequestsOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to deferred requests
+const TestCaseGroup::Range::value_type deferredRequestsTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup deferredRequestsTestCases {TestCaseGroup::Range{deferredRequestsTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-09
+ * \date 2015-06-18
  */
 
 #include "FifoQueueOperationsTestCase.hpp"
@@ -63,7 +63,7 @@ constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSw
 /// (main -> idle), 2 - main thread wakes up (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase1TryForUntilContextSwitchCount {2};
 
-/// expected number of context switches in phase3 and phase4 block involving software timer (excluding
+/// expected number of context switches in phase3, phase4 and phase5 block involving software timer (excluding
 /// waitForNextTick()): 1 - main thread blocks on FIFO queue (main -> idle), 2 - main thread is unblocked by interrupt
 /// (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase34SoftwareTimerContextSwitchCount {2};
@@ -909,6 +909,114 @@ bool phase4()
 	return true;
 }
 
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests whether pushOverwriting() pushes elements to non-full FIFO queue and drops (destructs) the oldest elements when
+ * the FIFO queue is full, without blocking. Then tests interrupt -> thread scenario in which main (current) thread
+ * waits for data in FIFO queue with one slot and software timer calls pushOverwriting() twice from interrupt context -
+ * the first element is claimed by unblocked main thread, so the second one must be dropped.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	{
+		TestStaticFifoQueue<2> fifoQueue;
+		const TestType::Value secondValue = 0x6b09e2d7;
+		const TestType::Value thirdValue = 0x95ce3f1b;
+		const TestType::Value fourthValue = 0xc4a3587e;
+		const TestType firstTestValue {0x2d4c79a1};
+		const TestType thirdTestValue {thirdValue};
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		{
+			// FIFO queue is not full, so pushOverwriting(const T&) must push the element without dropping anything
+			TestType::resetCounters();
+			const auto ret = fifoQueue.pushOverwriting(firstTestValue);	// 1 copy construction
+			if (ret != 0 || fifoQueue.getDroppedCount() != 0 || TestType::checkCounters(0, 1, 0, 0, 0, 0, 0) != true)
+				return false;
+		}
+
+		{
+			// FIFO queue is not full, so pushOverwriting(T&&) must push the element without dropping anything
+			TestType::resetCounters();
+			// 1 construction, 1 move construction, 1 destruction
+			const auto ret = fifoQueue.pushOverwriting(TestType{secondValue});
+			if (ret != 0 || fifoQueue.getDroppedCount() != 0 || TestType::checkCounters(1, 0, 1, 1, 0, 0, 0) != true)
+				return false;
+		}
+
+		{
+			// FIFO queue is full, so pushOverwriting(const T&) must drop the oldest element
+			TestType::resetCounters();
+			const auto ret = fifoQueue.pushOverwriting(thirdTestValue);	// 1 destruction, 1 copy construction
+			if (ret != 0 || fifoQueue.getDroppedCount() != 1 || TestType::checkCounters(0, 1, 0, 1, 0, 0, 0) != true)
+				return false;
+		}
+
+		{
+			// FIFO queue is full, so pushOverwriting(T&&) must drop the oldest element
+			TestType::resetCounters();
+			// 1 construction, 1 destruction, 1 move construction, 1 destruction
+			const auto ret = fifoQueue.pushOverwriting(TestType{fourthValue});
+			if (ret != 0 || fifoQueue.getDroppedCount() != 2 || TestType::checkCounters(1, 0, 1, 2, 0, 0, 0) != true)
+				return false;
+		}
+
+		// FIFO queue must contain the two newest elements
+		for (const auto expectedValue : {thirdValue, fourthValue})
+		{
+			TestType testValue {};
+			const auto ret = fifoQueue.tryPop(testValue);
+			if (ret != 0 || testValue != TestType{expectedValue})
+				return false;
+		}
+
+		{
+			TestType testValue {};
+			const auto ret = fifoQueue.tryPop(testValue);
+			if (ret != EAGAIN || statistics::getContextSwitchCount() != contextSwitchCount)
+				return false;
+		}
+	}
+
+	{
+		TestStaticFifoQueue<1> fifoQueue;
+		const TestType firstTestValue {0x0f81b6c5};
+		const TestType secondTestValue {0x7e35d902};
+		auto softwareTimer = makeSoftwareTimer(
+				[&fifoQueue, &firstTestValue, &secondTestValue]()
+				{
+					fifoQueue.pushOverwriting(firstTestValue);
+					fifoQueue.pushOverwriting(secondTestValue);
+				});
+
+		TestType::resetCounters();
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);	// in timer: 1 copy construction
+
+		// FIFO queue is currently empty, but pop() should succeed at expected time, second element must be dropped
+		TestType testValue {};	// 1 construction
+		const auto ret = fifoQueue.pop(testValue);	// 1 swap, 1 destruction
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || testValue != firstTestValue ||
+				fifoQueue.getDroppedCount() != 1 || TestType::checkCounters(1, 1, 0, 1, 0, 0, 1) != true ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase34SoftwareTimerContextSwitchCount)
+			return false;
+
+		const auto tryPopRet = fifoQueue.tryPop(testValue);
+		if (tryPopRet != EAGAIN)
+			return false;
+	}
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -929,12 +1037,14 @@ bool FifoQueueOperationsTestCase::run_() const
 	constexpr auto phase4ExpectedContextSwitchCount = emplace == true ?
 			10 * waitForNextTickContextSwitchCount + 9 * phase34SoftwareTimerContextSwitchCount :
 			7 * waitForNextTickContextSwitchCount + 6 * phase34SoftwareTimerContextSwitchCount;
+	constexpr auto phase5ExpectedContextSwitchCount = waitForNextTickContextSwitchCount +
+			phase34SoftwareTimerContextSwitchCount;
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
-			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount;
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3, phase4})
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
 	{
 		const auto ret = function();
 		if (ret != true)
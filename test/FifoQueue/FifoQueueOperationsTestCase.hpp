@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #ifndef TEST_FIFOQUEUE_FIFOQUEUEOPERATIONSTESTCASE_HPP_
@@ -26,10 +26,11 @@ namespace test
  * \brief Tests various FifoQueue operations.
  *
  * Tests emplacing (emplace(), tryEmplace(), tryEmplaceFor() and tryEmplaceUntil()), pushing (push(), tryPush(),
- * tryPushFor() and tryPushUntil()) and popping (pop(), tryPop(), tryPopFor() and tryPopUntil()) to/from FifoQueue, both
- * from thread and from interrupt context - these operations must return expected result, cause expected number of
- * context switches, finish within expected time frame and execute expected actions on transferred object (various
- * constructor types, destructor, swap, ...).
+ * tryPushFor(), tryPushUntil() and pushOverwriting()) and popping (pop(), tryPop(), tryPopFor() and tryPopUntil())
+ * to/from FifoQueue, both from thread and from interrupt context - these operations must return expected result, cause
+ * expected number of context switches, finish within expected time frame and execute expected actions on transferred
+ * object (various constructor types, destructor, swap, ...). Tests also whether pushOverwriting() drops expected
+ * elements and whether they are counted by getDroppedCount().
  */
 
 class FifoQueueOperationsTestCase : public TestCaseCommon
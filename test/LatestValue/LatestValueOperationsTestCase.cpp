@@ -0,0 +1,218 @@
+/**
+ * \file
+ * \brief LatestValueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-17
+ */
+
+#include "LatestValueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/LatestValue.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// value used in tests - large enough to make torn reads possible
+using TestValue = std::array<uint32_t, 16>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks waiting for update (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Makes TestValue with all elements equal to given number.
+ *
+ * \param [in] number is the number which will be written to all elements
+ *
+ * \return TestValue with all elements equal to \a number
+ */
+
+TestValue makeTestValue(const uint32_t number)
+{
+	TestValue value;
+	value.fill(number);
+	return value;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether get() and set() properly read and write the value and its version and whether tryWaitForUpdateFor()
+ * times out when the value is not updated and returns immediately when it was.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	LatestValue<TestValue> latestValue {makeTestValue(1)};
+
+	uint32_t version {UINT32_MAX};
+	if (latestValue.get(version) != makeTestValue(1) || version != 0 || latestValue.getVersion() != 0)
+		return false;
+
+	latestValue.set(makeTestValue(2));
+	latestValue.set(makeTestValue(3));
+
+	if (latestValue.get() != makeTestValue(3) || latestValue.getVersion() != 2)
+		return false;
+
+	{
+		waitForNextTick();
+
+		// value was updated since version 0 was read, so tryWaitForUpdateFor() must return immediately
+		TestValue value {};
+		const auto start = TickClock::now();
+		const auto ret = latestValue.tryWaitForUpdateFor(singleDuration, version, value);
+		if (ret != 0 || TickClock::now() != start || version != 2 || value != makeTestValue(3))
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		// value is not updated, so tryWaitForUpdateFor() should time-out at expected time
+		TestValue value {};
+		const auto start = TickClock::now();
+		const auto ret = latestValue.tryWaitForUpdateFor(singleDuration, version, value);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} || version != 2 ||
+				value != TestValue{})
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt -> thread communication scenario. Main (current) thread waits for update of the value. Software timer
+ * sets the value from interrupt context - main thread is expected to be woken at that time and to get the new value.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	LatestValue<TestValue> latestValue;
+	auto softwareTimer = makeSoftwareTimer(
+			[&latestValue]()
+			{
+				latestValue.set(makeTestValue(4));
+			});
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+
+	// value is not updated, but waitForUpdate() should succeed at expected time
+	uint32_t version {};
+	TestValue value {};
+	const auto ret = latestValue.waitForUpdate(version, value);
+	const auto wokenUpTimePoint = TickClock::now();
+	return ret == 0 && version == 1 && value == makeTestValue(4) && wakeUpTimePoint == wokenUpTimePoint &&
+			statistics::getContextSwitchCount() - contextSwitchCount == softwareTimerContextSwitchCount;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Periodic software timer sets the value from interrupt context in each tick - all elements of the value are equal to
+ * the number of update. Main (current) thread reads the value in a loop. Each read must give consistent snapshot - all
+ * elements must be equal to the version of the value.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	LatestValue<TestValue> latestValue;
+	uint32_t updates {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&latestValue, &updates]()
+			{
+				latestValue.set(makeTestValue(++updates));
+			});
+
+	waitForNextTick();
+
+	const auto end = TickClock::now() + longDuration;
+	softwareTimer.start(singleDuration, singleDuration);
+
+	bool consistent {true};
+	while (TickClock::now() < end)
+	{
+		uint32_t version;
+		const auto value = latestValue.get(version);
+		if (value != makeTestValue(version))
+			consistent = false;
+	}
+
+	softwareTimer.stop();
+
+	return consistent == true && updates >= static_cast<uint32_t>(longDuration.count()) - 1 &&
+			latestValue.getVersion() == updates;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool LatestValueOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
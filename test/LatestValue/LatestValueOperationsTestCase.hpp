@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief LatestValueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-17
+ */
+
+#ifndef TEST_LATESTVALUE_LATESTVALUEOPERATIONSTESTCASE_HPP_
+#define TEST_LATESTVALUE_LATESTVALUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various LatestValue operations.
+ *
+ * Tests reading and writing of the value and its version, timed wait for update which times out and which returns
+ * immediately. Tests interrupt -> thread scenario - thread blocked in waitForUpdate() must be woken by update done from
+ * interrupt. Tests also that the reader always gets consistent snapshot of the value while it is frequently updated
+ * from interrupt.
+ */
+
+class LatestValueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_LATESTVALUE_LATESTVALUEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,426 @@
+/**
+ * \file
+ * \brief LockFreeFifoQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "LockFreeFifoQueueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticRawMpscFifoQueue.hpp"
+#include "distortos/StaticRawSpscFifoQueue.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements in tested lock-free FIFO queues
+using TestType = unsigned int;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// number of wrap-arounds of ring buffer tested in phase2
+constexpr size_t phase2Laps {5};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase1 block involving tryPopFor() or tryPopUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks on lock-free FIFO queue (main -> idle), 2 - main thread wakes up
+/// (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase1TryPopForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on lock-free FIFO queue (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {2};
+
+/// expected number of context switches in all phases for single type of queue
+constexpr decltype(statistics::getContextSwitchCount()) expectedQueueContextSwitchCount
+{
+		3 * waitForNextTickContextSwitchCount + 2 * phase1TryPopForUntilContextSwitchCount +	// phase1
+		2 * waitForNextTickContextSwitchCount +	// phase2
+		6 * waitForNextTickContextSwitchCount + 3 * phase3SoftwareTimerContextSwitchCount +	// phase3
+		5 * waitForNextTickContextSwitchCount	// phase4
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests tryPop() when lock-free FIFO queue is empty - it must fail immediately and return EAGAIN
+ *
+ * \param Queue is the type of tested lock-free FIFO queue
+ *
+ * \param [in] queue is a reference to lock-free FIFO queue that will be tested
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testTryPopWhenEmpty(Queue& queue)
+{
+	// lock-free FIFO queue is empty, so tryPop(T&) should fail immediately
+	waitForNextTick();
+	const auto start = TickClock::now();
+	TestType testValue {};
+	const auto ret = queue.tryPop(testValue);
+	return ret == EAGAIN && TickClock::now() == start;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all tryPop*() functions properly return some error when dealing with empty lock-free FIFO queue.
+ *
+ * \param Queue is the template of tested lock-free FIFO queue with static storage
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue>
+bool phase1()
+{
+	Queue<TestType, 1> queue;
+	TestType testValue {};
+
+	{
+		const auto ret = testTryPopWhenEmpty(queue);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// lock-free FIFO queue is empty, so tryPopFor(..., T&) should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopFor(singleDuration, testValue);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryPopForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// lock-free FIFO queue is empty, so tryPopUntil(..., T&) should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = queue.tryPopUntil(requestedTimePoint, testValue);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryPopForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryPush() and all *pop*() functions properly send data via non-full or non-empty lock-free FIFO queue,
+ * preserving FIFO order, also when ring buffer wraps around multiple times.
+ *
+ * \param Queue is the template of tested lock-free FIFO queue with static storage
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue>
+bool phase2()
+{
+	Queue<TestType, 2> queue;
+
+	{
+		// lock-free FIFO queue is not full, so first two tryPush(const T&) calls must succeed immediately, third one
+		// must fail; then elements must be popped immediately in the same order
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (queue.tryPush(TestType{0x2d4ad3a1}) != 0 || queue.tryPush(TestType{0x7cfbf6a5}) != 0 ||
+				queue.tryPush(TestType{0x0c2d6bf3}) != EAGAIN)
+			return false;
+
+		TestType testValue {};
+		if (queue.tryPop(testValue) != 0 || testValue != TestType{0x2d4ad3a1})
+			return false;
+		if (queue.tryPopFor(singleDuration, testValue) != 0 || testValue != TestType{0x7cfbf6a5})
+			return false;
+		if (queue.tryPop(testValue) != EAGAIN || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// ring buffer must preserve order of elements during wrap-arounds
+		waitForNextTick();
+		const auto start = TickClock::now();
+		for (size_t i = 0; i < phase2Laps * 2; ++i)
+		{
+			const TestType first {static_cast<TestType>(0x6d0bc31e + i)};
+			const TestType second {static_cast<TestType>(0x1f5d30a9 + i)};
+			if (queue.tryPush(first) != 0 || queue.tryPush(second) != 0)
+				return false;
+
+			TestType testValue {};
+			if (queue.pop(testValue) != 0 || testValue != first)
+				return false;
+			if (queue.tryPopUntil(start + singleDuration, testValue) != 0 || testValue != second)
+				return false;
+		}
+
+		if (start != TickClock::now())
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests interrupt -> thread communication scenario. Main (current) thread waits for data to become available in
+ * lock-free FIFO queue. Software timer pushes some values to the same lock-free FIFO queue at specified time point from
+ * interrupt context, main thread is expected to receive these values (with pop(), tryPopFor() and tryPopUntil()) in the
+ * same moment.
+ *
+ * \param Queue is the template of tested lock-free FIFO queue with static storage
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue>
+bool phase3()
+{
+	Queue<TestType, 1> queue;
+	TestType sharedMagicValue {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&queue, &sharedMagicValue]()
+			{
+				queue.tryPush(sharedMagicValue);
+			});
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		sharedMagicValue = TestType{0x4a36f5d1};
+		softwareTimer.start(wakeUpTimePoint);
+
+		// lock-free FIFO queue is currently empty, but pop() should succeed at expected time
+		TestType testValue {};
+		const auto ret = queue.pop(testValue);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || testValue != sharedMagicValue ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryPopWhenEmpty(queue);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		sharedMagicValue = TestType{0x9c0a2e47};
+		softwareTimer.start(wakeUpTimePoint);
+
+		// lock-free FIFO queue is currently empty, but tryPopFor() should succeed at expected time
+		TestType testValue {};
+		const auto ret = queue.tryPopFor(wakeUpTimePoint - TickClock::now() + longDuration, testValue);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || testValue != sharedMagicValue ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryPopWhenEmpty(queue);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		sharedMagicValue = TestType{0xb5e13d08};
+		softwareTimer.start(wakeUpTimePoint);
+
+		// lock-free FIFO queue is currently empty, but tryPopUntil() should succeed at expected time
+		TestType testValue {};
+		const auto ret = queue.tryPopUntil(wakeUpTimePoint + longDuration, testValue);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || testValue != sharedMagicValue ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryPopWhenEmpty(queue);
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests whether all \*push\*() and \*pop\*() functions properly return some error when given invalid size of buffer.
+ *
+ * \param Queue is the template of tested lock-free FIFO queue with static storage
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue>
+bool phase4()
+{
+	Queue<TestType, 1> queue;
+	const TestType constTestValue {};
+	TestType nonConstTestValue {};
+
+	{
+		// invalid size is given, so tryPush(const void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPush(&constTestValue, sizeof(constTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start)
+			return false;
+	}
+
+	{
+		// invalid size is given, so pop(void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.pop(&nonConstTestValue, sizeof(nonConstTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start)
+			return false;
+	}
+
+	{
+		// invalid size is given, so tryPop(void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPop(&nonConstTestValue, sizeof(nonConstTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start)
+			return false;
+	}
+
+	{
+		// invalid size is given, so tryPopFor(..., void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopFor(singleDuration, &nonConstTestValue, sizeof(nonConstTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start)
+			return false;
+	}
+
+	{
+		// invalid size is given, so tryPopUntil(..., void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopUntil(TickClock::now() + singleDuration, &nonConstTestValue,
+				sizeof(nonConstTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Runs all phases of test case for one type of lock-free FIFO queue.
+ *
+ * \param Queue is the template of tested lock-free FIFO queue with static storage
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<template<typename, size_t> class Queue>
+bool testQueue()
+{
+	for (const auto& function : {phase1<Queue>, phase2<Queue>, phase3<Queue>, phase4<Queue>})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool LockFreeFifoQueueOperationsTestCase::run_() const
+{
+	constexpr auto expectedContextSwitchCount = 2 * expectedQueueContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	{
+		const auto ret = testQueue<StaticRawSpscFifoQueue>();
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		const auto ret = testQueue<StaticRawMpscFifoQueue>();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief LockFreeFifoQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various RawSpscFifoQueue and RawMpscFifoQueue operations.
+ *
+ * Tests pushing (tryPush()) and popping (pop(), tryPop(), tryPopFor() and tryPopUntil()) to/from RawSpscFifoQueue and
+ * RawMpscFifoQueue, both from thread and from interrupt context - these operations must return expected result, cause
+ * expected number of context switches and finish within expected time frame. Order of elements is also verified across
+ * multiple wrap-arounds of the ring buffers.
+ */
+
+class LockFreeFifoQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief lockFreeFifoQueueTestCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#include "lockFreeFifoQueueTestCases.hpp"
+
+#include "LockFreeFifoQueueOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// LockFreeFifoQueueOperationsTestCase instance
+const LockFreeFifoQueueOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to lock-free FIFO queues
+const TestCaseGroup::Range::value_type lockFreeFifoQueueTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup lockFreeFifoQueueTestCases {TestCaseGroup::Range{lockFreeFifoQueueTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
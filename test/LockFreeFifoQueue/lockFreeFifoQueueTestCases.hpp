@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief lockFreeFifoQueueTestCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-25
+ */
+
+#ifndef TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUETESTCASES_HPP_
+#define TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUETESTCASES_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+class TestCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of test cases related to lock-free FIFO queues
+extern const TestCaseGroup lockFreeFifoQueueTestCases;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_LOCKFREEFIFOQUEUE_LOCKFREEFIFOQUEUETESTCASES_HPP_
@@ -0,0 +1,326 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-27
+ */
+
+#include "MemoryPoolOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticMemoryPool.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of single block of tested memory pool, bytes
+constexpr size_t blockSize {24};
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase1 block involving tryAllocateFor() or tryAllocateUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks on memory pool (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase1TryAllocateForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving software timer (excluding waitForNextTick()): 1 -
+/// main thread blocks on memory pool (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// StaticMemoryPool with blocks of \a blockSize bytes, with \a BlockCount blocks
+template<size_t BlockCount>
+using TestStaticMemoryPool = StaticMemoryPool<blockSize, BlockCount>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests MemoryPool::tryAllocate() when memory pool is empty - it must fail immediately and return EAGAIN
+ *
+ * \param [in] memoryPool is a reference to MemoryPool that will be tested
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTryAllocateWhenEmpty(MemoryPool& memoryPool)
+{
+	// memory pool is empty, so tryAllocate() should fail immediately
+	waitForNextTick();
+	const auto start = TickClock::now();
+	void* block {};
+	const auto ret = memoryPool.tryAllocate(block);
+	return ret == EAGAIN && block == nullptr && TickClock::now() == start;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all allocation functions properly return some error when dealing with empty memory pool and whether
+ * statistics of the pool are updated properly.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestStaticMemoryPool<2> memoryPool;
+	void* blocks[2] {};
+
+	if (memoryPool.getBlockCount() != 2 || memoryPool.getBlockSize() < blockSize || memoryPool.getUsedBlocks() != 0 ||
+			memoryPool.getHighWaterMark() != 0)
+		return false;
+
+	{
+		// memory pool is not empty, so tryAllocate() and allocate() must succeed immediately with different blocks
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (memoryPool.tryAllocate(blocks[0]) != 0 || memoryPool.allocate(blocks[1]) != 0 ||
+				blocks[0] == nullptr || blocks[1] == nullptr || blocks[0] == blocks[1] ||
+				start != TickClock::now())
+			return false;
+		if (memoryPool.getUsedBlocks() != 2 || memoryPool.getHighWaterMark() != 2)
+			return false;
+	}
+
+	{
+		const auto ret = testTryAllocateWhenEmpty(memoryPool);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// memory pool is empty, so tryAllocateFor() should time-out at expected time
+		const auto start = TickClock::now();
+		void* block {};
+		const auto ret = memoryPool.tryAllocateFor(singleDuration, block);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount !=
+				phase1TryAllocateForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// memory pool is empty, so tryAllocateUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		void* block {};
+		const auto ret = memoryPool.tryAllocateUntil(requestedTimePoint, block);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount !=
+				phase1TryAllocateForUntilContextSwitchCount)
+			return false;
+	}
+
+	// freeing of both blocks must succeed, used blocks count must drop, high-water mark must stay
+	if (memoryPool.free(blocks[1]) != 0 || memoryPool.getUsedBlocks() != 1 || memoryPool.free(blocks[0]) != 0 ||
+			memoryPool.getUsedBlocks() != 0 || memoryPool.getHighWaterMark() != 2)
+		return false;
+
+	{
+		// memory pool is not empty, so tryAllocateFor() and tryAllocateUntil() must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (memoryPool.tryAllocateFor(singleDuration, blocks[0]) != 0 ||
+				memoryPool.tryAllocateUntil(start + singleDuration, blocks[1]) != 0 || blocks[0] == blocks[1] ||
+				start != TickClock::now())
+			return false;
+	}
+
+	if (memoryPool.free(blocks[0]) != 0 || memoryPool.free(blocks[1]) != 0)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt -> thread scenario. Main (current) thread waits for a block to become available in memory pool.
+ * Software timer frees the block at specified time point from interrupt context, main thread is expected to receive
+ * this block (with allocate(), tryAllocateFor() and tryAllocateUntil()) in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestStaticMemoryPool<1> memoryPool;
+	void* sharedBlock {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&memoryPool, &sharedBlock]()
+			{
+				memoryPool.free(sharedBlock);
+			});
+
+	if (memoryPool.allocate(sharedBlock) != 0)
+		return false;
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// memory pool is currently empty, but allocate() should succeed at expected time
+		void* block {};
+		const auto ret = memoryPool.allocate(block);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || block != sharedBlock ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryAllocateWhenEmpty(memoryPool);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// memory pool is currently empty, but tryAllocateFor() should succeed at expected time
+		void* block {};
+		const auto ret = memoryPool.tryAllocateFor(wakeUpTimePoint - TickClock::now() + longDuration, block);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || block != sharedBlock ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryAllocateWhenEmpty(memoryPool);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// memory pool is currently empty, but tryAllocateUntil() should succeed at expected time
+		void* block {};
+		const auto ret = memoryPool.tryAllocateUntil(wakeUpTimePoint + longDuration, block);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || block != sharedBlock ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	if (memoryPool.getUsedBlocks() != 1 || memoryPool.getHighWaterMark() != 1)
+		return false;
+
+	return memoryPool.free(sharedBlock) == 0;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether free() properly returns some error when given invalid block.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestStaticMemoryPool<2> memoryPool;
+	void* block {};
+
+	// no block is allocated, so free() must fail
+	if (memoryPool.tryAllocate(block) != 0 || memoryPool.free(block) != 0 || memoryPool.free(block) != EINVAL)
+		return false;
+
+	if (memoryPool.tryAllocate(block) != 0)
+		return false;
+
+	// pointers which don't point to the beginning of any block must be rejected
+	uint8_t foreignBlock[blockSize];
+	if (memoryPool.free(foreignBlock) != EINVAL || memoryPool.free(static_cast<uint8_t*>(block) + 1) != EINVAL ||
+			memoryPool.getUsedBlocks() != 1)
+		return false;
+
+	return memoryPool.free(block) == 0 && memoryPool.getUsedBlocks() == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MemoryPoolOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = 5 * waitForNextTickContextSwitchCount +
+			2 * phase1TryAllocateForUntilContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 5 * waitForNextTickContextSwitchCount +
+			3 * phase2SoftwareTimerContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 0;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
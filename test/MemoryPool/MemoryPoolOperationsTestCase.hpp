@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-27
+ */
+
+#ifndef TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
+#define TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various MemoryPool operations.
+ *
+ * Tests allocation (allocate(), tryAllocate(), tryAllocateFor() and tryAllocateUntil()) and freeing (free()) of blocks,
+ * both from thread and from interrupt context - these operations must return expected result, cause expected number of
+ * context switches and finish within expected time frame. Statistics of the pool are also verified.
+ */
+
+class MemoryPoolOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
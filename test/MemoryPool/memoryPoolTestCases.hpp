@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief memoryPoolTestCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-27
+ */
+
+#ifndef TEST_MEMORYPOOL_MEMORYPOOLTESTCASES_HPP_
+#define TEST_MEMORYPOOL_MEMORYPOOLTESTCASES_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+class TestCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of test cases related to memory pool
+extern const TestCaseGroup memoryPoolTestCases;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MEMORYPOOL_MEMORYPOOLTESTCASES_HPP_
@@ -0,0 +1,420 @@
+/**
+ * \file
+ * \brief MessageBufferOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "MessageBufferOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticMessageBuffer.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// size of header of each message in message buffer, bytes
+constexpr size_t headerSize {sizeof(size_t)};
+
+/// capacity of message buffer used in tests, bytes
+constexpr size_t bufferSize {8 * headerSize};
+
+/// expected number of context switches in block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on message buffer (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/// test data
+const uint8_t testData[bufferSize]
+{
+		0x4b, 0xd1, 0x2e, 0x77, 0x09, 0xc3, 0x5a, 0xf0, 0x61, 0x18, 0xae, 0x3d, 0x92, 0x06, 0xe5, 0x7c,
+		0x20, 0x8f, 0x54, 0xbb, 0x13, 0xca, 0x69, 0x0e, 0xd7, 0x45, 0x3b, 0xa2, 0x80, 0x1f, 0xf6, 0x59,
+		0x2c, 0x97, 0x6e, 0x03, 0xb4, 0x48, 0xdb, 0x71, 0x0a, 0xe9, 0x36, 0x8d, 0x52, 0xc7, 0x1b, 0xa0,
+		0x65, 0xfe, 0x39, 0x84, 0x17, 0xcc, 0x2b, 0x90,
+};
+
+/// size of stack for test threads, bytes
+constexpr size_t testThreadStackSize {256};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Sender thread used in phase 5 of test case.
+ *
+ * \param [in] messageBuffer is a reference to MessageBuffer to which the message will be sent
+ * \param [in] data is a pointer to message that will be sent
+ * \param [in] size is the size of message, bytes
+ * \param [out] sharedRet is a reference to variable in which result of MessageBuffer::trySendFor() will be saved
+ */
+
+void senderThread(MessageBuffer& messageBuffer, const uint8_t* const data, const size_t size, int& sharedRet)
+{
+	sharedRet = messageBuffer.trySendFor(longDuration, data, size);
+}
+
+/**
+ * \brief Tests MessageBuffer::tryReceive() - it must succeed immediately and receive expected message.
+ *
+ * \param [in] messageBuffer is a reference to MessageBuffer that will be tested
+ * \param [in] expectedMessage is a pointer to expected message
+ * \param [in] expectedSize is the size of expected message, bytes
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTryReceive(MessageBuffer& messageBuffer, const void* const expectedMessage, const size_t expectedSize)
+{
+	uint8_t buffer[bufferSize] {};
+	const auto ret = messageBuffer.tryReceive(buffer, sizeof(buffer));
+	return ret.first == 0 && ret.second == expectedSize && memcmp(buffer, expectedMessage, expectedSize) == 0;
+}
+
+/**
+ * \brief Tests MessageBuffer::tryReceive() when no committed message is available - it must fail immediately and
+ * return EAGAIN.
+ *
+ * \param [in] messageBuffer is a reference to MessageBuffer that will be tested
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTryReceiveWhenEmpty(MessageBuffer& messageBuffer)
+{
+	uint8_t buffer[bufferSize] {};
+	const auto ret = messageBuffer.tryReceive(buffer, sizeof(buffer));
+	return ret.first == EAGAIN && ret.second == 0;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether trySend*() and tryReceive*() functions properly send and receive messages, also when the message
+ * doesn't fit at the end of storage, and whether they properly return some error when dealing with invalid size, full
+ * or empty message buffer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticMessageBuffer<bufferSize> messageBuffer;
+
+	if (messageBuffer.getCapacity() != bufferSize)
+		return false;
+
+	// empty message is invalid and message which doesn't fit together with its header can never be sent
+	if (messageBuffer.trySend(testData, 0) != EINVAL || messageBuffer.trySend(testData, bufferSize) != EMSGSIZE)
+		return false;
+
+	if (testTryReceiveWhenEmpty(messageBuffer) != true)
+		return false;
+
+	// each message uses 3 * headerSize bytes (including header)
+	constexpr size_t messageSize {2 * headerSize};
+
+	if (messageBuffer.trySend(testData, messageSize) != 0 ||
+			messageBuffer.trySend(testData + messageSize, messageSize) != 0)
+		return false;
+
+	if (testTryReceive(messageBuffer, testData, messageSize) != true)
+		return false;
+
+	// this message doesn't fit at the end of storage, so it is placed at the beginning
+	if (messageBuffer.trySend(testData + 2 * messageSize, messageSize) != 0)
+		return false;
+
+	// message buffer is full
+	if (messageBuffer.trySend(testData, 1) != EAGAIN)
+		return false;
+
+	{
+		waitForNextTick();
+
+		// message buffer is full, so trySendFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = messageBuffer.trySendFor(singleDuration, testData, 1);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// buffer is too small, so message must be left in message buffer
+		uint8_t buffer[messageSize - 1] {};
+		const auto ret = messageBuffer.tryReceive(buffer, sizeof(buffer));
+		if (ret.first != EMSGSIZE || ret.second != messageSize)
+			return false;
+	}
+
+	if (testTryReceive(messageBuffer, testData + messageSize, messageSize) != true ||
+			testTryReceive(messageBuffer, testData + 2 * messageSize, messageSize) != true ||
+			testTryReceiveWhenEmpty(messageBuffer) != true)
+		return false;
+
+	{
+		waitForNextTick();
+
+		// message buffer is empty, so tryReceiveFor() should time-out at expected time
+		const auto start = TickClock::now();
+		uint8_t buffer[bufferSize] {};
+		const auto ret = messageBuffer.tryReceiveFor(singleDuration, buffer, sizeof(buffer));
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != 0 || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	// message buffer is empty, so the largest possible message must fit
+	return messageBuffer.trySend(testData, bufferSize - headerSize) == 0 &&
+			testTryReceive(messageBuffer, testData, bufferSize - headerSize) == true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryReserve() and commit() properly reserve space for messages and commit them - uncommitted messages
+ * must not be received, committed size may be smaller than reserved and reservation may be discarded.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticMessageBuffer<bufferSize> messageBuffer;
+
+	{
+		const auto ret = messageBuffer.tryReserve(bufferSize - headerSize);
+		if (ret.first != 0 || ret.second == nullptr || reinterpret_cast<uintptr_t>(ret.second) % alignof(size_t) != 0)
+			return false;
+
+		// reserved message is not available until it is committed
+		if (testTryReceiveWhenEmpty(messageBuffer) != true || messageBuffer.trySend(testData, 1) != EAGAIN)
+			return false;
+
+		memcpy(ret.second, testData, 3);
+		if (messageBuffer.commit(ret.second, bufferSize) != EINVAL || messageBuffer.commit(ret.second, 3) != 0 ||
+				messageBuffer.commit(ret.second, 3) != EINVAL)
+			return false;
+
+		if (testTryReceive(messageBuffer, testData, 3) != true || testTryReceiveWhenEmpty(messageBuffer) != true)
+			return false;
+	}
+
+	{
+		const auto ret1 = messageBuffer.tryReserve(headerSize);
+		const auto ret2 = messageBuffer.tryReserve(headerSize);
+		if (ret1.first != 0 || ret2.first != 0)
+			return false;
+
+		// second message is committed first, but it's not available until the first one is committed
+		memcpy(ret2.second, testData + headerSize, headerSize);
+		if (messageBuffer.commit(ret2.second, headerSize) != 0 || testTryReceiveWhenEmpty(messageBuffer) != true)
+			return false;
+
+		memcpy(ret1.second, testData, headerSize);
+		if (messageBuffer.commit(ret1.second, headerSize) != 0 ||
+				testTryReceive(messageBuffer, testData, headerSize) != true ||
+				testTryReceive(messageBuffer, testData + headerSize, headerSize) != true)
+			return false;
+	}
+
+	{
+		// discarded reservation releases its space
+		const auto ret = messageBuffer.tryReserve(bufferSize - headerSize);
+		if (ret.first != 0 || messageBuffer.commit(ret.second, 0) != 0 || testTryReceiveWhenEmpty(messageBuffer) != true)
+			return false;
+	}
+
+	return messageBuffer.trySend(testData, bufferSize - headerSize) == 0 &&
+			testTryReceive(messageBuffer, testData, bufferSize - headerSize) == true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests interrupt -> thread communication scenario. Main (current) thread waits for message to become available in
+ * message buffer. First software timer reserves space for the message from interrupt context and second one fills and
+ * commits it - main thread is expected to be woken only by the second one, when the message is committed.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr size_t messageSize {5};
+
+	StaticMessageBuffer<bufferSize> messageBuffer;
+	void* reservation {};
+	auto softwareTimer1 = makeSoftwareTimer(
+			[&messageBuffer, &reservation]()
+			{
+				reservation = messageBuffer.tryReserve(messageSize).second;
+			});
+	auto softwareTimer2 = makeSoftwareTimer(
+			[&messageBuffer, &reservation]()
+			{
+				if (reservation == nullptr)
+					return;
+
+				memcpy(reservation, testData, messageSize);
+				messageBuffer.commit(reservation, messageSize);
+			});
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer1.start(wakeUpTimePoint - longDuration / 2);
+	softwareTimer2.start(wakeUpTimePoint);
+
+	// message buffer is currently empty, but receive() should succeed at expected time
+	uint8_t buffer[bufferSize] {};
+	const auto ret = messageBuffer.receive(buffer, sizeof(buffer));
+	const auto wokenUpTimePoint = TickClock::now();
+	return ret.first == 0 && ret.second == messageSize && memcmp(buffer, testData, messageSize) == 0 &&
+			wakeUpTimePoint == wokenUpTimePoint &&
+			statistics::getContextSwitchCount() - contextSwitchCount == softwareTimerContextSwitchCount;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests thread -> interrupt communication scenario. Main (current) thread sends large message to message buffer (which
+ * initially contains two messages). Two software timers receive these messages from interrupt context - main thread is
+ * expected to be woken only by the second one, when enough contiguous space is free.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	// each message uses half of the buffer (including header)
+	constexpr size_t messageSize {bufferSize / 2 - headerSize};
+
+	StaticMessageBuffer<bufferSize> messageBuffer;
+	uint8_t buffer[bufferSize] {};
+	auto softwareTimer1 = makeSoftwareTimer(
+			[&messageBuffer, &buffer]()
+			{
+				messageBuffer.tryReceive(buffer, messageSize);
+			});
+	auto softwareTimer2 = makeSoftwareTimer(
+			[&messageBuffer, &buffer]()
+			{
+				messageBuffer.tryReceive(buffer + messageSize, messageSize);
+			});
+
+	if (messageBuffer.trySend(testData, messageSize) != 0 ||
+			messageBuffer.trySend(testData + messageSize, messageSize) != 0)
+		return false;
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer1.start(wakeUpTimePoint - longDuration / 2);
+	softwareTimer2.start(wakeUpTimePoint);
+
+	// message buffer is currently full, but send() should succeed at expected time
+	const auto ret = messageBuffer.send(testData, bufferSize - headerSize);
+	const auto wokenUpTimePoint = TickClock::now();
+	if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || memcmp(buffer, testData, 2 * messageSize) != 0 ||
+			statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerContextSwitchCount)
+		return false;
+
+	return testTryReceive(messageBuffer, testData, bufferSize - headerSize);
+}
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests multiple blocked senders. Two threads with higher priority than main (current) thread block while sending to
+ * message buffer (which initially contains two messages). Each message received by main thread frees enough space for
+ * one of the senders - none of them may be left blocked.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	// each message uses half of the buffer (including header)
+	constexpr size_t messageSize {bufferSize / 2 - headerSize};
+
+	StaticMessageBuffer<bufferSize> messageBuffer;
+	if (messageBuffer.trySend(testData, messageSize) != 0 ||
+			messageBuffer.trySend(testData + messageSize, messageSize) != 0)
+		return false;
+
+	const auto testThreadPriority = static_cast<uint8_t>(ThisThread::getPriority() + 1);
+	int sharedRet1 {-1};
+	int sharedRet2 {-1};
+	auto senderThread1 = makeStaticThread<testThreadStackSize>(testThreadPriority, senderThread,
+			std::ref(messageBuffer), testData + headerSize, messageSize, std::ref(sharedRet1));
+	auto senderThread2 = makeStaticThread<testThreadStackSize>(testThreadPriority, senderThread,
+			std::ref(messageBuffer), testData + 2 * headerSize, messageSize, std::ref(sharedRet2));
+
+	// both senders preempt main thread and block, as message buffer is full
+	senderThread1.start();
+	senderThread2.start();
+
+	const auto ret1 = testTryReceive(messageBuffer, testData, messageSize);
+	const auto ret2 = testTryReceive(messageBuffer, testData + messageSize, messageSize);
+	senderThread1.join();
+	senderThread2.join();
+	return ret1 == true && ret2 == true && sharedRet1 == 0 && sharedRet2 == 0 &&
+			testTryReceive(messageBuffer, testData + headerSize, messageSize) == true &&
+			testTryReceive(messageBuffer, testData + 2 * headerSize, messageSize) == true &&
+			testTryReceiveWhenEmpty(messageBuffer) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MessageBufferOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief MessageBufferOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_MESSAGEBUFFER_MESSAGEBUFFEROPERATIONSTESTCASE_HPP_
+#define TEST_MESSAGEBUFFER_MESSAGEBUFFEROPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various MessageBuffer operations.
+ *
+ * Tests sending (trySend() and trySendFor()), receiving (tryReceive() and tryReceiveFor()), reserving (tryReserve())
+ * and committing (commit()) of messages of various length, including messages which don't fit at the end of storage.
+ * Tests interrupt -> thread and thread -> interrupt communication scenarios - blocked receiver must be woken only when
+ * the message is committed and blocked sender must be woken only when enough contiguous space is free. Tests whether
+ * none of multiple blocked senders is left blocked when enough space is freed for each of them.
+ */
+
+class MessageBufferOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MESSAGEBUFFER_MESSAGEBUFFEROPERATIONSTESTCASE_HPP_
@@ -0,0 +1,214 @@
+/**
+ * \file
+ * \brief BasicMutexOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-05
+ */
+
+#include "BasicMutexOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/BasicMutex.hpp"
+#include "distortos/StaticThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {256};
+
+static_assert(sizeof(BasicMutex<Mutex::Type::Normal, Mutex::Protocol::None>) < sizeof(Mutex),
+		"BasicMutex with Type::Normal and Protocol::None must be smaller than Mutex!");
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests BasicMutex::tryLock() when mutex is locked - it must succeed immediately and return EBUSY
+ *
+ * BasicMutex::tryLock() is called from another thread.
+ *
+ * \param MutexType is the type of mutex
+ * \param MutexProtocol is the mutex protocol
+ *
+ * \param [in] mutex is a reference to mutex that will be tested
+ * \param [in] priority is the priority of the created thread
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+bool testTryLockWhenLocked(BasicMutex<MutexType, MutexProtocol>& mutex, const uint8_t priority)
+{
+	bool sharedRet {};
+	auto tryLockThreadObject = makeStaticThread<testThreadStackSize>(priority,
+			[&mutex, &sharedRet]()
+			{
+				const auto start = TickClock::now();
+				const auto ret = mutex.tryLock();
+				sharedRet = ret == EBUSY && start == TickClock::now();
+			});
+	waitForNextTick();
+	tryLockThreadObject.start();
+	tryLockThreadObject.join();
+
+	return sharedRet;
+}
+
+/**
+ * \brief Runs the test for single combination of type and protocol.
+ *
+ * \param MutexType is the type of mutex
+ * \param MutexProtocol is the mutex protocol
+ *
+ * \param [in] priorityCeiling is the priority ceiling of mutex, ignored when MutexProtocol != PriorityProtect
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<Mutex::Type MutexType, Mutex::Protocol MutexProtocol>
+bool testBasicMutex(const uint8_t priorityCeiling)
+{
+	BasicMutex<MutexType, MutexProtocol> mutex {priorityCeiling};
+	// thread calling tryLock() must not violate priority ceiling of mutex
+	const uint8_t tryLockPriority = MutexProtocol == Mutex::Protocol::PriorityProtect ? priorityCeiling : UINT8_MAX;
+
+	{
+		// simple lock - must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = mutex.lock();
+		if (ret != 0 || start != TickClock::now())
+			return false;
+	}
+
+	if (testTryLockWhenLocked(mutex, tryLockPriority) != true)
+		return false;
+
+	if (MutexType == Mutex::Type::ErrorChecking)
+	{
+		// re-lock attempts - must fail with EDEADLK immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (mutex.lock() != EDEADLK || mutex.tryLockFor(singleDuration) != EDEADLK ||
+				mutex.tryLockUntil(start + singleDuration) != EDEADLK || mutex.tryLock() != EBUSY ||
+				start != TickClock::now())
+			return false;
+	}
+
+	if (MutexType == Mutex::Type::Recursive)
+	{
+		// recursive locks and matching unlocks - must succeed immediately, mutex must remain locked
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (mutex.lock() != 0 || mutex.tryLock() != 0 || mutex.tryLockFor(singleDuration) != 0 ||
+				mutex.tryLockUntil(start + singleDuration) != 0 || mutex.unlock() != 0 || mutex.unlock() != 0 ||
+				mutex.unlock() != 0 || mutex.unlock() != 0 || start != TickClock::now())
+			return false;
+
+		if (testTryLockWhenLocked(mutex, tryLockPriority) != true)
+			return false;
+	}
+
+	{
+		// simple unlock - must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = mutex.unlock();
+		if (ret != 0 || start != TickClock::now())
+			return false;
+	}
+
+	if (MutexType != Mutex::Type::Normal)
+	{
+		// excessive unlock - must fail with EPERM immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = mutex.unlock();
+		if (ret != EPERM || start != TickClock::now())
+			return false;
+	}
+
+	{
+		// lock with timeout of unlocked mutex - must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (mutex.tryLockFor(singleDuration) != 0 || mutex.unlock() != 0 ||
+				mutex.tryLockUntil(start + singleDuration) != 0 || mutex.unlock() != 0 || start != TickClock::now())
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Tests that locking of BasicMutex with PriorityProtect protocol and priority ceiling lower than priority of
+ * current thread fails with EINVAL.
+ *
+ * \param MutexType is the type of mutex
+ *
+ * \param [in] priorityCeiling is the priority ceiling of mutex, must be lower than priority of current thread
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<Mutex::Type MutexType>
+bool testPriorityCeilingViolation(const uint8_t priorityCeiling)
+{
+	BasicMutex<MutexType, Mutex::Protocol::PriorityProtect> mutex {priorityCeiling};
+	waitForNextTick();
+	const auto start = TickClock::now();
+	return mutex.lock() == EINVAL && mutex.tryLock() == EINVAL && mutex.tryLockFor(singleDuration) == EINVAL &&
+			mutex.tryLockUntil(start + singleDuration) == EINVAL && start == TickClock::now();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool BasicMutexOperationsTestCase::run_() const
+{
+	constexpr uint8_t lowerPriorityCeiling {testCasePriority_ - 1};
+
+	return testBasicMutex<Mutex::Type::Normal, Mutex::Protocol::None>({}) == true &&
+			testBasicMutex<Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance>({}) == true &&
+			testBasicMutex<Mutex::Type::Normal, Mutex::Protocol::PriorityProtect>(UINT8_MAX) == true &&
+			testBasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::None>({}) == true &&
+			testBasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityInheritance>({}) == true &&
+			testBasicMutex<Mutex::Type::ErrorChecking, Mutex::Protocol::PriorityProtect>(testCasePriority_) == true &&
+			testBasicMutex<Mutex::Type::Recursive, Mutex::Protocol::None>({}) == true &&
+			testBasicMutex<Mutex::Type::Recursive, Mutex::Protocol::PriorityInheritance>({}) == true &&
+			testBasicMutex<Mutex::Type::Recursive, Mutex::Protocol::PriorityProtect>(UINT8_MAX) == true &&
+			testPriorityCeilingViolation<Mutex::Type::Normal>(lowerPriorityCeiling) == true &&
+			testPriorityCeilingViolation<Mutex::Type::ErrorChecking>(lowerPriorityCeiling) == true &&
+			testPriorityCeilingViolation<Mutex::Type::Recursive>(lowerPriorityCeiling) == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
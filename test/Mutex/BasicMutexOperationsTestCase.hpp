@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief BasicMutexOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-05
+ */
+
+#ifndef TEST_MUTEX_BASICMUTEXOPERATIONSTESTCASE_HPP_
+#define TEST_MUTEX_BASICMUTEXOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests operations of BasicMutex for all combinations of type and protocol.
+ *
+ * Tests locking (lock(), tryLock(), tryLockFor() and tryLockUntil()) and unlocking, including the error codes specific
+ * for given type and protocol.
+ */
+
+class BasicMutexOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief BasicMutexOperationsTestCase's constructor
+	 */
+
+	constexpr BasicMutexOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MUTEX_BASICMUTEXOPERATIONSTESTCASE_HPP_
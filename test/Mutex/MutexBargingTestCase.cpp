@@ -0,0 +1,254 @@
+/**
+ * \file
+ * \brief MutexBargingTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "MutexBargingTestCase.hpp"
+
+#include "SequenceAsserter.hpp"
+
+#include "distortos/Mutex.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {384};
+
+/// duration used as timeout in tryLockFor(), long enough to never expire in the test
+constexpr TickClock::duration longDuration {1000};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Waiting test thread.
+ *
+ * Marks first sequence point, locks the mutex (with lock() or tryLockFor()), marks the sequence point of this thread
+ * and unlocks the mutex.
+ *
+ * \param [in] mutex is a reference to tested mutex
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] timed selects whether the mutex is locked with tryLockFor() (true) or with lock() (false)
+ * \param [in] sequencePoint is the sequence point of this thread, marked after the mutex is locked
+ * \param [out] ret is a reference to variable for value returned by lock() or tryLockFor()
+ */
+
+void waitingThread(Mutex& mutex, SequenceAsserter& sequenceAsserter, const bool timed,
+		const unsigned int sequencePoint, int& ret)
+{
+	sequenceAsserter.sequencePoint(0);
+	ret = timed == true ? mutex.tryLockFor(longDuration) : mutex.lock();
+	sequenceAsserter.sequencePoint(sequencePoint);
+	if (ret == 0)
+		mutex.unlock();
+}
+
+/**
+ * \brief Locking test thread.
+ *
+ * Marks first sequence point, locks the mutex, marks second sequence point and unlocks the mutex.
+ *
+ * \param [in] mutex is a reference to tested mutex
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] firstSequencePoint is the sequence point marked before the mutex is locked
+ * \param [in] secondSequencePoint is the sequence point marked after the mutex is locked
+ * \param [out] ret is a reference to variable for value returned by lock()
+ */
+
+void lockingThread(Mutex& mutex, SequenceAsserter& sequenceAsserter, const unsigned int firstSequencePoint,
+		const unsigned int secondSequencePoint, int& ret)
+{
+	sequenceAsserter.sequencePoint(firstSequencePoint);
+	ret = mutex.lock();
+	sequenceAsserter.sequencePoint(secondSequencePoint);
+	if (ret == 0)
+		mutex.unlock();
+}
+
+/**
+ * \brief Tests unlock of the mutex with thread of equal priority blocked on it.
+ *
+ * With UnlockMode::Handoff the blocked thread becomes the owner of the mutex, so tryLock() done by the unlocking thread
+ * right after unlock() must fail. With UnlockMode::Barging the mutex is left unlocked, so tryLock() must succeed and
+ * the unblocked thread must lock the mutex later.
+ *
+ * \param [in] unlockMode is the unlock mode of tested mutex
+ * \param [in] timed selects whether the waiting thread uses tryLockFor() (true) or lock() (false)
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool unlockModePhase(const Mutex::UnlockMode unlockMode, const bool timed)
+{
+	SequenceAsserter sequenceAsserter;
+	Mutex mutex {Mutex::Type::Normal, Mutex::Protocol::None, {}, unlockMode};
+	int waitingThreadRet {-1};
+	auto waitingThreadObject = makeStaticThread<testThreadStackSize>(ThisThread::getPriority(), waitingThread,
+			std::ref(mutex), std::ref(sequenceAsserter), timed, 3u, std::ref(waitingThreadRet));
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			return false;
+	}
+
+	waitingThreadObject.start();
+	ThisThread::yield();	// waiting thread blocks on the mutex
+
+	sequenceAsserter.sequencePoint(1);
+	mutex.unlock();
+	const auto tryLockRet = mutex.tryLock();
+	sequenceAsserter.sequencePoint(2);
+	if (tryLockRet == 0)
+		mutex.unlock();
+
+	waitingThreadObject.join();
+
+	const auto expectedTryLockRet = unlockMode == Mutex::UnlockMode::Barging ? 0 : EBUSY;
+	return tryLockRet == expectedTryLockRet && waitingThreadRet == 0 && sequenceAsserter.assertSequence(4) == true;
+}
+
+/**
+ * \brief Tests UnlockMode::Barging with PriorityInheritance protocol.
+ *
+ * Thread with higher priority blocked on the mutex must boost the priority of the owner, must get the mutex
+ * immediately after it is unlocked and the priority of unlocking thread must be restored.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool priorityInheritancePhase()
+{
+	const auto priority = ThisThread::getPriority();
+	SequenceAsserter sequenceAsserter;
+	Mutex mutex {Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance, {}, Mutex::UnlockMode::Barging};
+	int waitingThreadRet {-1};
+	auto waitingThreadObject = makeStaticThread<testThreadStackSize>(priority + 1, waitingThread, std::ref(mutex),
+			std::ref(sequenceAsserter), false, 2u, std::ref(waitingThreadRet));
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			return false;
+	}
+
+	waitingThreadObject.start();	// waiting thread preempts this thread and blocks on the mutex
+
+	const auto boostedPriority = ThisThread::get().getEffectivePriority();
+	sequenceAsserter.sequencePoint(1);
+	mutex.unlock();
+	sequenceAsserter.sequencePoint(3);
+	const auto restoredPriority = ThisThread::get().getEffectivePriority();
+
+	waitingThreadObject.join();
+
+	return boostedPriority == priority + 1 && restoredPriority == priority && waitingThreadRet == 0 &&
+			sequenceAsserter.assertSequence(4) == true;
+}
+
+/**
+ * \brief Tests UnlockMode::Barging with PriorityInheritance protocol and multiple blocked threads.
+ *
+ * Two threads with higher priority block on the mutex. Unlock wakes only the first one, so the mutex is left unowned
+ * while the second one is still blocked on it. Priority of the second thread is raised in that moment - this must not
+ * touch the (non-existent) owner of the mutex. The first thread locks the mutex when it runs, gets boosted by the
+ * second thread and hands the mutex over to it when unlocking.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool priorityInheritanceMultipleWaitersPhase()
+{
+	const auto priority = ThisThread::getPriority();
+	SequenceAsserter sequenceAsserter;
+	Mutex mutex {Mutex::Type::Normal, Mutex::Protocol::PriorityInheritance, {}, Mutex::UnlockMode::Barging};
+	int lockingThreadRet1 {-1};
+	int lockingThreadRet2 {-1};
+	auto lockingThreadObject1 = makeStaticThread<testThreadStackSize>(priority + 1, lockingThread, std::ref(mutex),
+			std::ref(sequenceAsserter), 1u, 3u, std::ref(lockingThreadRet1));
+	auto lockingThreadObject2 = makeStaticThread<testThreadStackSize>(priority + 1, lockingThread, std::ref(mutex),
+			std::ref(sequenceAsserter), 2u, 4u, std::ref(lockingThreadRet2));
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			return false;
+	}
+
+	sequenceAsserter.sequencePoint(0);
+	lockingThreadObject1.start();	// first locking thread preempts this thread and blocks on the mutex
+	lockingThreadObject2.start();
+	ThisThread::yield();	// this thread is boosted to priority of second locking thread, which blocks on the mutex now
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		// first locking thread is unblocked, but it cannot run yet - the mutex is unowned
+		mutex.unlock();
+		lockingThreadObject2.setPriority(priority + 2);
+	}
+
+	const auto restoredPriority = ThisThread::get().getEffectivePriority();
+	sequenceAsserter.sequencePoint(5);
+
+	lockingThreadObject1.join();
+	lockingThreadObject2.join();
+
+	return restoredPriority == priority && lockingThreadRet1 == 0 && lockingThreadRet2 == 0 &&
+			sequenceAsserter.assertSequence(6) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexBargingTestCase::run_() const
+{
+	for (const auto unlockMode : {Mutex::UnlockMode::Handoff, Mutex::UnlockMode::Barging})
+		for (const auto timed : {false, true})
+		{
+			const auto ret = unlockModePhase(unlockMode, timed);
+			if (ret != true)
+				return ret;
+		}
+
+	{
+		const auto ret = priorityInheritancePhase();
+		if (ret != true)
+			return ret;
+	}
+
+	return priorityInheritanceMultipleWaitersPhase();
+}
+
+}	// namespace test
+
+}	// namespace distortos
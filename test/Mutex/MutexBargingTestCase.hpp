@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief MutexBargingTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_MUTEX_MUTEXBARGINGTESTCASE_HPP_
+#define TEST_MUTEX_MUTEXBARGINGTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests unlock modes of mutex.
+ *
+ * Tests that with UnlockMode::Handoff the ownership of the mutex is transferred to the thread blocked on the mutex,
+ * while with UnlockMode::Barging the mutex is left unlocked - so the unlocking thread can lock it again - and the
+ * unblocked thread locks it later, with lock() and with tryLockFor(). Tests also that with UnlockMode::Barging and
+ * PriorityInheritance protocol the higher priority thread blocked on the mutex gets it immediately after unlock and
+ * that the priority of unlocking thread is restored, also when priority of a thread which is still blocked on the
+ * unowned mutex is changed.
+ */
+
+class MutexBargingTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX / 2};
+
+public:
+
+	/**
+	 * \brief MutexBargingTestCase's constructor
+	 */
+
+	constexpr MutexBargingTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MUTEX_MUTEXBARGINGTESTCASE_HPP_
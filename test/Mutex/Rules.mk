@@ -6,7 +6,7 @@
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
-# date: 2015-01-07
+# date: 2015-06-01
 #
 
 #-----------------------------------------------------------------------------------------------------------------------
@@ -16,7 +16,7 @@
 CXXFLAGS_$(d) := -I$(d)
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -Itest
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -Iinclude
-CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -Isource/architecture/ARM/ARMv7-M/include
+CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -I$(ARCHITECTURE_DIRECTORY)/include
 
 #-----------------------------------------------------------------------------------------------------------------------
 # standard footer
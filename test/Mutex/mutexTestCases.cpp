@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-16
  */
 
 #include "mutexTestCases.hpp"
@@ -20,6 +20,8 @@
 #include "MutexPriorityProtectOperationsTestCase.hpp"
 #include "MutexPriorityInheritanceOperationsTestCase.hpp"
 #include "MutexPriorityProtocolTestCase.hpp"
+#include "BasicMutexOperationsTestCase.hpp"
+#include "MutexBargingTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -57,6 +59,12 @@ const MutexPriorityInheritanceOperationsTestCase priorityInheritanceOperationsTe
 /// MutexPriorityProtocolTestCase instance
 const MutexPriorityProtocolTestCase priorityProtocolTestCase;
 
+/// BasicMutexOperationsTestCase instance
+const BasicMutexOperationsTestCase basicOperationsTestCase;
+
+/// MutexBargingTestCase instance
+const MutexBargingTestCase bargingTestCase;
+
 /// array with references to TestCase objects related to mutexes
 const TestCaseGroup::Range::value_type mutexTestCases_[]
 {
@@ -67,6 +75,8 @@ const TestCaseGroup::Range::value_type mutexTestCases_[]
 		TestCaseGroup::Range::value_type{priorityProtectOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityInheritanceOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityProtocolTestCase},
+		TestCaseGroup::Range::value_type{basicOperationsTestCase},
+		TestCaseGroup::Range::value_type{bargingTestCase},
 };
 
 }	// namespace
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-01-09
+ * \date 2015-06-18
  */
 
 #include "RawFifoQueueOperationsTestCase.hpp"
@@ -539,6 +539,15 @@ bool phase5()
 			return false;
 	}
 
+	{
+		// invalid size is given, so pushOverwriting(const void*, size_t) should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = rawMessageQueue.pushOverwriting(&constTestValue, sizeof(constTestValue) - 1);
+		if (ret != EMSGSIZE || TickClock::now() != start || rawMessageQueue.getDroppedCount() != 0)
+			return false;
+	}
+
 	{
 		// invalid size is given, so pop(void*, size_t) should fail immediately
 		waitForNextTick();
@@ -579,6 +588,54 @@ bool phase5()
 	return true;
 }
 
+/**
+ * \brief Phase 6 of test case.
+ *
+ * Tests whether pushOverwriting() pushes elements to non-full raw FIFO queue and drops the oldest elements when the raw
+ * FIFO queue is full, without blocking - raw FIFO queue must contain the newest elements in the order in which they
+ * were pushed and number of dropped elements must be reported by getDroppedCount().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase6()
+{
+	TestStaticRawFifoQueue<2> rawFifoQueue;
+	const TestType values[] {0x3f6a21c8, 0x8d0e47b3, 0x14c9f65a, 0xe2573b90, 0x79b1d40f};
+
+	waitForNextTick();
+	const auto start = TickClock::now();
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	size_t pushed {};
+	for (const auto value : values)
+	{
+		const auto ret = rawFifoQueue.pushOverwriting(value);
+		++pushed;
+		const auto expectedDroppedCount = pushed > 2 ? pushed - 2 : 0;
+		if (ret != 0 || rawFifoQueue.getDroppedCount() != expectedDroppedCount)
+			return false;
+	}
+
+	// raw FIFO queue must contain the two newest elements
+	for (size_t i = sizeof(values) / sizeof(*values) - 2; i < sizeof(values) / sizeof(*values); ++i)
+	{
+		TestType testValue {};
+		const auto ret = rawFifoQueue.tryPop(testValue);
+		if (ret != 0 || testValue != values[i])
+			return false;
+	}
+
+	{
+		TestType testValue {};
+		const auto ret = rawFifoQueue.tryPop(testValue);
+		if (ret != EAGAIN)
+			return false;
+	}
+
+	return TickClock::now() == start && statistics::getContextSwitchCount() == contextSwitchCount;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -594,13 +651,15 @@ bool RawFifoQueueOperationsTestCase::run_() const
 			3 * phase34SoftwareTimerContextSwitchCount;
 	constexpr auto phase4ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
 			3 * phase34SoftwareTimerContextSwitchCount;
-	constexpr auto phase5ExpectedContextSwitchCount = 8 * waitForNextTickContextSwitchCount;
+	constexpr auto phase5ExpectedContextSwitchCount = 9 * waitForNextTickContextSwitchCount;
+	constexpr auto phase6ExpectedContextSwitchCount = waitForNextTickContextSwitchCount;
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
-			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount +
+			phase6ExpectedContextSwitchCount;
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
 	{
 		const auto ret = function();
 		if (ret != true)
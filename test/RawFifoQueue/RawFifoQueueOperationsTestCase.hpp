@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #ifndef TEST_RAWFIFOQUEUE_RAWFIFOQUEUEOPERATIONSTESTCASE_HPP_
@@ -25,9 +25,10 @@ namespace test
 /**
  * \brief Tests various RawFifoQueue operations.
  *
- * Tests pushing (push(), tryPush(), tryPushFor() and tryPushUntil()) and popping (pop(), tryPop(), tryPopFor() and
- * tryPopUntil()) to/from RawFifoQueue, both from thread and from interrupt context - these operations must return
- * expected result, cause expected number of context switches and finish within expected time frame.
+ * Tests pushing (push(), tryPush(), tryPushFor(), tryPushUntil() and pushOverwriting()) and popping (pop(), tryPop(),
+ * tryPopFor() and tryPopUntil()) to/from RawFifoQueue, both from thread and from interrupt context - these operations
+ * must return expected result, cause expected number of context switches and finish within expected time frame.
+ * Tests also whether pushOverwriting() drops the oldest elements and whether they are counted by getDroppedCount().
  */
 
 class RawFifoQueueOperationsTestCase : public TestCaseCommon
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-01
  */
 
 #include "RawFifoQueuePriorityTestCase.hpp"
@@ -106,7 +106,7 @@ bool popFinalCheck(RawFifoQueue& rawFifoQueue)
 void popPrepare(RawFifoQueue& rawFifoQueue)
 {
 	for (size_t i = 0; i < totalThreads; ++i)
-		rawFifoQueue.tryPush(i);
+		rawFifoQueue.tryPush(static_cast<TestType>(i));
 }
 
 /**
@@ -173,7 +173,7 @@ void pushThread(SequenceAsserter& sequenceAsserter, const SequencePoints sequenc
 
 bool pushTrigger(RawFifoQueue& rawFifoQueue, const size_t i)
 {
-	rawFifoQueue.push(i + totalThreads);
+	rawFifoQueue.push(static_cast<TestType>(i + totalThreads));
 	return true;
 }
 
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-01
  */
 
 #include "RawMessageQueuePriorityTestCase.hpp"
@@ -109,7 +109,7 @@ bool popFinalCheck(RawMessageQueue& rawMessageQueue)
 void popPrepare(RawMessageQueue& rawMessageQueue)
 {
 	for (size_t i = 0; i < totalThreads; ++i)
-		rawMessageQueue.tryPush(i, i);
+		rawMessageQueue.tryPush(i, static_cast<TestType>(i));
 }
 
 /**
@@ -183,7 +183,8 @@ void pushThread(SequenceAsserter& sequenceAsserter, const SequencePoints sequenc
 
 bool pushTrigger(RawMessageQueue& rawMessageQueue, size_t, const ThreadParameters& threadParameters)
 {
-	rawMessageQueue.push(threadParameters.first, totalThreads + threadParameters.second);
+	rawMessageQueue.push(threadParameters.first,
+			static_cast<TestType>(totalThreads + threadParameters.second));
 	return true;
 }
 
@@ -6,7 +6,7 @@
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
-# date: 2015-02-18
+# date: 2015-06-18
 #
 
 #-----------------------------------------------------------------------------------------------------------------------
@@ -14,7 +14,12 @@
 #-----------------------------------------------------------------------------------------------------------------------
 
 SUBDIRECTORIES += ConditionVariable
+SUBDIRECTORIES += DeferredRequests
 SUBDIRECTORIES += FifoQueue
+SUBDIRECTORIES += LatestValue
+SUBDIRECTORIES += LockFreeFifoQueue
+SUBDIRECTORIES += MemoryPool
+SUBDIRECTORIES += MessageBuffer
 SUBDIRECTORIES += MessageQueue
 SUBDIRECTORIES += Mutex
 SUBDIRECTORIES += RawFifoQueue
@@ -22,7 +27,10 @@ SUBDIRECTORIES += RawMessageQueue
 SUBDIRECTORIES += Semaphore
 SUBDIRECTORIES += Signals
 SUBDIRECTORIES += SoftwareTimer
+SUBDIRECTORIES += SortedContainer
+SUBDIRECTORIES += StreamBuffer
 SUBDIRECTORIES += Thread
+SUBDIRECTORIES += WaitForAnySet
 
 #-----------------------------------------------------------------------------------------------------------------------
 # compilation flags
@@ -30,7 +38,7 @@ SUBDIRECTORIES += Thread
 
 CXXFLAGS_$(d) := -I$(d)
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -Iinclude
-CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -Isource/architecture/ARM/ARMv7-M/include
+CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) -I$(ARCHITECTURE_DIRECTORY)/include
 
 #-----------------------------------------------------------------------------------------------------------------------
 # standard footer
@@ -0,0 +1,246 @@
+/**
+ * \file
+ * \brief SoftwareTimerPeriodicTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "SoftwareTimerPeriodicTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// period of software timers used in tests
+constexpr auto period = TickClock::duration{3};
+
+/// number of executions of periodic software timer in phase 1
+constexpr size_t executions {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with time points of executions of software timer's function
+using TimePoints = std::array<TickClock::time_point, executions>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether periodic software timer is executed at time points which are exact multiples of its period (also when
+ * it was started with duration) and whether it can be stopped from its own function.
+ *
+ * \param [in] executionContext is the context in which software timer's function is executed
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1(const SoftwareTimerBase::ExecutionContext executionContext)
+{
+	TimePoints timePoints {};
+	size_t count {};
+	SoftwareTimerBase* softwareTimerPointer {};
+	auto softwareTimer = makeSoftwareTimer(executionContext,
+			[&timePoints, &count, &softwareTimerPointer]()
+			{
+				timePoints[count] = TickClock::now();
+				if (++count == timePoints.size())
+					softwareTimerPointer->stop();
+			});
+	softwareTimerPointer = &softwareTimer;
+
+	for (const auto useDuration : {false, true})
+	{
+		count = {};
+
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		const auto firstTimePoint = useDuration == true ? start + period + decltype(period){1} : start + period;
+		if (useDuration == true)
+			softwareTimer.start(period, period);
+		else
+			softwareTimer.start(firstTimePoint, period);
+
+		if (softwareTimer.isRunning() != true || softwareTimer.getPeriod() != period)
+			return false;
+
+		ThisThread::sleepUntil(firstTimePoint + period * (executions + 1));
+
+		if (softwareTimer.isRunning() != false || count != executions || softwareTimer.getOverrunCount() != 0)
+			return false;
+
+		for (size_t i {}; i < timePoints.size(); ++i)
+			if (timePoints[i] != firstTimePoint + period * i)
+				return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests counting of overruns of periodic software timer which is started with time point in the past - expirations
+ * which already passed must be skipped (with single execution of function) and counted as overruns, but following
+ * expiration time points must still be exact multiples of period.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	std::array<TickClock::time_point, 2> timePoints {};
+	std::array<uint64_t, timePoints.size()> overrunCounts {};
+	size_t count {};
+	SoftwareTimerBase* softwareTimerPointer {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&timePoints, &overrunCounts, &count, &softwareTimerPointer]()
+			{
+				timePoints[count] = TickClock::now();
+				overrunCounts[count] = softwareTimerPointer->getOverrunCount();
+				if (++count == timePoints.size())
+					softwareTimerPointer->stop();
+			});
+	softwareTimerPointer = &softwareTimer;
+
+	waitForNextTick();
+
+	// first expiration is at "start - period * 3", following expirations at "start - period * 2", "start - period" and
+	// "start" also passed before execution of function in next tick
+	const auto start = TickClock::now();
+	softwareTimer.start(start - period * 3, period);
+	ThisThread::sleepUntil(start + period * 3);
+
+	return softwareTimer.isRunning() == false && count == timePoints.size() &&
+			timePoints[0] == start + decltype(period){1} && overrunCounts[0] == 3 &&
+			timePoints[1] == start + period && overrunCounts[1] == 0;
+}
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests counting of overruns of periodic software timer executed by software timer service thread. First execution of
+ * function takes longer than period of the timer, so the expiration which passed in the meantime is executed late and
+ * the one which passed before this late execution is skipped and counted as overrun.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	std::array<TickClock::time_point, 2> timePoints {};
+	std::array<uint64_t, timePoints.size()> overrunCounts {};
+	size_t count {};
+	SoftwareTimerBase* softwareTimerPointer {};
+	auto softwareTimer = makeSoftwareTimer(SoftwareTimerBase::ExecutionContext::ServiceThread,
+			[&timePoints, &overrunCounts, &count, &softwareTimerPointer]()
+			{
+				timePoints[count] = TickClock::now();
+				overrunCounts[count] = softwareTimerPointer->getOverrunCount();
+				if (++count == timePoints.size())
+					softwareTimerPointer->stop();
+				else
+					ThisThread::sleepFor(period * 2);
+			});
+	softwareTimerPointer = &softwareTimer;
+
+	waitForNextTick();
+
+	// first execution ends at "start + period * 3 + 1", when expiration at "start + period * 2" was already handed over
+	// to service thread and expiration at "start + period * 3" already passed
+	const auto start = TickClock::now();
+	softwareTimer.start(start + period, period);
+	ThisThread::sleepUntil(start + period * 5);
+
+	return softwareTimer.isRunning() == false && count == timePoints.size() &&
+			timePoints[0] == start + period && overrunCounts[0] == 0 &&
+			timePoints[1] == start + period * 3 + decltype(period){1} && overrunCounts[1] == 1;
+}
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests whether software timer started with negative std::chrono period is executed only once, like a one-shot timer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	size_t count {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&count]()
+			{
+				++count;
+			});
+
+	waitForNextTick();
+
+	const auto start = TickClock::now();
+	softwareTimer.start(start + period, -std::chrono::milliseconds{1});
+
+	if (softwareTimer.isRunning() != true || softwareTimer.getPeriod() != TickClock::duration{})
+		return false;
+
+	ThisThread::sleepUntil(start + period * 3);
+
+	return softwareTimer.isRunning() == false && count == 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerPeriodicTestCase::run_() const
+{
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	return phase1(SoftwareTimerBase::ExecutionContext::Interrupt) == true && phase2() == true &&
+			phase1(SoftwareTimerBase::ExecutionContext::ServiceThread) == true && phase3() == true &&
+			phase4() == true;
+
+#else	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE == 0
+
+	return phase1(SoftwareTimerBase::ExecutionContext::Interrupt) == true && phase2() == true && phase4() == true;
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE == 0
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,205 @@
+/**
+ * \file
+ * \brief SoftwareTimerServiceThreadTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "SoftwareTimerServiceThreadTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether function of software timer is executed at expected time by software timer service thread, which has
+ * expected priority and in which the function may block.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore semaphore {0};
+	TickClock::time_point executionTimePoint {};
+	const ThreadBase* executingThread {};
+	uint8_t executingPriority {};
+	auto softwareTimer = makeSoftwareTimer(SoftwareTimerBase::ExecutionContext::ServiceThread,
+			[&semaphore, &executionTimePoint, &executingThread, &executingPriority]()
+			{
+				executionTimePoint = TickClock::now();
+				executingThread = &ThisThread::get();
+				executingPriority = ThisThread::getEffectivePriority();
+				ThisThread::sleepFor(singleDuration);	// blocking is possible only in thread context
+				semaphore.post();
+			});
+
+	if (softwareTimer.getExecutionContext() != SoftwareTimerBase::ExecutionContext::ServiceThread)
+		return false;
+
+	waitForNextTick();
+
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer.start(wakeUpTimePoint);
+	const auto ret = semaphore.tryWaitUntil(wakeUpTimePoint + longDuration);
+	const auto postTimePoint = TickClock::now();
+	return ret == 0 && softwareTimer.isRunning() == false && executionTimePoint == wakeUpTimePoint &&
+			executingThread != &ThisThread::get() &&
+			executingPriority == CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_PRIORITY &&
+			postTimePoint == wakeUpTimePoint + singleDuration + decltype(singleDuration){1};
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests hand-over of expired software timers to software timer service thread. Function of first software timer blocks
+ * the service thread, so second software timer which expires in the meantime must wait for execution - it must still
+ * be running and it must be possible to cancel it with stop(). When it is not stopped, it must be executed after the
+ * function of first software timer returns.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	volatile uint32_t blockingCount {};
+	volatile uint32_t waitingCount {};
+	volatile uint32_t blockingCountInWaiting {};
+	auto blockingSoftwareTimer = makeSoftwareTimer(SoftwareTimerBase::ExecutionContext::ServiceThread,
+			[&blockingCount]()
+			{
+				ThisThread::sleepFor(longDuration);
+				++blockingCount;
+			});
+	auto waitingSoftwareTimer = makeSoftwareTimer(SoftwareTimerBase::ExecutionContext::ServiceThread,
+			[&blockingCount, &waitingCount, &blockingCountInWaiting]()
+			{
+				blockingCountInWaiting = blockingCount;
+				++waitingCount;
+			});
+
+	for (const auto stop : {true, false})
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		blockingSoftwareTimer.start(start + singleDuration);
+		waitingSoftwareTimer.start(start + singleDuration * 2);
+		ThisThread::sleepUntil(start + singleDuration * 3);
+
+		// waiting software timer expired, but its function cannot be executed yet
+		if (waitingSoftwareTimer.isRunning() != true || blockingSoftwareTimer.isRunning() != false ||
+				waitingCount != 0 || blockingCount != (stop == true ? 0 : 1))
+			return false;
+
+		if (stop == true)
+			waitingSoftwareTimer.stop();
+
+		ThisThread::sleepFor(longDuration * 2);
+
+		if (waitingSoftwareTimer.isRunning() != false || blockingCount != (stop == true ? 1 : 2) ||
+				waitingCount != (stop == true ? 0 : 1))
+			return false;
+	}
+
+	return blockingCountInWaiting == 2;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests stop() of software timer whose function is being executed by software timer service thread - it must wait
+ * until the function returns, so that the software timer may be safely destroyed right after that.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	volatile uint32_t blockingCount {};
+	auto blockingSoftwareTimer = makeSoftwareTimer(SoftwareTimerBase::ExecutionContext::ServiceThread,
+			[&blockingCount]()
+			{
+				ThisThread::sleepFor(longDuration);
+				++blockingCount;
+			});
+
+	waitForNextTick();
+
+	const auto start = TickClock::now();
+	blockingSoftwareTimer.start(start + singleDuration);
+	ThisThread::sleepUntil(start + singleDuration * 2);
+
+	// function of software timer is being executed now
+	if (blockingSoftwareTimer.isRunning() != false || blockingCount != 0)
+		return false;
+
+	blockingSoftwareTimer.stop();
+	return blockingCount == 1 && TickClock::now() > start + longDuration;
+}
+
+}	// namespace
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerServiceThreadTestCase::run_() const
+{
+#if CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE != 0
+
+	return phase1() == true && phase2() == true && phase3() == true;
+
+#else	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE == 0
+
+	return true;
+
+#endif	// CONFIG_SOFTWARE_TIMER_SERVICE_THREAD_STACK_SIZE == 0
+}
+
+}	// namespace test
+
+}	// namespace distortos
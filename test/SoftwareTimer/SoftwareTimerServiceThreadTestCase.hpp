@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SoftwareTimerServiceThreadTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERSERVICETHREADTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERSERVICETHREADTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests execution of software timers with SoftwareTimerBase::ExecutionContext::ServiceThread.
+ *
+ * Tests also that stop() of such software timer waits until its function executed by software timer service thread
+ * returns.
+ */
+
+class SoftwareTimerServiceThreadTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERSERVICETHREADTESTCASE_HPP_
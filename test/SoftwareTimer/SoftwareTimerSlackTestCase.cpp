@@ -0,0 +1,186 @@
+/**
+ * \file
+ * \brief SoftwareTimerSlackTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-12
+ */
+
+#include "SoftwareTimerSlackTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether expiration of software timer with slack is delayed until expiration of other software timer (without
+ * slack) which is within the slack, and whether it is delayed until its deadline when there is no such timer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TickClock::time_point slackTimePoint {};
+	TickClock::time_point exactTimePoint {};
+	auto slackSoftwareTimer = makeSoftwareTimer(
+			[&slackTimePoint]()
+			{
+				slackTimePoint = TickClock::now();
+			});
+	auto exactSoftwareTimer = makeSoftwareTimer(
+			[&exactTimePoint]()
+			{
+				exactTimePoint = TickClock::now();
+			});
+
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		slackSoftwareTimer.start(start + singleDuration, TickClock::duration{}, longDuration);
+		exactSoftwareTimer.start(start + singleDuration * 4);
+
+		// sleeping would be a wakeup which handles the slack timer, so busy waiting is used
+		while (TickClock::now() < start + singleDuration * 2);
+
+		// slack timer expired, but it must wait for the exact timer
+		if (slackSoftwareTimer.isRunning() != true || slackTimePoint != TickClock::time_point{})
+			return false;
+
+		ThisThread::sleepUntil(start + longDuration * 2);
+
+		if (slackSoftwareTimer.isRunning() != false || exactSoftwareTimer.isRunning() != false ||
+				exactTimePoint != start + singleDuration * 4 || slackTimePoint != exactTimePoint)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		// there's no other timer, so slack timer must be handled at its deadline
+		const auto start = TickClock::now();
+		slackSoftwareTimer.start(start + singleDuration, TickClock::duration{}, singleDuration * 3);
+		if (slackSoftwareTimer.getDeadline() != start + singleDuration * 4)
+			return false;
+
+		ThisThread::sleepUntil(start + longDuration);
+
+		if (slackSoftwareTimer.isRunning() != false || slackTimePoint != start + singleDuration * 4)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether timeouts of sleeps and of timed waits on semaphore are coalesced with expiration of software timer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	auto softwareTimer = makeSoftwareTimer(
+			[]()
+			{
+
+			});
+
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		softwareTimer.start(start + singleDuration * 4);
+		ThisThread::sleepUntil(start + singleDuration, longDuration);
+		if (TickClock::now() != start + singleDuration * 4)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		softwareTimer.start(start + singleDuration * 4);
+		ThisThread::sleepFor(TickClock::duration{}, longDuration);
+		if (TickClock::now() != start + singleDuration * 4)
+			return false;
+	}
+
+	{
+		Semaphore semaphore {0};
+
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		softwareTimer.start(start + singleDuration * 4);
+		const auto ret = semaphore.tryWaitUntil(start + singleDuration, longDuration);
+		if (ret != ETIMEDOUT || TickClock::now() != start + singleDuration * 4)
+			return false;
+	}
+
+	{
+		Semaphore semaphore {0};
+
+		waitForNextTick();
+
+		// there's no other timer, so timeout must happen at its deadline
+		const auto start = TickClock::now();
+		const auto ret = semaphore.tryWaitFor(singleDuration, singleDuration * 2);
+		if (ret != ETIMEDOUT || TickClock::now() != start + singleDuration * 4)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerSlackTestCase::run_() const
+{
+	return phase1() == true && phase2() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
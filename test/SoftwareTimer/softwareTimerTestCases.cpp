@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-12
  */
 
 #include "softwareTimerTestCases.hpp"
@@ -16,6 +16,9 @@
 #include "SoftwareTimerOrderingTestCase.hpp"
 #include "SoftwareTimerOperationsTestCase.hpp"
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
+#include "SoftwareTimerServiceThreadTestCase.hpp"
+#include "SoftwareTimerPeriodicTestCase.hpp"
+#include "SoftwareTimerSlackTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -41,12 +44,24 @@ const SoftwareTimerOperationsTestCase operationsTestCase;
 /// SoftwareTimerFunctionTypesTestCase instance
 const SoftwareTimerFunctionTypesTestCase functionTypesTestCase;
 
+/// SoftwareTimerServiceThreadTestCase instance
+const SoftwareTimerServiceThreadTestCase serviceThreadTestCase;
+
+/// SoftwareTimerPeriodicTestCase instance
+const SoftwareTimerPeriodicTestCase periodicTestCase;
+
+/// SoftwareTimerSlackTestCase instance
+const SoftwareTimerSlackTestCase slackTestCase;
+
 /// array with references to TestCase objects related to software timers
 const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 {
 		TestCaseGroup::Range::value_type{orderingTestCase},
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
+		TestCaseGroup::Range::value_type{serviceThreadTestCase},
+		TestCaseGroup::Range::value_type{periodicTestCase},
+		TestCaseGroup::Range::value_type{slackTestCase},
 };
 
 }	// namespace
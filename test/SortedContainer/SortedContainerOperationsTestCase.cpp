@@ -0,0 +1,284 @@
+/**
+ * \file
+ * \brief SortedContainerOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "SortedContainerOperationsTestCase.hpp"
+
+#include "distortos/containers/SortedPairingHeap.hpp"
+#include "distortos/containers/SortedSkipList.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// element kept in tested containers
+struct Element
+{
+	/**
+	 * \brief Element's constructor
+	 *
+	 * \param [in] keyValue is the key used for sorting
+	 * \param [in] sequenceValue is the sequence number of element in its container, used to verify FIFO order of equal
+	 * keys
+	 * \param [in] identifierValue is the unique identifier of element
+	 */
+
+	constexpr Element(const uint32_t keyValue, const uint32_t sequenceValue, const size_t identifierValue) :
+			key{keyValue},
+			sequence{sequenceValue},
+			identifier{identifierValue}
+	{
+
+	}
+
+	/// key used for sorting
+	uint32_t key;
+
+	/// sequence number of element in its container, used to verify FIFO order of equal keys
+	uint32_t sequence;
+
+	/// unique identifier of element
+	size_t identifier;
+};
+
+/// functor which gives ascending order of keys
+struct ElementAscendingKey
+{
+	/**
+	 * \brief ElementAscendingKey's function call operator
+	 *
+	 * \param [in] left is the object on the left side of comparison
+	 * \param [in] right is the object on the right side of comparison
+	 *
+	 * \return true if left's key is greater than right's key
+	 */
+
+	bool operator()(const Element& left, const Element& right) const
+	{
+		return left.key > right.key;
+	}
+};
+
+/// SortedSkipList used in tests
+using SkipList = containers::SortedSkipList<Element, ElementAscendingKey>;
+
+/// SortedPairingHeap used in tests
+using PairingHeap = containers::SortedPairingHeap<Element, ElementAscendingKey>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements used in tests
+constexpr size_t elementsCount {48};
+
+/// number of different keys used in tests - there are many elements with equal keys
+constexpr uint32_t keysCount {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with flags which mark elements expected in the container, indexed with Element::identifier
+using ExpectedElements = std::array<bool, elementsCount * 2>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] identifier is the unique identifier of element
+ *
+ * \return key of element with given identifier, keys are mixed so that elements with equal keys are not adjacent
+ */
+
+constexpr uint32_t getKey(const size_t identifier)
+{
+	return identifier * 7 % keysCount;
+}
+
+/**
+ * \brief Removes all elements from the container, checking their order.
+ *
+ * Keys of elements must be in ascending order and elements with equal keys must be in FIFO order (ascending sequence
+ * numbers). Each element must be expected and each expected element must be found exactly once.
+ *
+ * \param Container is the type of tested container
+ *
+ * \param [in] container is a reference to tested container
+ * \param [in] expectedElements is a copy of array with flags which mark elements expected in the container
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Container>
+bool drainAndCheck(Container& container, ExpectedElements expectedElements)
+{
+	size_t expectedSize {};
+	for (const auto expected : expectedElements)
+		if (expected == true)
+			++expectedSize;
+
+	if (container.size() != expectedSize)
+		return false;
+
+	bool first {true};
+	uint32_t previousKey {};
+	uint32_t previousSequence {};
+	while (container.empty() == false)
+	{
+		const auto& element = *container.begin();
+		if (element.identifier >= expectedElements.size() || expectedElements[element.identifier] != true)
+			return false;
+		expectedElements[element.identifier] = false;
+
+		if (first == false && (element.key < previousKey ||
+				(element.key == previousKey && element.sequence <= previousSequence)))
+			return false;
+
+		first = false;
+		previousKey = element.key;
+		previousSequence = element.sequence;
+		container.pop_front();
+	}
+
+	for (const auto expected : expectedElements)
+		if (expected == true)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests erase() of arbitrary elements, including the first one. Then adds more elements with the same keys - they must
+ * be placed after remaining elements with equal keys.
+ *
+ * \param Container is the type of tested container
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Container>
+bool phase1()
+{
+	Container container;
+	std::array<typename Container::iterator, elementsCount> iterators;
+	ExpectedElements expectedElements {};
+	uint32_t sequence {};
+
+	for (size_t identifier {}; identifier < elementsCount; ++identifier)
+	{
+		iterators[identifier] = container.sortedEmplace(getKey(identifier), sequence++, identifier);
+		expectedElements[identifier] = true;
+	}
+
+	for (size_t identifier {}; identifier < elementsCount; identifier += 3)
+	{
+		container.erase(iterators[identifier]);
+		expectedElements[identifier] = false;
+	}
+
+	{
+		const auto identifier = container.begin()->identifier;
+		container.erase(container.begin());
+		expectedElements[identifier] = false;
+	}
+
+	for (size_t identifier {elementsCount}; identifier < elementsCount * 2; ++identifier)
+	{
+		container.sortedEmplace(getKey(identifier), sequence++, identifier);
+		expectedElements[identifier] = true;
+	}
+
+	return drainAndCheck(container, expectedElements);
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests sortedSplice() of arbitrary elements, including the first one, from one container to another. Transferred
+ * elements must be placed after elements with equal keys already present in the destination container.
+ *
+ * \param Container is the type of tested container
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Container>
+bool phase2()
+{
+	Container source;
+	Container destination;
+	std::array<typename Container::iterator, elementsCount * 2> iterators;
+	ExpectedElements expectedSourceElements {};
+	ExpectedElements expectedDestinationElements {};
+	uint32_t sourceSequence {};
+	uint32_t destinationSequence {};
+
+	for (size_t identifier {}; identifier < elementsCount * 2; ++identifier)
+		if (identifier % 2 == 0)
+		{
+			iterators[identifier] = source.sortedEmplace(getKey(identifier), sourceSequence++, identifier);
+			expectedSourceElements[identifier] = true;
+		}
+		else
+		{
+			iterators[identifier] = destination.sortedEmplace(getKey(identifier), destinationSequence++, identifier);
+			expectedDestinationElements[identifier] = true;
+		}
+
+	const auto transfer = [&](const typename Container::iterator iterator)
+			{
+				const auto identifier = iterator->identifier;
+				iterator->sequence = destinationSequence++;
+				destination.sortedSplice(source, iterator);
+				expectedSourceElements[identifier] = false;
+				expectedDestinationElements[identifier] = true;
+			};
+
+	for (size_t identifier {}; identifier < elementsCount * 2; identifier += 6)
+		transfer(iterators[identifier]);
+
+	transfer(source.begin());
+
+	return drainAndCheck(source, expectedSourceElements) == true &&
+			drainAndCheck(destination, expectedDestinationElements) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SortedContainerOperationsTestCase::run_() const
+{
+	return phase1<SkipList>() == true && phase1<PairingHeap>() == true && phase2<SkipList>() == true &&
+			phase2<PairingHeap>() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief SortedContainerOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_SORTEDCONTAINER_SORTEDCONTAINEROPERATIONSTESTCASE_HPP_
+#define TEST_SORTEDCONTAINER_SORTEDCONTAINEROPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various SortedSkipList and SortedPairingHeap operations.
+ *
+ * Tests erasing (erase()) of arbitrary elements - not only the first one - and transferring (sortedSplice()) of
+ * arbitrary elements between two containers. After these operations all remaining elements must be available in
+ * sorted order, elements with equal keys must be kept in FIFO order (elements transferred from other container are
+ * placed after elements with equal keys already present in the destination) and erased or transferred elements must
+ * not be available anymore.
+ */
+
+class SortedContainerOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SORTEDCONTAINER_SORTEDCONTAINEROPERATIONSTESTCASE_HPP_
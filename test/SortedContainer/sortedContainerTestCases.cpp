@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief sortedContainerTestCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "sortedContainerTestCases.hpp"
+
+#include "SortedContainerOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SortedContainerOperationsTestCase instance
+const SortedContainerOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to sorted containers
+const TestCaseGroup::Range::value_type sortedContainerTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup sortedContainerTestCases {TestCaseGroup::Range{sortedContainerTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
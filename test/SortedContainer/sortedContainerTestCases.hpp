@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief sortedContainerTestCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_SORTEDCONTAINER_SORTEDCONTAINERTESTCASES_HPP_
+#define TEST_SORTEDCONTAINER_SORTEDCONTAINERTESTCASES_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+class TestCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of test cases related to sorted containers
+extern const TestCaseGroup sortedContainerTestCases;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SORTEDCONTAINER_SORTEDCONTAINERTESTCASES_HPP_
@@ -0,0 +1,332 @@
+/**
+ * \file
+ * \brief StreamBufferOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "StreamBufferOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticStreamBuffer.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// capacity of stream buffer used in tests, bytes
+constexpr size_t bufferSize {8};
+
+/// trigger level of stream buffer used in tests, bytes
+constexpr size_t triggerLevel {4};
+
+/// expected number of context switches in block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on stream buffer (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/// test data
+const uint8_t testData[] {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l'};
+
+/// size of stack for test threads, bytes
+constexpr size_t testThreadStackSize {256};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Sender thread used in phase 4 of test case.
+ *
+ * \param [in] streamBuffer is a reference to StreamBuffer to which the data will be sent
+ * \param [in] data is a pointer to data that will be sent
+ * \param [in] size is the size of \a data, bytes
+ * \param [out] sharedRet is a reference to variable in which result of StreamBuffer::trySendFor() will be saved
+ */
+
+void senderThread(StreamBuffer& streamBuffer, const uint8_t* const data, const size_t size, int& sharedRet)
+{
+	sharedRet = streamBuffer.trySendFor(longDuration, data, size);
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all try*() functions properly send and receive data, also when it wraps around the end of storage, and
+ * whether they properly return some error when dealing with full or empty stream buffer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticStreamBuffer<bufferSize> streamBuffer {triggerLevel};
+	uint8_t buffer[sizeof(testData)] {};
+
+	{
+		// data larger than the buffer can never be sent
+		const auto ret = streamBuffer.trySend(testData, bufferSize + 1);
+		if (ret != EMSGSIZE)
+			return false;
+	}
+
+	{
+		// stream buffer is empty, so tryReceive() must fail immediately
+		const auto ret = streamBuffer.tryReceive(buffer, sizeof(buffer));
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+
+	{
+		const auto ret = streamBuffer.trySend(testData, 5);
+		if (ret != 0 || streamBuffer.getSize() != 5)
+			return false;
+	}
+
+	{
+		// only 3 bytes are free, so data must not be sent partially
+		const auto ret = streamBuffer.trySend(testData + 5, 4);
+		if (ret != EAGAIN || streamBuffer.getSize() != 5)
+			return false;
+	}
+
+	{
+		const auto ret = streamBuffer.tryReceive(buffer, 3);
+		if (ret.first != 0 || ret.second != 3 || memcmp(buffer, testData, 3) != 0)
+			return false;
+	}
+
+	{
+		// this data wraps around the end of storage
+		const auto ret = streamBuffer.trySend(testData + 5, 4);
+		if (ret != 0 || streamBuffer.getSize() != 6)
+			return false;
+	}
+
+	{
+		// tryReceive() receives all available bytes which fit in the buffer
+		const auto ret = streamBuffer.tryReceive(buffer, sizeof(buffer));
+		if (ret.first != 0 || ret.second != 6 || memcmp(buffer, testData + 3, 6) != 0)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		// stream buffer is empty, so tryReceiveFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.tryReceiveFor(singleDuration, buffer, sizeof(buffer));
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != 0 || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		// less than trigger level is available, so tryReceiveFor() should receive it after time-out
+		const auto start = TickClock::now();
+		const auto sendRet = streamBuffer.trySend(testData, triggerLevel - 1);
+		const auto ret = streamBuffer.tryReceiveFor(singleDuration, buffer, sizeof(buffer));
+		const auto realDuration = TickClock::now() - start;
+		if (sendRet != 0 || ret.first != 0 || ret.second != triggerLevel - 1 ||
+				memcmp(buffer, testData, ret.second) != 0 || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		const auto ret = streamBuffer.trySend(testData, bufferSize);
+		if (ret != 0 || streamBuffer.getSize() != bufferSize)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		// stream buffer is full, so trySendFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = streamBuffer.trySendFor(singleDuration, testData, 1);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt -> thread communication scenario. Main (current) thread waits for data to become available in stream
+ * buffer. Two software timers send data below trigger level to the same stream buffer from interrupt context - main
+ * thread is expected to be woken only by the second one, when trigger level is reached.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticStreamBuffer<bufferSize> streamBuffer {triggerLevel};
+	auto softwareTimer1 = makeSoftwareTimer(
+			[&streamBuffer]()
+			{
+				streamBuffer.trySend(testData, triggerLevel / 2);
+			});
+	auto softwareTimer2 = makeSoftwareTimer(
+			[&streamBuffer]()
+			{
+				streamBuffer.trySend(testData + triggerLevel / 2, triggerLevel / 2);
+			});
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer1.start(wakeUpTimePoint - longDuration / 2);
+	softwareTimer2.start(wakeUpTimePoint);
+
+	// stream buffer is currently empty, but receive() should succeed at expected time
+	uint8_t buffer[bufferSize] {};
+	const auto ret = streamBuffer.receive(buffer, sizeof(buffer));
+	const auto wokenUpTimePoint = TickClock::now();
+	return ret.first == 0 && ret.second == triggerLevel && memcmp(buffer, testData, triggerLevel) == 0 &&
+			wakeUpTimePoint == wokenUpTimePoint &&
+			statistics::getContextSwitchCount() - contextSwitchCount == softwareTimerContextSwitchCount;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests thread -> interrupt communication scenario. Main (current) thread sends data to stream buffer (which is
+ * initially full). Two software timers receive data from the same stream buffer from interrupt context - main thread is
+ * expected to be woken only by the second one, when enough bytes are free.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticStreamBuffer<bufferSize> streamBuffer {triggerLevel};
+	uint8_t buffer[bufferSize] {};
+	auto softwareTimer1 = makeSoftwareTimer(
+			[&streamBuffer, &buffer]()
+			{
+				streamBuffer.tryReceive(buffer, 2);
+			});
+	auto softwareTimer2 = makeSoftwareTimer(
+			[&streamBuffer, &buffer]()
+			{
+				streamBuffer.tryReceive(buffer + 2, 2);
+			});
+
+	if (streamBuffer.trySend(testData, bufferSize) != 0)
+		return false;
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto wakeUpTimePoint = TickClock::now() + longDuration;
+	softwareTimer1.start(wakeUpTimePoint - longDuration / 2);
+	softwareTimer2.start(wakeUpTimePoint);
+
+	// stream buffer is currently full, but send() should succeed at expected time
+	const auto ret = streamBuffer.send(testData + bufferSize, 4);
+	const auto wokenUpTimePoint = TickClock::now();
+	if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || memcmp(buffer, testData, 4) != 0 ||
+			statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerContextSwitchCount)
+		return false;
+
+	const auto receiveRet = streamBuffer.tryReceive(buffer, sizeof(buffer));
+	return receiveRet.first == 0 && receiveRet.second == bufferSize && memcmp(buffer, testData + 4, bufferSize) == 0;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests multiple blocked senders. Two threads with higher priority than main (current) thread block while sending to
+ * stream buffer (which is initially full). Main thread receives data which frees enough space for both of them - both
+ * senders are expected to be woken and to send their data.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	constexpr size_t dataSize {2};
+
+	StaticStreamBuffer<bufferSize> streamBuffer {triggerLevel};
+	if (streamBuffer.trySend(testData, bufferSize) != 0)
+		return false;
+
+	const auto testThreadPriority = static_cast<uint8_t>(ThisThread::getPriority() + 1);
+	int sharedRet1 {-1};
+	int sharedRet2 {-1};
+	auto senderThread1 = makeStaticThread<testThreadStackSize>(testThreadPriority, senderThread, std::ref(streamBuffer),
+			testData + bufferSize, dataSize, std::ref(sharedRet1));
+	auto senderThread2 = makeStaticThread<testThreadStackSize>(testThreadPriority, senderThread, std::ref(streamBuffer),
+			testData + bufferSize + dataSize, dataSize, std::ref(sharedRet2));
+
+	// both senders preempt main thread and block, as stream buffer is full
+	senderThread1.start();
+	senderThread2.start();
+
+	uint8_t buffer[bufferSize] {};
+	const auto receiveRet = streamBuffer.tryReceive(buffer, 2 * dataSize);
+	senderThread1.join();
+	senderThread2.join();
+	if (receiveRet.first != 0 || receiveRet.second != 2 * dataSize || sharedRet1 != 0 || sharedRet2 != 0)
+		return false;
+
+	const auto ret = streamBuffer.tryReceive(buffer, sizeof(buffer));
+	return ret.first == 0 && ret.second == bufferSize && memcmp(buffer, testData + 2 * dataSize, bufferSize) == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool StreamBufferOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief StreamBufferOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_STREAMBUFFER_STREAMBUFFEROPERATIONSTESTCASE_HPP_
+#define TEST_STREAMBUFFER_STREAMBUFFEROPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various StreamBuffer operations.
+ *
+ * Tests sending (trySend() and trySendFor()) and receiving (tryReceive() and tryReceiveFor()) of data which wraps
+ * around the end of storage. Tests interrupt -> thread and thread -> interrupt communication scenarios - blocked
+ * receiver must be woken only when trigger level is reached and blocked sender must be woken only when enough bytes are
+ * free. Tests whether all blocked senders are woken when enough bytes are free for all of them.
+ */
+
+class StreamBufferOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_STREAMBUFFER_STREAMBUFFEROPERATIONSTESTCASE_HPP_
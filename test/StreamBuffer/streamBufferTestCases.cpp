@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief streamBufferTestCases object definition
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-08
+ */
+
+#include "streamBufferTestCases.hpp"
+
+#include "StreamBufferOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// StreamBufferOperationsTestCase instance
+const StreamBufferOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to stream buffers
+const TestCaseGroup::Range::value_type streamBufferTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup streamBufferTestCases {TestCaseGroup::Range{streamBufferTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
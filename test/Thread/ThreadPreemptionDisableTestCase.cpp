@@ -0,0 +1,200 @@
+/**
+ * \file
+ * \brief ThreadPreemptionDisableTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-14
+ */
+
+#include "ThreadPreemptionDisableTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/SchedulerLock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/StaticThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {384};
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread.
+ *
+ * Waits for the semaphore and increments the counter - requested number of times.
+ *
+ * \param [in] semaphore is a reference to semaphore for which the thread waits
+ * \param [out] counter is a reference to incremented counter
+ * \param [in] iterations is the number of iterations
+ */
+
+void thread(Semaphore& semaphore, volatile uint32_t& counter, const uint32_t iterations)
+{
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		semaphore.wait();
+		++counter;
+	}
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests nesting of disabled preemption and handling of errors. Thread with higher priority is unblocked, but it may
+ * run only when the outermost call to ThisThread::disablePreemption() is undone.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	if (ThisThread::enablePreemption() != EPERM)
+		return false;
+
+	Semaphore semaphore {0};
+	volatile uint32_t counter {};
+	auto testThread = makeStaticThread<testThreadStackSize>(ThisThread::getPriority() + 1, thread,
+			std::ref(semaphore), std::ref(counter), 1);
+	testThread.start();
+
+	if (ThisThread::disablePreemption() != 0 || ThisThread::disablePreemption() != 0)
+		return false;
+
+	semaphore.post();
+	const auto counterInner = counter;
+
+	if (ThisThread::enablePreemption() != 0)
+		return false;
+
+	const auto counterOuter = counter;
+
+	if (ThisThread::enablePreemption() != 0)
+		return false;
+
+	const auto counterAfter = counter;
+	testThread.join();
+	return counterInner == 0 && counterOuter == 0 && counterAfter == 1 && ThisThread::enablePreemption() == EPERM;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests that interrupts are fully functional while SchedulerLock is held - higher-priority thread unblocked by
+ * software timer (executed from tick interrupt) may run only when the lock is released.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+	volatile uint32_t counter {};
+	auto testThread = makeStaticThread<testThreadStackSize>(ThisThread::getPriority() + 1, thread,
+			std::ref(semaphore), std::ref(counter), 1);
+	testThread.start();
+	auto softwareTimer = makeSoftwareTimer(
+			[&semaphore]()
+			{
+				semaphore.post();
+			});
+
+	uint32_t counterLocked;
+	TickClock::duration durationLocked;
+
+	waitForNextTick();
+
+	{
+		const SchedulerLock schedulerLock;
+
+		const auto start = TickClock::now();
+		softwareTimer.start(singleDuration);
+		while (softwareTimer.isRunning() == true || TickClock::now() < start + singleDuration * 2);	// busy wait
+
+		counterLocked = counter;
+		durationLocked = TickClock::now() - start;
+	}
+
+	const auto counterAfter = counter;
+	testThread.join();
+	return counterLocked == 0 && durationLocked >= singleDuration * 2 && counterAfter == 1;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests that current thread may block while its preemption is disabled - higher-priority thread runs in the meantime.
+ * Preemption stays disabled after the thread is woken.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	Semaphore semaphore {0};
+	volatile uint32_t counter {};
+	auto testThread = makeStaticThread<testThreadStackSize>(ThisThread::getPriority() + 1, thread,
+			std::ref(semaphore), std::ref(counter), 2);
+	testThread.start();
+
+	uint32_t counterLocked;
+	uint32_t counterBlocked;
+	uint32_t counterWoken;
+
+	{
+		const SchedulerLock schedulerLock;
+
+		semaphore.post();
+		counterLocked = counter;
+		ThisThread::sleepFor(singleDuration);
+		counterBlocked = counter;
+
+		semaphore.post();
+		counterWoken = counter;
+	}
+
+	const auto counterAfter = counter;
+	testThread.join();
+	return counterLocked == 0 && counterBlocked == 1 && counterWoken == 1 && counterAfter == 2;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPreemptionDisableTestCase::run_() const
+{
+	return phase1() == true && phase2() == true && phase3() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
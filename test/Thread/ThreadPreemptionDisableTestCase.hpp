@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief ThreadPreemptionDisableTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-14
+ */
+
+#ifndef TEST_THREAD_THREADPREEMPTIONDISABLETESTCASE_HPP_
+#define TEST_THREAD_THREADPREEMPTIONDISABLETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests disabling of preemption with ThisThread::disablePreemption() / ThisThread::enablePreemption() and
+ * SchedulerLock.
+ *
+ * Tests that context switch to higher-priority thread is deferred while preemption is disabled (also when the thread
+ * is unblocked from interrupt, which must still be handled), that it is executed when the outermost lock is released,
+ * and that current thread may block with preemption disabled.
+ */
+
+class ThreadPreemptionDisableTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX / 2};
+
+public:
+
+	/**
+	 * \brief ThreadPreemptionDisableTestCase's constructor
+	 */
+
+	constexpr ThreadPreemptionDisableTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADPREEMPTIONDISABLETESTCASE_HPP_
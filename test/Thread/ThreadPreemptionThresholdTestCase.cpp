@@ -0,0 +1,233 @@
+/**
+ * \file
+ * \brief ThreadPreemptionThresholdTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "ThreadPreemptionThresholdTestCase.hpp"
+
+#include "SequenceAsserter.hpp"
+
+#include "distortos/SchedulerLock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {384};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Waiting test thread.
+ *
+ * Waits for the semaphore and marks the sequence point in SequenceAsserter.
+ *
+ * \param [in] semaphore is a reference to semaphore for which the thread waits
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] sequencePoint is the sequence point of this thread
+ */
+
+void waitingThread(Semaphore& semaphore, SequenceAsserter& sequenceAsserter, const unsigned int sequencePoint)
+{
+	semaphore.wait();
+	sequenceAsserter.sequencePoint(sequencePoint);
+}
+
+/**
+ * \brief Thread with preemption threshold used in phase 1.
+ *
+ * Unblocks thread with priority lower than its threshold - which must not preempt it - and thread with priority higher
+ * than its threshold - which must preempt it immediately.
+ *
+ * \param [in] mediumSemaphore is a reference to semaphore of thread with priority lower than the threshold
+ * \param [in] highSemaphore is a reference to semaphore of thread with priority higher than the threshold
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ */
+
+void phase1Thread(Semaphore& mediumSemaphore, Semaphore& highSemaphore, SequenceAsserter& sequenceAsserter)
+{
+	sequenceAsserter.sequencePoint(0);
+	mediumSemaphore.post();
+	highSemaphore.post();
+	sequenceAsserter.sequencePoint(2);
+}
+
+/**
+ * \brief Thread with preemption threshold used in phase 2.
+ *
+ * Unblocks thread with priority lower than its threshold - which must not preempt it - and then lowers its own
+ * threshold, which must cause immediate preemption.
+ *
+ * \param [in] mediumSemaphore is a reference to semaphore of thread with priority lower than the threshold
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ */
+
+void phase2Thread(Semaphore& mediumSemaphore, SequenceAsserter& sequenceAsserter)
+{
+	sequenceAsserter.sequencePoint(0);
+	mediumSemaphore.post();
+	sequenceAsserter.sequencePoint(1);
+	ThisThread::get().setPreemptionThreshold({});
+	sequenceAsserter.sequencePoint(3);
+}
+
+/**
+ * \brief Thread with preemption threshold used in phase 3.
+ *
+ * Disables its preemption and - with preemption disabled - unblocks thread with priority higher than its threshold
+ * and thread with priority lower than its threshold - none of them may preempt it. Then enables preemption, which
+ * must cause immediate preemption only by the thread with priority higher than the threshold.
+ *
+ * \param [in] mediumSemaphore is a reference to semaphore of thread with priority lower than the threshold
+ * \param [in] highSemaphore is a reference to semaphore of thread with priority higher than the threshold
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ */
+
+void phase3Thread(Semaphore& mediumSemaphore, Semaphore& highSemaphore, SequenceAsserter& sequenceAsserter)
+{
+	sequenceAsserter.sequencePoint(0);
+
+	{
+		const SchedulerLock schedulerLock;
+		highSemaphore.post();
+		mediumSemaphore.post();
+		sequenceAsserter.sequencePoint(1);
+	}
+
+	sequenceAsserter.sequencePoint(3);
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests that thread with preemption threshold is preempted only by thread with priority higher than the threshold and
+ * that after such preemption it is resumed before thread with priority lower than the threshold.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	const auto priority = ThisThread::getPriority();
+	SequenceAsserter sequenceAsserter;
+	Semaphore mediumSemaphore {0};
+	Semaphore highSemaphore {0};
+	auto mediumThread = makeStaticThread<testThreadStackSize>(priority + 2, waitingThread, std::ref(mediumSemaphore),
+			std::ref(sequenceAsserter), 3u);
+	auto highThread = makeStaticThread<testThreadStackSize>(priority + 4, waitingThread, std::ref(highSemaphore),
+			std::ref(sequenceAsserter), 1u);
+	auto lowThread = makeStaticThread<testThreadStackSize>(priority + 1, phase1Thread, std::ref(mediumSemaphore),
+			std::ref(highSemaphore), std::ref(sequenceAsserter));
+	lowThread.setPreemptionThreshold(priority + 3);
+
+	mediumThread.start();
+	highThread.start();
+	lowThread.start();
+
+	mediumThread.join();
+	highThread.join();
+	lowThread.join();
+
+	return lowThread.getPreemptionThreshold() == priority + 3 && sequenceAsserter.assertSequence(4) == true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests that lowering preemption threshold of running thread allows preemption by thread which was unblocked earlier.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	const auto priority = ThisThread::getPriority();
+	SequenceAsserter sequenceAsserter;
+	Semaphore mediumSemaphore {0};
+	auto mediumThread = makeStaticThread<testThreadStackSize>(priority + 2, waitingThread, std::ref(mediumSemaphore),
+			std::ref(sequenceAsserter), 2u);
+	auto lowThread = makeStaticThread<testThreadStackSize>(priority + 1, phase2Thread, std::ref(mediumSemaphore),
+			std::ref(sequenceAsserter));
+	lowThread.setPreemptionThreshold(priority + 3);
+
+	mediumThread.start();
+	lowThread.start();
+
+	mediumThread.join();
+	lowThread.join();
+
+	return lowThread.getPreemptionThreshold() == 0 && sequenceAsserter.assertSequence(4) == true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests that preemption threshold works together with disabled preemption - thread with priority higher than the
+ * threshold, unblocked while preemption was disabled, preempts the thread when preemption is enabled, while thread
+ * with priority lower than the threshold runs only after the thread terminates.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	const auto priority = ThisThread::getPriority();
+	SequenceAsserter sequenceAsserter;
+	Semaphore mediumSemaphore {0};
+	Semaphore highSemaphore {0};
+	auto mediumThread = makeStaticThread<testThreadStackSize>(priority + 2, waitingThread, std::ref(mediumSemaphore),
+			std::ref(sequenceAsserter), 4u);
+	auto highThread = makeStaticThread<testThreadStackSize>(priority + 4, waitingThread, std::ref(highSemaphore),
+			std::ref(sequenceAsserter), 2u);
+	auto lowThread = makeStaticThread<testThreadStackSize>(priority + 1, phase3Thread, std::ref(mediumSemaphore),
+			std::ref(highSemaphore), std::ref(sequenceAsserter));
+	lowThread.setPreemptionThreshold(priority + 3);
+
+	mediumThread.start();
+	highThread.start();
+	lowThread.start();
+
+	mediumThread.join();
+	highThread.join();
+	lowThread.join();
+
+	return sequenceAsserter.assertSequence(5) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPreemptionThresholdTestCase::run_() const
+{
+	return phase1() == true && phase2() == true && phase3() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief ThreadPreemptionThresholdTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_THREAD_THREADPREEMPTIONTHRESHOLDTESTCASE_HPP_
+#define TEST_THREAD_THREADPREEMPTIONTHRESHOLDTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests preemption threshold of threads.
+ *
+ * Tests that thread with preemption threshold is preempted only by threads with priority higher than the threshold
+ * (also after it was preempted by such thread and when its preemption was disabled for some time) and that lowering the
+ * threshold of running thread allows preemption.
+ */
+
+class ThreadPreemptionThresholdTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX / 2};
+
+public:
+
+	/**
+	 * \brief ThreadPreemptionThresholdTestCase's constructor
+	 */
+
+	constexpr ThreadPreemptionThresholdTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADPREEMPTIONTHRESHOLDTESTCASE_HPP_
@@ -0,0 +1,154 @@
+/**
+ * \file
+ * \brief ThreadReentrancyTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#include "ThreadReentrancyTestCase.hpp"
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/Thread.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {192};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function for a thread - saves pointer to newlib's _reent structure used by current thread.
+ *
+ * \param [out] reent is a reference to variable which will be set to pointer to _reent structure used by current
+ * thread, nullptr if CONFIG_NEWLIB == 0
+ * \param [out] executed is a reference to variable which will be set to true
+ */
+
+void function(_reent*& reent, bool& executed)
+{
+#if CONFIG_NEWLIB == 1
+	reent = _impure_ptr;
+#else	// CONFIG_NEWLIB != 1
+	reent = nullptr;
+#endif	// CONFIG_NEWLIB != 1
+	executed = true;
+}
+
+#if CONFIG_NEWLIB == 1
+
+/**
+ * \brief Checks whether object is placed in given range of memory.
+ *
+ * \param [in] object is a pointer to checked object
+ * \param [in] begin is a pointer to the beginning of range of memory
+ * \param [in] end is a pointer to one-past-the-end of range of memory
+ *
+ * \return true if object is placed in given range of memory, false otherwise
+ */
+
+bool isInRange(const void* const object, const void* const begin, const void* const end)
+{
+	return object >= begin && object < end;
+}
+
+#endif	// CONFIG_NEWLIB == 1
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadReentrancyTestCase::run_() const
+{
+	// thread created with makeThread() - thread-specific _reent structure in Thread object
+	{
+		typename std::aligned_storage<testThreadStackSize * CONFIG_STACK_SIZE_MULTIPLIER>::type stack;
+		_reent* reent {};
+		bool executed {};
+
+		auto thread = makeThread(&stack, sizeof(stack), UINT8_MAX, function, std::ref(reent), std::ref(executed));
+		thread.start();
+		thread.join();
+
+		if (executed != true)
+			return false;
+
+#if CONFIG_NEWLIB == 1
+
+		if (reent == _global_impure_ptr || isInRange(reent, &thread, &thread + 1) == false ||
+				isInRange(reent, &stack, &stack + 1) == true)
+			return false;
+
+#endif	// CONFIG_NEWLIB == 1
+	}
+
+	// thread created with makeStaticThread() - thread-specific _reent structure in StaticThread object
+	{
+		_reent* reent {};
+		bool executed {};
+
+		auto thread = makeStaticThread<testThreadStackSize>(UINT8_MAX, function, std::ref(reent), std::ref(executed));
+		thread.start();
+		thread.join();
+
+		if (executed != true)
+			return false;
+
+#if CONFIG_NEWLIB == 1
+
+		if (reent == _global_impure_ptr || isInRange(reent, &thread, &thread + 1) == false)
+			return false;
+
+#endif	// CONFIG_NEWLIB == 1
+	}
+
+	// thread created with makeStaticThread() - shared global _reent structure
+	{
+		_reent* reent {};
+		bool executed {};
+
+		auto thread = makeStaticThread<testThreadStackSize, false, 0, 0, true>(UINT8_MAX, function, std::ref(reent),
+				std::ref(executed));
+		thread.start();
+		thread.join();
+
+		if (executed != true)
+			return false;
+
+#if CONFIG_NEWLIB == 1
+
+		if (reent != _global_impure_ptr)
+			return false;
+
+#endif	// CONFIG_NEWLIB == 1
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief ThreadReentrancyTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-06-18
+ */
+
+#ifndef TEST_THREAD_THREADREENTRANCYTESTCASE_HPP_
+#define TEST_THREAD_THREADREENTRANCYTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests location of newlib's _reent structure used by threads.
+ *
+ * Starts small threads created with makeThread() and with makeStaticThread() - with thread-specific and with shared
+ * _reent structure. Thread created with makeThread() must use thread-specific _reent structure kept in the Thread
+ * object - not in stack's buffer. Thread created with makeStaticThread() must use thread-specific or shared global
+ * _reent structure, as selected by its template argument. Checks of _reent structure are done only if
+ * CONFIG_NEWLIB == 1, otherwise only execution of these threads is tested.
+ */
+
+class ThreadReentrancyTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADREENTRANCYTESTCASE_HPP_
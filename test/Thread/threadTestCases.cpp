@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #include "threadTestCases.hpp"
@@ -19,6 +19,9 @@
 #include "ThreadSleepUntilTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadPreemptionDisableTestCase.hpp"
+#include "ThreadPreemptionThresholdTestCase.hpp"
+#include "ThreadReentrancyTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -53,6 +56,15 @@ const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+/// ThreadPreemptionDisableTestCase instance
+const ThreadPreemptionDisableTestCase preemptionDisableTestCase;
+
+/// ThreadPreemptionThresholdTestCase instance
+const ThreadPreemptionThresholdTestCase preemptionThresholdTestCase;
+
+/// ThreadReentrancyTestCase instance
+const ThreadReentrancyTestCase reentrancyTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -62,6 +74,9 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+		TestCaseGroup::Range::value_type{preemptionDisableTestCase},
+		TestCaseGroup::Range::value_type{preemptionThresholdTestCase},
+		TestCaseGroup::Range::value_type{reentrancyTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,311 @@
+/**
+ * \file
+ * \brief WaitForAnySetOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-29
+ */
+
+#include "WaitForAnySetOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticWaitForAnySet.hpp"
+#include "distortos/SoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase1 block involving tryWaitFor() or tryWaitUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks on set (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase1TryWaitForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving software timer (excluding waitForNextTick()): 1 -
+/// main thread blocks on set (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2SoftwareTimerContextSwitchCount {2};
+
+/// index of first semaphore in tested set
+constexpr size_t firstSemaphoreIndex {0};
+
+/// index of queue's semaphore in tested set
+constexpr size_t queueIndex {1};
+
+/// index of second semaphore in tested set
+constexpr size_t secondSemaphoreIndex {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// queue used in tests
+using TestQueue = StaticRawFifoQueue<uint32_t, 1>;
+
+/// set used in tests - first semaphore, queue and second semaphore
+using TestWaitForAnySet = StaticWaitForAnySet<3>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests WaitForAnySet::tryWait() when no object is ready - it must fail immediately and return EAGAIN
+ *
+ * \param [in] waitForAnySet is a reference to WaitForAnySet that will be tested
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTryWaitWhenNotReady(WaitForAnySet& waitForAnySet)
+{
+	// no object is ready, so tryWait() should fail immediately
+	waitForNextTick();
+	const auto start = TickClock::now();
+	size_t index {};
+	const auto ret = waitForAnySet.tryWait(index);
+	return ret == EAGAIN && TickClock::now() == start;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all wait functions properly return some error when no object in the set is ready and whether they
+ * return index of ready object without blocking and without modifying that object.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore firstSemaphore {0};
+	TestQueue queue;
+	Semaphore secondSemaphore {0};
+	TestWaitForAnySet waitForAnySet {firstSemaphore, queue.getPopSemaphore(), secondSemaphore};
+
+	if (waitForAnySet.getCount() != 3)
+		return false;
+
+	{
+		const auto ret = testTryWaitWhenNotReady(waitForAnySet);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no object is ready, so tryWaitFor() should time-out at expected time
+		const auto start = TickClock::now();
+		size_t index {};
+		const auto ret = waitForAnySet.tryWaitFor(singleDuration, index);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no object is ready, so tryWaitUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		size_t index {};
+		const auto ret = waitForAnySet.tryWaitUntil(requestedTimePoint, index);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		// second semaphore is ready, so tryWait() and wait() must succeed immediately without modifying it
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (secondSemaphore.post() != 0)
+			return false;
+		size_t index {};
+		if (waitForAnySet.tryWait(index) != 0 || index != secondSemaphoreIndex || waitForAnySet.wait(index) != 0 ||
+				index != secondSemaphoreIndex || secondSemaphore.getValue() != 1 || start != TickClock::now())
+			return false;
+		if (secondSemaphore.tryWait() != 0)
+			return false;
+
+		// queue is not empty, so tryWaitFor() and tryWaitUntil() must succeed immediately
+		if (queue.tryPush(uint32_t{}) != 0)
+			return false;
+		if (waitForAnySet.tryWaitFor(singleDuration, index) != 0 || index != queueIndex ||
+				waitForAnySet.tryWaitUntil(start + singleDuration, index) != 0 || index != queueIndex ||
+				start != TickClock::now())
+			return false;
+		uint32_t value;
+		if (queue.tryPop(value) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt -> thread scenario. Main (current) thread waits for any object in the set to become ready. Software
+ * timer makes one of them ready at specified time point from interrupt context, main thread is expected to be
+ * unblocked (with wait(), tryWaitFor() and tryWaitUntil()) in the same moment, with index of that object.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore firstSemaphore {0};
+	TestQueue queue;
+	Semaphore secondSemaphore {0};
+	TestWaitForAnySet waitForAnySet {firstSemaphore, queue.getPopSemaphore(), secondSemaphore};
+	size_t readyIndex {};
+	auto softwareTimer = makeSoftwareTimer(
+			[&firstSemaphore, &queue, &secondSemaphore, &readyIndex]()
+			{
+				if (readyIndex == firstSemaphoreIndex)
+					firstSemaphore.post();
+				else if (readyIndex == queueIndex)
+					queue.tryPush(uint32_t{});
+				else
+					secondSemaphore.post();
+			});
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		readyIndex = queueIndex;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// no object is currently ready, but wait() should succeed at expected time
+		size_t index {};
+		const auto ret = waitForAnySet.wait(index);
+		const auto wokenUpTimePoint = TickClock::now();
+		uint32_t value;
+		if (ret != 0 || index != queueIndex || wakeUpTimePoint != wokenUpTimePoint || queue.tryPop(value) != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryWaitWhenNotReady(waitForAnySet);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		readyIndex = firstSemaphoreIndex;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// no object is currently ready, but tryWaitFor() should succeed at expected time
+		size_t index {};
+		const auto ret = waitForAnySet.tryWaitFor(wakeUpTimePoint - TickClock::now() + longDuration, index);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || index != firstSemaphoreIndex || wakeUpTimePoint != wokenUpTimePoint ||
+				firstSemaphore.tryWait() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = testTryWaitWhenNotReady(waitForAnySet);
+		if (ret != true)
+			return ret;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		readyIndex = secondSemaphoreIndex;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// no object is currently ready, but tryWaitUntil() should succeed at expected time
+		size_t index {};
+		const auto ret = waitForAnySet.tryWaitUntil(wakeUpTimePoint + longDuration, index);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || index != secondSemaphoreIndex || wakeUpTimePoint != wokenUpTimePoint ||
+				secondSemaphore.tryWait() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	// thread is no longer registered in any object, so making them ready must not have any side effects
+	if (firstSemaphore.post() != 0 || queue.tryPush(uint32_t{}) != 0 || secondSemaphore.post() != 0)
+		return false;
+
+	size_t index {};
+	return waitForAnySet.tryWait(index) == 0 && index == firstSemaphoreIndex;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool WaitForAnySetOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
+			2 * phase1TryWaitForUntilContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 5 * waitForNextTickContextSwitchCount +
+			3 * phase2SoftwareTimerContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief WaitForAnySetOperationsTestCase class header
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-29
+ */
+
+#ifndef TEST_WAITFORANYSET_WAITFORANYSETOPERATIONSTESTCASE_HPP_
+#define TEST_WAITFORANYSET_WAITFORANYSETOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various WaitForAnySet operations.
+ *
+ * Tests waiting (wait(), tryWait(), tryWaitFor() and tryWaitUntil()) for semaphores and queues, which become ready
+ * both in thread and in interrupt context - these operations must return expected result with index of ready object,
+ * cause expected number of context switches and finish within expected time frame.
+ */
+
+class WaitForAnySetOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	virtual bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_WAITFORANYSET_WAITFORANYSETOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief waitForAnySetTestCases object declaration
+ *
+ * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * \date 2015-05-29
+ */
+
+#ifndef TEST_WAITFORANYSET_WAITFORANYSETTESTCASES_HPP_
+#define TEST_WAITFORANYSET_WAITFORANYSETTESTCASES_HPP_
+
+namespace distortos
+{
+
+namespace test
+{
+
+class TestCaseGroup;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of test cases related to WaitForAnySet
+extern const TestCaseGroup waitForAnySetTestCases;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_WAITFORANYSET_WAITFORANYSETTESTCASES_HPP_
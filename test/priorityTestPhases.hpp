@@ -8,13 +8,17 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2014-08-27
+ * \date 2015-06-01
  */
 
 #ifndef TEST_PRIORITYTESTPHASES_HPP_
 #define TEST_PRIORITYTESTPHASES_HPP_
 
 #include <array>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
 
 namespace distortos
 {
@@ -8,7 +8,7 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  *
- * \date 2015-05-16
+ * \date 2015-06-18
  */
 
 #include "testCases.hpp"
@@ -20,9 +20,17 @@
 #include "ConditionVariable/conditionVariableTestCases.hpp"
 #include "FifoQueue/fifoQueueTestCases.hpp"
 #include "RawFifoQueue/rawFifoQueueTestCases.hpp"
+#include "LockFreeFifoQueue/lockFreeFifoQueueTestCases.hpp"
 #include "MessageQueue/messageQueueTestCases.hpp"
 #include "RawMessageQueue/rawMessageQueueTestCases.hpp"
+#include "MemoryPool/memoryPoolTestCases.hpp"
+#include "WaitForAnySet/waitForAnySetTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
+#include "DeferredRequests/deferredRequestsTestCases.hpp"
+#include "StreamBuffer/streamBufferTestCases.hpp"
+#include "MessageBuffer/messageBufferTestCases.hpp"
+#include "LatestValue/latestValueTestCases.hpp"
+#include "SortedContainer/sortedContainerTestCases.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -49,9 +57,17 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
 		TestCaseGroup::Range::value_type{fifoQueueTestCases},
 		TestCaseGroup::Range::value_type{rawFifoQueueTestCases},
+		TestCaseGroup::Range::value_type{lockFreeFifoQueueTestCases},
 		TestCaseGroup::Range::value_type{messageQueueTestCases},
 		TestCaseGroup::Range::value_type{rawMessageQueueTestCases},
+		TestCaseGroup::Range::value_type{memoryPoolTestCases},
+		TestCaseGroup::Range::value_type{waitForAnySetTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
+		TestCaseGroup::Range::value_type{deferredRequestsTestCases},
+		TestCaseGroup::Range::value_type{streamBufferTestCases},
+		TestCaseGroup::Range::value_type{messageBufferTestCases},
+		TestCaseGroup::Range::value_type{latestValueTestCases},
+		TestCaseGroup::Range::value_type{sortedContainerTestCases},
 };
 
 }	// namespace